@@ -0,0 +1,284 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+
+namespace sli { namespace bench
+{
+
+//----------------------------------------------------------------------
+//                        log_double
+//----------------------------------------------------------------------
+// number stored as a sign and a logarithm of absolute value:
+//
+//     val = (m_sign ? -1 : 1) * exp(m_log)
+//
+// zero is represented by m_log = -Inf; NaN by m_log = NaN
+struct log_double
+{
+    double          m_log;
+    bool            m_sign;
+};
+
+inline log_double make_log_double(double val)
+{
+    return log_double{std::log(std::fabs(val)), std::signbit(val)};
+};
+
+// return value as double
+inline double value(const log_double& x)
+{
+    return x.m_sign == true ? -std::exp(x.m_log) : std::exp(x.m_log);
+};
+
+inline log_double operator+(const log_double& x1, const log_double& x2)
+{
+    if (std::isnan(x1.m_log) || std::isnan(x2.m_log))
+        return log_double{std::numeric_limits<double>::quiet_NaN(), false};
+
+    // ensure |a| >= |b|
+    const log_double& a = x1.m_log >= x2.m_log ? x1 : x2;
+    const log_double& b = x1.m_log >= x2.m_log ? x2 : x1;
+
+    if (b.m_log == -std::numeric_limits<double>::infinity())
+        return a;
+
+    if (a.m_log == std::numeric_limits<double>::infinity())
+    {
+        if (b.m_log == a.m_log && b.m_sign != a.m_sign)
+            return log_double{std::numeric_limits<double>::quiet_NaN(), false};
+
+        return a;
+    };
+
+    double d            = b.m_log - a.m_log;
+
+    if (a.m_sign == b.m_sign)
+        return log_double{a.m_log + std::log1p(std::exp(d)), a.m_sign};
+
+    if (d == 0.0)
+        return log_double{-std::numeric_limits<double>::infinity(), false};
+
+    return log_double{a.m_log + std::log1p(-std::exp(d)), a.m_sign};
+};
+
+inline log_double operator*(const log_double& x1, const log_double& x2)
+{
+    return log_double{x1.m_log + x2.m_log, x1.m_sign != x2.m_sign};
+};
+
+inline log_double operator/(const log_double& x1, const log_double& x2)
+{
+    return log_double{x1.m_log - x2.m_log, x1.m_sign != x2.m_sign};
+};
+
+inline bool operator<(const log_double& x1, const log_double& x2)
+{
+    if (std::isnan(x1.m_log) || std::isnan(x2.m_log))
+        return false;
+
+    const double zero   = -std::numeric_limits<double>::infinity();
+
+    int s1              = x1.m_log == zero ? 0 : (x1.m_sign == true ? -1 : 1);
+    int s2              = x2.m_log == zero ? 0 : (x2.m_sign == true ? -1 : 1);
+
+    if (s1 != s2)
+        return s1 < s2;
+
+    if (s1 == 0)
+        return false;
+
+    return s1 > 0 ? x1.m_log < x2.m_log : x1.m_log > x2.m_log;
+};
+
+inline log_double exp(const log_double& x)
+{
+    return log_double{value(x), false};
+};
+
+inline log_double log_abs(const log_double& x)
+{
+    return make_log_double(x.m_log);
+};
+
+// |x|^y
+inline log_double pow_abs(const log_double& x, const log_double& y)
+{
+    return log_double{value(y) * x.m_log, false};
+};
+
+//----------------------------------------------------------------------
+//                        mant_exp
+//----------------------------------------------------------------------
+// number stored as a double mantissa and a 64-bit binary exponent:
+//
+//     val = m_mant * 2^m_exp
+//
+// where 0.5 <= |m_mant| < 1 and |m_exp| <= 2^62 for regular numbers;
+// zero, infinities and NaN are stored in m_mant with m_exp = 0
+struct mant_exp
+{
+    double          m_mant;
+    int64_t         m_exp;
+};
+
+// normalize m * 2^e; exponents outside of [-2^62, 2^62] give infinity
+// or zero
+inline mant_exp make_mant_exp(double m, int64_t e)
+{
+    static const int64_t max_exp    = int64_t(1) << 62;
+
+    if (m == 0.0 || std::isfinite(m) == false)
+        return mant_exp{m, 0};
+
+    int k;
+    m                   = std::frexp(m, &k);
+    e                   = e + k;
+
+    if (e > max_exp)
+        return mant_exp{std::copysign(std::numeric_limits<double>::infinity(), m), 0};
+
+    if (e < -max_exp)
+        return mant_exp{std::copysign(0.0, m), 0};
+
+    return mant_exp{m, e};
+};
+
+// return true if x is regular, i.e. not zero, infinity nor NaN
+inline bool is_regular(const mant_exp& x)
+{
+    return x.m_mant != 0.0 && std::isfinite(x.m_mant) == true;
+};
+
+// return value as double
+inline double value(const mant_exp& x)
+{
+    if (x.m_exp > 2048)
+        return x.m_mant * std::numeric_limits<double>::infinity();
+
+    if (x.m_exp < -2048)
+        return x.m_mant * 0.0;
+
+    return std::ldexp(x.m_mant, int(x.m_exp));
+};
+
+inline mant_exp operator+(const mant_exp& x1, const mant_exp& x2)
+{
+    if (is_regular(x1) == false || is_regular(x2) == false)
+    {
+        if (x1.m_mant == 0.0)
+            return x2;
+
+        if (x2.m_mant == 0.0)
+            return x1;
+
+        return mant_exp{x1.m_mant + x2.m_mant, 0};
+    };
+
+    // ensure exponent of a is not smaller than exponent of b
+    const mant_exp& a   = x1.m_exp >= x2.m_exp ? x1 : x2;
+    const mant_exp& b   = x1.m_exp >= x2.m_exp ? x2 : x1;
+
+    int64_t d           = a.m_exp - b.m_exp;
+
+    if (d > 60)
+        return a;
+
+    return make_mant_exp(a.m_mant + std::ldexp(b.m_mant, -int(d)), a.m_exp);
+};
+
+inline mant_exp operator*(const mant_exp& x1, const mant_exp& x2)
+{
+    if (is_regular(x1) == false || is_regular(x2) == false)
+        return mant_exp{x1.m_mant * x2.m_mant, 0};
+
+    return make_mant_exp(x1.m_mant * x2.m_mant, x1.m_exp + x2.m_exp);
+};
+
+inline mant_exp operator/(const mant_exp& x1, const mant_exp& x2)
+{
+    if (is_regular(x1) == false || is_regular(x2) == false)
+        return mant_exp{x1.m_mant / x2.m_mant, 0};
+
+    return make_mant_exp(x1.m_mant / x2.m_mant, x1.m_exp - x2.m_exp);
+};
+
+inline bool operator<(const mant_exp& x1, const mant_exp& x2)
+{
+    if (std::isnan(x1.m_mant) || std::isnan(x2.m_mant))
+        return false;
+
+    int s1              = x1.m_mant > 0.0 ? 1 : (x1.m_mant < 0.0 ? -1 : 0);
+    int s2              = x2.m_mant > 0.0 ? 1 : (x2.m_mant < 0.0 ? -1 : 0);
+
+    if (s1 != s2)
+        return s1 < s2;
+
+    if (s1 == 0)
+        return false;
+
+    // |m_mant| < 1 for finite numbers
+    if (std::isfinite(x1.m_mant) == false || std::isfinite(x2.m_mant) == false)
+        return x1.m_mant < x2.m_mant;
+
+    if (x1.m_exp != x2.m_exp)
+        return s1 > 0 ? x1.m_exp < x2.m_exp : x1.m_exp > x2.m_exp;
+
+    return x1.m_mant < x2.m_mant;
+};
+
+inline mant_exp exp(const mant_exp& x)
+{
+    if (is_regular(x) == false)
+        return make_mant_exp(std::exp(x.m_mant), 0);
+
+    // |x| >= 2^62 overflows exponent of the result
+    if (x.m_exp > 62)
+        return make_mant_exp(x.m_mant > 0.0 ? std::numeric_limits<double>::infinity() 
+                                            : 0.0, 0);
+
+    // exp(x) = 2^t = 2^f * 2^k, where k = floor(t)
+    double t            = value(x) * 1.4426950408889634;
+    double k            = std::floor(t);
+
+    return make_mant_exp(std::exp2(t - k), int64_t(k));
+};
+
+inline mant_exp log_abs(const mant_exp& x)
+{
+    if (is_regular(x) == false)
+        return make_mant_exp(std::log(std::fabs(x.m_mant)), 0);
+
+    double val          = std::log(std::fabs(x.m_mant)) 
+                        + double(x.m_exp) * 0.69314718055994531;
+    return make_mant_exp(val, 0);
+};
+
+// |x|^y
+inline mant_exp pow_abs(const mant_exp& x, const mant_exp& y)
+{
+    return exp(y * log_abs(x));
+};
+
+}};
\ No newline at end of file
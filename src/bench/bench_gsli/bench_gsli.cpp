@@ -0,0 +1,914 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "bench_gsli.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+
+namespace sli { namespace bench
+{
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+// always zero, but unknown to the compiler; used to make next operands
+// depend on the result in latency mode
+static volatile uint64_t g_zero_mask    = 0;
+
+// sink preventing elimination of benchmarked code
+static volatile uint64_t g_sink         = 0;
+
+static uint64_t dep_bits(const gsli_double& x)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &x.get_internal_rep(), sizeof(bits));
+    return bits;
+};
+
+static uint64_t dep_bits(bool x)
+{
+    return x == true ? 1 : 0;
+};
+
+// two-sided 95% quantile of t distribution with dof degrees of freedom
+static double t_quantile_95(int dof)
+{
+    static const double table[] = 
+        {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+          2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+          2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+    if (dof <= 0)
+        return 0.0;
+
+    if (dof <= 30)
+        return table[dof - 1];
+
+    return 1.960;
+};
+
+gsli_double random_operand(int level, std::mt19937_64& gen)
+{
+    using config_type   = gsli_double::config_type;
+
+    std::uniform_real_distribution<double> unif(0.0, 1.0);
+
+    bool sign           = (gen() & 1) != 0;
+
+    if (level == 0)
+    {
+        // level 0 value with exponent in [-700, 700]
+        double val      = std::ldexp(1.0 + unif(gen), int(gen() % 1401) - 700);
+        return gsli_double(sign ? -val : val);
+    };
+
+    // level k index in (min_index_1, max_index_1]
+    double ind          = std::ldexp(1.0 + unif(gen), 
+                                     int(gen() % config_type::max_index_exp_1));
+    return gsli_double(level, sign ? -ind : ind);
+};
+
+void sample_stats(const std::vector<double>& samples, double& mean, double& stddev,
+                  double& ci95)
+{
+    int reps            = int(samples.size());
+
+    mean                = 0.0;
+
+    for (double s : samples)
+        mean            += s;
+
+    mean                = reps > 0 ? mean / reps : 0.0;
+
+    double var          = 0.0;
+
+    for (double s : samples)
+        var             += (s - mean) * (s - mean);
+
+    stddev              = reps > 1 ? std::sqrt(var / (reps - 1)) : 0.0;
+    ci95                = reps > 0 ? t_quantile_95(reps - 1) * stddev / std::sqrt(double(reps))
+                                   : 0.0;
+};
+
+static std::string json_escape(const std::string& str)
+{
+    std::string res;
+
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            res.push_back('\\');
+
+        res.push_back(c);
+    };
+
+    return res;
+};
+
+// split a line of csv file; fields are not quoted
+static std::vector<std::string> split_csv(const std::string& line)
+{
+    std::vector<std::string> ret;
+    std::string field;
+    std::istringstream is(line);
+
+    while (std::getline(is, field, ','))
+    {
+        // remove carriage return left by files with windows line endings
+        if (field.empty() == false && field.back() == '\r')
+            field.pop_back();
+
+        ret.push_back(field);
+    };
+
+    if (line.empty() == false && line.back() == ',')
+        ret.push_back(std::string());
+
+    return ret;
+};
+
+//----------------------------------------------------------------------
+//                        operations
+//----------------------------------------------------------------------
+struct op_plus
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x + y; };
+};
+
+struct op_minus
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x - y; };
+};
+
+struct op_mult
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x * y; };
+};
+
+struct op_div
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x / y; };
+};
+
+struct op_pow
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return pow_abs(x, y); };
+};
+
+struct op_cmp_lt
+{
+    bool operator()(const gsli_double& x, const gsli_double& y) const
+    { return x < y; };
+};
+
+struct op_cmp_eq
+{
+    bool operator()(const gsli_double& x, const gsli_double& y) const
+    { return x == y; };
+};
+
+struct op_inv
+{
+    gsli_double operator()(const gsli_double& x, long) const
+    { return inv(x); };
+};
+
+struct op_exp
+{
+    gsli_double operator()(const gsli_double& x, long) const
+    { return exp(x); };
+};
+
+struct op_log
+{
+    gsli_double operator()(const gsli_double& x, long) const
+    { return log_abs(x); };
+};
+
+struct op_pow_int
+{
+    gsli_double operator()(const gsli_double& x, long k) const
+    { return pow_int(x, k); };
+};
+
+// formatting to text with to_chars and with operator<< at precision
+// giving round-trip output; result depends on the written text
+struct op_to_chars
+{
+    bool operator()(const gsli_double& x, long) const
+    {
+        char buf[chars_max_length];
+        to_chars(buf, buf + chars_max_length, x);
+        return buf[0] == '-';
+    };
+};
+
+struct op_ostream
+{
+    // stream buffer writing to a fixed array, used to avoid allocations
+    // not made by operator<<
+    struct array_buf : std::streambuf
+    {
+        char    m_buf[64];
+
+        void reset()    { setp(m_buf, m_buf + sizeof(m_buf)); };
+    };
+
+    bool operator()(const gsli_double& x, long) const
+    {
+        static thread_local array_buf buf;
+        static thread_local std::ostream os(&buf);
+
+        buf.reset();
+        os << std::setprecision(17) << x;
+        return buf.m_buf[0] == '-';
+    };
+};
+
+struct op_to_chars_tower
+{
+    bool operator()(const gsli_double& x, long) const
+    {
+        char buf[chars_tower_max_length];
+        to_chars_tower(buf, buf + chars_tower_max_length, x, 6);
+        return buf[0] == '-';
+    };
+};
+
+// parsing with from_chars and with operator>>; text is written by
+// to_chars, therefore times include time of to_chars
+struct op_from_chars
+{
+    gsli_double operator()(const gsli_double& x, long) const
+    {
+        char buf[chars_max_length];
+        to_chars_result res = to_chars(buf, buf + chars_max_length, x);
+
+        gsli_double ret;
+        from_chars(buf, res.ptr, ret);
+        return ret;
+    };
+};
+
+struct op_istream
+{
+    // stream buffer reading from a fixed array
+    struct array_buf : std::streambuf
+    {
+        char    m_buf[chars_max_length];
+
+        void reset(char* last)  { setg(m_buf, m_buf, last); };
+    };
+
+    gsli_double operator()(const gsli_double& x, long) const
+    {
+        static thread_local array_buf buf;
+        static thread_local std::istream is(&buf);
+
+        to_chars_result res = to_chars(buf.m_buf, buf.m_buf + chars_max_length, x);
+        buf.reset(res.ptr);
+        is.clear();
+
+        gsli_double ret;
+        is >> ret;
+        return ret;
+    };
+};
+
+//----------------------------------------------------------------------
+//                        bench_options
+//----------------------------------------------------------------------
+bench_options::bench_options()
+    : m_latency(true), m_throughput(true), m_size(1000), m_reps(10)
+    , m_min_time_ms(0.5), m_seed(1), m_acc_size(200), m_hw_counters(false)
+    , m_stream_max_mb(512), m_threads(std::max(int(std::thread::hardware_concurrency()), 1))
+{};
+
+//----------------------------------------------------------------------
+//                        bench_gsli
+//----------------------------------------------------------------------
+bench_gsli::bench_gsli(const bench_options& opts)
+    : m_opts(opts)
+{
+    using config_type   = gsli_double::config_type;
+
+    for (int lev = -config_type::max_level; lev <= config_type::max_level; ++lev)
+    {
+        std::ostringstream name;
+
+        if (lev == 0)
+            name << "L0";
+        else
+            name << "L" << std::showpos << lev;
+
+        m_classes.push_back(operand_class{name.str(), lev, false});
+    };
+
+    m_classes.push_back(operand_class{"special", 0, true});
+
+    m_ops.push_back(operation{"plus", false});
+    m_ops.push_back(operation{"minus", false});
+    m_ops.push_back(operation{"mult", false});
+    m_ops.push_back(operation{"div", false});
+    m_ops.push_back(operation{"pow_abs", false});
+    m_ops.push_back(operation{"cmp_lt", false});
+    m_ops.push_back(operation{"cmp_eq", false});
+    m_ops.push_back(operation{"inv", true});
+    m_ops.push_back(operation{"exp", true});
+    m_ops.push_back(operation{"log_abs", true});
+    m_ops.push_back(operation{"pow_int", true});
+    m_ops.push_back(operation{"to_chars", true});
+    m_ops.push_back(operation{"ostream", true});
+    m_ops.push_back(operation{"to_chars_tower", true});
+    m_ops.push_back(operation{"from_chars", true});
+    m_ops.push_back(operation{"istream", true});
+
+    if (m_opts.m_hw_counters == true)
+    {
+        m_counters.reset(new hw_counters());
+
+        if (m_counters->is_available() == false)
+            m_counters.reset();
+    };
+};
+
+bool bench_gsli::has_hw_counters() const
+{
+    return m_counters != nullptr;
+};
+
+std::string bench_gsli::make_name(const operation& op, const operand_class* c1,
+                                  const operand_class* c2, bench_mode mode)
+{
+    std::string name    = op.m_name + "/" + c1->m_name;
+
+    if (c2 != nullptr)
+        name            += "/" + c2->m_name;
+
+    if (mode == bench_mode::latency)
+        name            += "/latency";
+    else
+        name            += "/throughput";
+
+    return name;
+};
+
+bool bench_gsli::selected(const std::string& name) const
+{
+    if (m_opts.m_filters.empty() == true)
+        return true;
+
+    for (const std::string& filter : m_opts.m_filters)
+    {
+        if (name.find(filter) != std::string::npos)
+            return true;
+    };
+
+    return false;
+};
+
+std::vector<std::string> bench_gsli::list() const
+{
+    std::vector<std::string> res;
+
+    for (const operation& op : m_ops)
+    for (const operand_class& c1 : m_classes)
+    for (size_t j = 0; j < (op.m_unary ? 1 : m_classes.size()); ++j)
+    for (int k = 0; k < 2; ++k)
+    {
+        bench_mode mode = bench_mode(k);
+
+        if (mode == bench_mode::latency && m_opts.m_latency == false)
+            continue;
+        if (mode == bench_mode::throughput && m_opts.m_throughput == false)
+            continue;
+
+        const operand_class* c2 = op.m_unary ? nullptr : &m_classes[j];
+        std::string name        = make_name(op, &c1, c2, mode);
+
+        if (selected(name) == true)
+            res.push_back(name);
+    };
+
+    return res;
+};
+
+std::vector<bench_result> bench_gsli::run(std::ostream* progress) const
+{
+    std::vector<bench_result> res;
+
+    for (const operation& op : m_ops)
+    for (const operand_class& c1 : m_classes)
+    for (size_t j = 0; j < (op.m_unary ? 1 : m_classes.size()); ++j)
+    for (int k = 0; k < 2; ++k)
+    {
+        bench_mode mode = bench_mode(k);
+
+        if (mode == bench_mode::latency && m_opts.m_latency == false)
+            continue;
+        if (mode == bench_mode::throughput && m_opts.m_throughput == false)
+            continue;
+
+        const operand_class* c2 = op.m_unary ? nullptr : &m_classes[j];
+
+        if (selected(make_name(op, &c1, c2, mode)) == false)
+            continue;
+
+        res.push_back(run_one(op, c1, c2, mode));
+
+        if (progress != nullptr)
+            write_text(*progress, std::vector<bench_result>(1, res.back()));
+    };
+
+    return res;
+};
+
+void bench_gsli::make_operands(const operand_class& c, uint64_t seed, 
+                               std::vector<gsli_double>& vec) const
+{
+    std::mt19937_64 gen(seed);
+
+    vec.resize(m_opts.m_size);
+
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        if (c.m_special == true)
+        {
+            bool sign   = (gen() & 1) != 0;
+
+            switch (gen() % 3)
+            {
+                case 0:     vec[i] = gsli_double::make_zero(); break;
+                case 1:     vec[i] = gsli_double::make_infinity(sign); break;
+                default:    vec[i] = gsli_double::make_nan(); break;
+            };
+        }
+        else
+        {
+            vec[i]      = random_operand(c.m_level, gen);
+        };
+    };
+};
+
+bench_result bench_gsli::run_one(const operation& op, const operand_class& c1, 
+                                 const operand_class* c2, bench_mode mode) const
+{
+    std::vector<gsli_double> x, y;
+    std::vector<long> k(m_opts.m_size);
+
+    make_operands(c1, m_opts.m_seed, x);
+
+    if (c2 != nullptr)
+        make_operands(*c2, m_opts.m_seed + 1, y);
+
+    std::mt19937_64 gen(m_opts.m_seed + 2);
+
+    for (size_t i = 0; i < k.size(); ++i)
+        k[i]            = long(gen() % 11) - 5;
+
+    bench_result res;
+
+    if (op.m_name == "plus")            res = measure(op_plus(), x, y, mode);
+    else if (op.m_name == "minus")      res = measure(op_minus(), x, y, mode);
+    else if (op.m_name == "mult")       res = measure(op_mult(), x, y, mode);
+    else if (op.m_name == "div")        res = measure(op_div(), x, y, mode);
+    else if (op.m_name == "pow_abs")    res = measure(op_pow(), x, y, mode);
+    else if (op.m_name == "cmp_lt")     res = measure(op_cmp_lt(), x, y, mode);
+    else if (op.m_name == "cmp_eq")     res = measure(op_cmp_eq(), x, y, mode);
+    else if (op.m_name == "inv")        res = measure(op_inv(), x, k, mode);
+    else if (op.m_name == "exp")        res = measure(op_exp(), x, k, mode);
+    else if (op.m_name == "log_abs")    res = measure(op_log(), x, k, mode);
+    else if (op.m_name == "to_chars")   res = measure(op_to_chars(), x, k, mode);
+    else if (op.m_name == "ostream")    res = measure(op_ostream(), x, k, mode);
+    else if (op.m_name == "to_chars_tower") 
+                                        res = measure(op_to_chars_tower(), x, k, mode);
+    else if (op.m_name == "from_chars") res = measure(op_from_chars(), x, k, mode);
+    else if (op.m_name == "istream")    res = measure(op_istream(), x, k, mode);
+    else                                res = measure(op_pow_int(), x, k, mode);
+
+    res.m_name          = make_name(op, &c1, c2, mode);
+    res.m_op            = op.m_name;
+    res.m_class_1       = c1.m_name;
+    res.m_class_2       = c2 != nullptr ? c2->m_name : "";
+    res.m_mode          = mode == bench_mode::latency ? "latency" : "throughput";
+
+    return res;
+};
+
+template<class Func, class T2>
+bench_result bench_gsli::measure(const Func& f, const std::vector<gsli_double>& x, 
+                                 const std::vector<T2>& y, bench_mode mode) const
+{
+    using clock         = std::chrono::steady_clock;
+    using result_type   = decltype(f(x[0], y[0]));
+
+    size_t n            = x.size();
+
+    std::vector<result_type> out(n);
+
+    // evaluate n_iter blocks and return elapsed time in nanoseconds
+    auto run_block      = [&](uint64_t n_iter) -> double
+    {
+        uint64_t mask           = g_zero_mask;
+        clock::time_point start = clock::now();
+
+        if (mode == bench_mode::throughput)
+        {
+            for (uint64_t it = 0; it < n_iter; ++it)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    out[i]      = f(x[i], y[i]);
+            };
+
+            g_sink              = dep_bits(out[n - 1]);
+        }
+        else
+        {
+            result_type r       = result_type();
+            size_t pos          = 0;
+
+            for (uint64_t it = 0; it < n_iter; ++it)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    r           = f(x[pos], y[pos]);
+                    pos         = i + 1 + size_t(dep_bits(r) & mask);
+                    pos         = pos < n ? pos : pos - n;
+                };
+            };
+
+            g_sink              = dep_bits(r);
+        };
+
+        clock::time_point stop  = clock::now();
+
+        return double(std::chrono::duration_cast<std::chrono::nanoseconds>
+                            (stop - start).count());
+    };
+
+    // calibrate number of blocks in a sample
+    double min_time     = m_opts.m_min_time_ms * 1.0e6;
+    uint64_t n_iter     = 1;
+
+    while (run_block(n_iter) < min_time && n_iter < (uint64_t(1) << 30))
+        n_iter          *= 2;
+
+    // measure
+    int reps            = std::max(m_opts.m_reps, 1);
+
+    std::vector<double> samples(reps);
+
+    if (m_counters != nullptr)
+        m_counters->start();
+
+    for (int i = 0; i < reps; ++i)
+        samples[i]      = run_block(n_iter) / double(n_iter * n);
+
+    if (m_counters != nullptr)
+        m_counters->stop();
+
+    bench_result res;
+
+    sample_stats(samples, res.m_ns_mean, res.m_ns_stddev, res.m_ns_ci95);
+
+    double mean             = res.m_ns_mean;
+
+    res.m_ops_per_sample    = n_iter * n;
+    res.m_samples           = reps;
+    res.m_ops_per_sec       = mean > 0.0 ? 1.0e9 / mean : 0.0;
+    res.m_hw_available      = m_counters != nullptr;
+    res.m_ipc               = -1.0;
+
+    double total_ops        = double(reps) * double(n_iter * n);
+
+    for (int i = 0; i < hw_counters::count; ++i)
+    {
+        hw_counters::counter c  = hw_counters::counter(i);
+
+        if (m_counters != nullptr && m_counters->is_available(c) == true)
+            res.m_hw[i]     = double(m_counters->get(c)) / total_ops;
+        else
+            res.m_hw[i]     = -1.0;
+    };
+
+    double cycles           = res.m_hw[hw_counters::cycles];
+    double instr            = res.m_hw[hw_counters::instructions];
+
+    if (cycles > 0.0 && instr >= 0.0)
+        res.m_ipc           = instr / cycles;
+
+    return res;
+};
+
+//----------------------------------------------------------------------
+//                        output
+//----------------------------------------------------------------------
+void bench_gsli::write_text(std::ostream& os, const std::vector<bench_result>& res)
+{
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    for (const bench_result& r : res)
+    {
+        os << std::left << std::setw(36) << r.m_name << std::right << std::fixed
+           << std::setprecision(2) << std::setw(10) << r.m_ns_mean << " ns/op +- "
+           << std::setw(6) << r.m_ns_ci95 << std::setprecision(0) 
+           << std::setw(14) << r.m_ops_per_sec << " ops/s";
+
+        if (r.m_hw_available == true)
+        {
+            os << std::setprecision(1);
+
+            if (r.m_hw[hw_counters::cycles] >= 0.0)
+                os << std::setw(8) << r.m_hw[hw_counters::cycles] << " cyc/op";
+
+            if (r.m_ipc >= 0.0)
+                os << std::setprecision(2) << std::setw(7) << r.m_ipc << " ipc";
+
+            if (r.m_hw[hw_counters::branch_misses] >= 0.0)
+                os << std::setprecision(3) << std::setw(8) 
+                   << r.m_hw[hw_counters::branch_misses] << " brmiss/op";
+        };
+
+        os << "\n";
+    };
+
+    os.flags(flags);
+    os.precision(prec);
+};
+
+void bench_gsli::write_csv(std::ostream& os, const std::vector<bench_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << "name,op,class_1,class_2,mode,ops_per_sample,samples,ns_mean,"
+       << "ns_stddev,ns_ci95,ops_per_sec";
+
+    for (int i = 0; i < hw_counters::count; ++i)
+        os << "," << hw_counters::name(hw_counters::counter(i));
+
+    os << ",ipc" << "\n";
+
+    os << std::setprecision(17);
+
+    for (const bench_result& r : res)
+    {
+        os << r.m_name << "," << r.m_op << "," << r.m_class_1 << "," << r.m_class_2 
+           << "," << r.m_mode << "," << r.m_ops_per_sample << "," << r.m_samples 
+           << "," << r.m_ns_mean << "," << r.m_ns_stddev << "," << r.m_ns_ci95 
+           << "," << r.m_ops_per_sec;
+
+        // unavailable counters are left empty
+        for (int j = 0; j < hw_counters::count; ++j)
+        {
+            os << ",";
+
+            if (r.m_hw_available == true && r.m_hw[j] >= 0.0)
+                os << r.m_hw[j];
+        };
+
+        os << ",";
+
+        if (r.m_hw_available == true && r.m_ipc >= 0.0)
+            os << r.m_ipc;
+
+        os << "\n";
+    };
+
+    os.precision(prec);
+};
+
+void bench_gsli::write_json(std::ostream& os, const std::vector<bench_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << std::setprecision(17);
+    os << "{" << "\n" << "  \"benchmarks\": [" << "\n";
+
+    for (size_t i = 0; i < res.size(); ++i)
+    {
+        const bench_result& r   = res[i];
+
+        os << "    {"
+           << "\"name\": \"" << json_escape(r.m_name) << "\", "
+           << "\"op\": \"" << json_escape(r.m_op) << "\", "
+           << "\"class_1\": \"" << json_escape(r.m_class_1) << "\", "
+           << "\"class_2\": \"" << json_escape(r.m_class_2) << "\", "
+           << "\"mode\": \"" << r.m_mode << "\", "
+           << "\"ops_per_sample\": " << r.m_ops_per_sample << ", "
+           << "\"samples\": " << r.m_samples << ", "
+           << "\"ns_mean\": " << r.m_ns_mean << ", "
+           << "\"ns_stddev\": " << r.m_ns_stddev << ", "
+           << "\"ns_ci95\": " << r.m_ns_ci95 << ", "
+           << "\"ops_per_sec\": " << r.m_ops_per_sec;
+
+        // hardware counters per operation; unavailable counters are null
+        if (r.m_hw_available == true)
+        {
+            os << ", \"counters\": {";
+
+            for (int j = 0; j < hw_counters::count; ++j)
+            {
+                os << "\"" << hw_counters::name(hw_counters::counter(j)) << "\": ";
+
+                if (r.m_hw[j] >= 0.0)
+                    os << r.m_hw[j];
+                else
+                    os << "null";
+
+                os << ", ";
+            };
+
+            os << "\"ipc\": ";
+
+            if (r.m_ipc >= 0.0)
+                os << r.m_ipc;
+            else
+                os << "null";
+
+            os << "}";
+        };
+
+        os << "}";
+
+        if (i + 1 < res.size())
+            os << ",";
+
+        os << "\n";
+    };
+
+    os << "  ]" << "\n" << "}" << "\n";
+    os.precision(prec);
+};
+
+bool bench_gsli::read_csv(const std::string& file, std::vector<bench_result>& res)
+{
+    std::ifstream is(file);
+
+    if (!is)
+        return false;
+
+    std::string line;
+
+    if (!std::getline(is, line))
+        return false;
+
+    // columns are found by names in the header
+    std::vector<std::string> header = split_csv(line);
+    std::map<std::string, size_t> cols;
+
+    for (size_t i = 0; i < header.size(); ++i)
+        cols[header[i]]     = i;
+
+    const char* required[]  = {"name", "op", "class_1", "class_2", "mode", 
+                                "samples", "ns_mean", "ns_ci95"};
+
+    for (const char* col : required)
+    {
+        if (cols.find(col) == cols.end())
+            return false;
+    };
+
+    while (std::getline(is, line))
+    {
+        std::vector<std::string> fields = split_csv(line);
+
+        if (fields.size() != header.size())
+            continue;
+
+        bench_result r;
+        r.m_name            = fields[cols["name"]];
+        r.m_op              = fields[cols["op"]];
+        r.m_class_1         = fields[cols["class_1"]];
+        r.m_class_2         = fields[cols["class_2"]];
+        r.m_mode            = fields[cols["mode"]];
+        r.m_ops_per_sample  = 0;
+        r.m_samples         = std::atoi(fields[cols["samples"]].c_str());
+        r.m_ns_mean         = std::atof(fields[cols["ns_mean"]].c_str());
+        r.m_ns_stddev       = 0.0;
+        r.m_ns_ci95         = std::atof(fields[cols["ns_ci95"]].c_str());
+        r.m_ops_per_sec     = r.m_ns_mean > 0.0 ? 1.0e9 / r.m_ns_mean : 0.0;
+        r.m_hw_available    = false;
+        r.m_ipc             = -1.0;
+
+        for (int j = 0; j < hw_counters::count; ++j)
+            r.m_hw[j]       = -1.0;
+
+        res.push_back(r);
+    };
+
+    return true;
+};
+
+void bench_gsli::write_diff(std::ostream& os, const std::vector<bench_result>& before,
+                            const std::vector<bench_result>& after)
+{
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    std::map<std::string, const bench_result*> base;
+
+    for (const bench_result& r : before)
+        base[r.m_name]  = &r;
+
+    // sum of log speedups and number of benchmarks for every operation;
+    // operations are reported in order of the first occurrence
+    std::vector<std::string> ops;
+    std::map<std::string, std::pair<double, int>> op_stats;
+
+    os << std::left << std::setw(36) << "benchmark" << std::right
+       << std::setw(14) << "before ns/op" << std::setw(14) << "after ns/op" 
+       << std::setw(10) << "speedup" << "\n";
+
+    os << std::fixed;
+
+    for (const bench_result& r : after)
+    {
+        auto pos        = base.find(r.m_name);
+
+        if (pos == base.end())
+            continue;
+
+        double t0       = pos->second->m_ns_mean;
+        double t1       = r.m_ns_mean;
+
+        if (!(t0 > 0.0) || !(t1 > 0.0))
+            continue;
+
+        double speedup  = t0 / t1;
+
+        os << std::left << std::setw(36) << r.m_name << std::right 
+           << std::setprecision(2) << std::setw(14) << t0 << std::setw(14) << t1 
+           << std::setprecision(3) << std::setw(10) << speedup << "\n";
+
+        if (op_stats.find(r.m_op) == op_stats.end())
+            ops.push_back(r.m_op);
+
+        std::pair<double, int>& st  = op_stats[r.m_op];
+        st.first        += std::log(speedup);
+        st.second       += 1;
+    };
+
+    os << "\n" << std::left << std::setw(36) << "operation" << std::right
+       << std::setw(14) << "benchmarks" << std::setw(24) << "geomean speedup" << "\n";
+
+    double log_sum      = 0.0;
+    int count           = 0;
+
+    for (const std::string& op : ops)
+    {
+        const std::pair<double, int>& st    = op_stats[op];
+
+        os << std::left << std::setw(36) << op << std::right << std::setw(14) 
+           << st.second << std::setprecision(3) << std::setw(24) 
+           << std::exp(st.first / st.second) << "\n";
+
+        log_sum         += st.first;
+        count           += st.second;
+    };
+
+    if (count > 0)
+    {
+        os << std::left << std::setw(36) << "all" << std::right << std::setw(14) 
+           << count << std::setprecision(3) << std::setw(24) 
+           << std::exp(log_sum / count) << "\n";
+    };
+
+    os.flags(flags);
+    os.precision(prec);
+};
+
+}};
\ No newline at end of file
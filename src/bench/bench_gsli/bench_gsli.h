@@ -0,0 +1,207 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli.h"
+#include "hw_counters.h"
+
+#include <iosfwd>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace sli { namespace bench
+{
+
+// benchmark mode
+enum class bench_mode : int
+{
+    latency     = 0,    // dependent chain; next operands depend on result
+    throughput,         // independent evaluations
+};
+
+// benchmark options
+struct bench_options
+{
+    // substrings of benchmark names; a benchmark is run if its name
+    // contains any of them, all benchmarks are run if empty
+    std::vector<std::string>    m_filters;
+
+    // run latency and throughput benchmarks
+    bool                        m_latency;
+    bool                        m_throughput;
+
+    // number of operands in a block
+    size_t                      m_size;
+
+    // number of measured samples
+    int                         m_reps;
+
+    // minimum duration of a sample in milliseconds
+    double                      m_min_time_ms;
+
+    // random seed
+    uint64_t                    m_seed;
+
+    // number of operands checked for accuracy by comparative benchmarks
+    size_t                      m_acc_size;
+
+    // collect hardware performance counters
+    bool                        m_hw_counters;
+
+    // maximum total size of arrays used by streaming benchmarks in MiB
+    size_t                      m_stream_max_mb;
+
+    // maximum number of threads used by streaming benchmarks
+    int                         m_threads;
+
+    // set default options
+    bench_options();
+};
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+// return a random regular number on given level with random sign; level 0
+// numbers have exponents in [-700, 700]; level k numbers have indices
+// 2^u * (1 + v), where u is a uniform integer in [0, max_index_exp_1)
+// and v is uniform in [0, 1)
+gsli_double         random_operand(int level, std::mt19937_64& gen);
+
+// compute mean, standard deviation and half width of 95% confidence
+// interval of the mean of samples
+void                sample_stats(const std::vector<double>& samples, double& mean,
+                        double& stddev, double& ci95);
+
+// result of a single benchmark
+struct bench_result
+{
+    std::string     m_name;
+    std::string     m_op;
+    std::string     m_class_1;
+    std::string     m_class_2;
+    std::string     m_mode;
+
+    // number of evaluations in a sample
+    uint64_t        m_ops_per_sample;
+
+    // number of samples
+    int             m_samples;
+
+    // mean, standard deviation and half width of 95% confidence interval
+    // of time per operation in nanoseconds
+    double          m_ns_mean;
+    double          m_ns_stddev;
+    double          m_ns_ci95;
+
+    // operations per second
+    double          m_ops_per_sec;
+
+    // true if hardware counters were collected
+    bool            m_hw_available;
+
+    // hardware counters per operation; -1 if a counter is not available
+    double          m_hw[hw_counters::count];
+
+    // instructions per cycle; -1 if not available
+    double          m_ipc;
+};
+
+// benchmark suite; every operation is measured for every pair of operand
+// classes (level 0, levels -max_level...max_level, special values) in
+// latency and throughput modes
+class bench_gsli
+{
+    public:
+        explicit bench_gsli(const bench_options& opts);
+
+        // return names of all benchmarks selected by filters
+        std::vector<std::string>    list() const;
+
+        // run selected benchmarks; if progress is not null, then results
+        // are printed as text while running
+        std::vector<bench_result>   run(std::ostream* progress) const;
+
+        // return true if hardware counters are collected
+        bool                        has_hw_counters() const;
+
+    public:
+        // write results
+        static void     write_text(std::ostream& os, const std::vector<bench_result>& res);
+        static void     write_csv(std::ostream& os, const std::vector<bench_result>& res);
+        static void     write_json(std::ostream& os, const std::vector<bench_result>& res);
+
+        // read results written by write_csv; only name, op, class, mode and
+        // timing columns are restored; return false if the file cannot be
+        // opened or has unknown format
+        static bool     read_csv(const std::string& file, std::vector<bench_result>& res);
+
+        // compare two sets of results (e.g. measured before and after a
+        // profile-guided build); for every benchmark present in both sets
+        // the time per operation and speedup are printed, followed by
+        // geometric mean of speedups for every operation
+        static void     write_diff(std::ostream& os, const std::vector<bench_result>& before,
+                            const std::vector<bench_result>& after);
+
+    private:
+        // class of operands
+        struct operand_class
+        {
+            std::string m_name;
+            int         m_level;
+            bool        m_special;
+        };
+
+        // benchmarked operation
+        struct operation
+        {
+            std::string m_name;
+            bool        m_unary;
+        };
+
+    private:
+        bench_options               m_opts;
+        std::vector<operand_class>  m_classes;
+        std::vector<operation>      m_ops;
+
+        // hardware counters; null if not requested or not available
+        std::unique_ptr<hw_counters>    m_counters;
+
+    private:
+        bool            selected(const std::string& name) const;
+
+        static std::string  make_name(const operation& op, const operand_class* c1,
+                                const operand_class* c2, bench_mode mode);
+
+        void            make_operands(const operand_class& c, uint64_t seed, 
+                            std::vector<gsli_double>& vec) const;
+
+        bench_result    run_one(const operation& op, const operand_class& c1, 
+                            const operand_class* c2, bench_mode mode) const;
+
+        template<class Func, class T2>
+        bench_result    measure(const Func& f, const std::vector<gsli_double>& x, 
+                            const std::vector<T2>& y, bench_mode mode) const;
+};
+
+}};
\ No newline at end of file
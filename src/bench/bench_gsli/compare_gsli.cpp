@@ -0,0 +1,989 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "compare_gsli.h"
+#include "alt_types.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+#if defined(__has_include)
+    #if __has_include(<boost/multiprecision/cpp_bin_float.hpp>)
+        #define GSLI_BENCH_HAS_BOOST
+    #endif
+#endif
+
+#ifdef GSLI_BENCH_HAS_BOOST
+    #include <boost/multiprecision/cpp_bin_float.hpp>
+#endif
+
+namespace sli { namespace bench
+{
+
+//----------------------------------------------------------------------
+//                        benchmark names
+//----------------------------------------------------------------------
+static const char* g_op_names[]     = {"plus", "mult", "div", "exp", "log_abs", 
+                                       "pow_abs", "cmp_lt", "sum", "prod"};
+static const char* g_type_names[]   = {"gsli", "log_double", "mant_exp", "bin_float"};
+static const char* g_dist_names[]   = {"L-2", "L-1", "L0", "L+1", "L+2", "mixed"};
+
+static const int n_ops              = 9;
+static const int n_types            = 4;
+static const int n_dists            = 6;
+
+static std::string make_name(int op, int type, int dist)
+{
+    return std::string(g_op_names[op]) + "/" + g_type_names[type] + "/" 
+            + g_dist_names[dist];
+};
+
+static std::string json_escape(const std::string& str)
+{
+    std::string res;
+
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+            res.push_back('\\');
+
+        res.push_back(c);
+    };
+
+    return res;
+};
+
+#ifdef GSLI_BENCH_HAS_BOOST
+
+namespace mp = boost::multiprecision;
+
+// compared type: 53-bit mantissa, 64-bit exponent
+using bin_float     = mp::number<mp::cpp_bin_float<53, mp::digit_base_2, void, int64_t>, 
+                                 mp::et_off>;
+
+// reference type: 40 decimal digits, 64-bit exponent
+using hp_float      = mp::number<mp::cpp_bin_float<40, mp::digit_base_10, void, int64_t>, 
+                                 mp::et_off>;
+
+inline bin_float log_abs(const bin_float& x)
+{
+    return log(abs(x));
+};
+
+inline bin_float pow_abs(const bin_float& x, const bin_float& y)
+{
+    return pow(abs(x), y);
+};
+
+//----------------------------------------------------------------------
+//                        reference values
+//----------------------------------------------------------------------
+enum class ref_kind
+{
+    regular, zero, inf, nan
+};
+
+// value stored as sign and logarithm of absolute value
+struct ref_value
+{
+    ref_kind        m_kind;
+    bool            m_sign;
+    hp_float        m_log;
+};
+
+static ref_value make_ref(ref_kind kind, bool sign)
+{
+    return ref_value{kind, sign, hp_float(0)};
+};
+
+// build value from logarithm of absolute value; log = -Inf gives zero,
+// log = +Inf gives infinity
+static ref_value make_ref_log(const hp_float& log, bool sign)
+{
+    if (isnan(log))
+        return make_ref(ref_kind::nan, false);
+
+    if (isinf(log))
+        return make_ref(log > 0 ? ref_kind::inf : ref_kind::zero, sign);
+
+    return ref_value{ref_kind::regular, sign, log};
+};
+
+// build from signed value
+static ref_value make_ref_value(const hp_float& val)
+{
+    if (isnan(val))
+        return make_ref(ref_kind::nan, false);
+
+    if (val == 0)
+        return make_ref(ref_kind::zero, false);
+
+    return make_ref_log(log(abs(val)), val < 0);
+};
+
+// return signed value
+static hp_float ref_signed_value(const ref_value& x)
+{
+    hp_float val;
+
+    switch (x.m_kind)
+    {
+        case ref_kind::zero:    val = 0; break;
+        case ref_kind::inf:     val = std::numeric_limits<hp_float>::infinity(); break;
+        case ref_kind::nan:     return std::numeric_limits<hp_float>::quiet_NaN();
+        default:                val = exp(x.m_log); break;
+    };
+
+    return x.m_sign == true ? hp_float(-val) : val;
+};
+
+static ref_value ref_plus(const ref_value& x1, const ref_value& x2)
+{
+    if (x1.m_kind == ref_kind::nan || x2.m_kind == ref_kind::nan)
+        return make_ref(ref_kind::nan, false);
+
+    if (x1.m_kind == ref_kind::zero)
+        return x2;
+
+    if (x2.m_kind == ref_kind::zero)
+        return x1;
+
+    if (x1.m_kind == ref_kind::inf || x2.m_kind == ref_kind::inf)
+    {
+        if (x1.m_kind == x2.m_kind && x1.m_sign != x2.m_sign)
+            return make_ref(ref_kind::nan, false);
+
+        return x1.m_kind == ref_kind::inf ? x1 : x2;
+    };
+
+    // ensure |a| >= |b|
+    const ref_value& a  = x1.m_log >= x2.m_log ? x1 : x2;
+    const ref_value& b  = x1.m_log >= x2.m_log ? x2 : x1;
+
+    hp_float e          = exp(hp_float(b.m_log - a.m_log));
+
+    if (a.m_sign == b.m_sign)
+        return make_ref_log(a.m_log + log(hp_float(1 + e)), a.m_sign);
+
+    if (e == 1)
+        return make_ref(ref_kind::zero, false);
+
+    return make_ref_log(a.m_log + log(hp_float(1 - e)), a.m_sign);
+};
+
+static ref_value ref_mult(const ref_value& x1, const ref_value& x2)
+{
+    bool sign           = x1.m_sign != x2.m_sign;
+
+    if (x1.m_kind == ref_kind::nan || x2.m_kind == ref_kind::nan)
+        return make_ref(ref_kind::nan, false);
+
+    if (x1.m_kind == ref_kind::zero || x2.m_kind == ref_kind::zero)
+    {
+        if (x1.m_kind == ref_kind::inf || x2.m_kind == ref_kind::inf)
+            return make_ref(ref_kind::nan, false);
+
+        return make_ref(ref_kind::zero, sign);
+    };
+
+    if (x1.m_kind == ref_kind::inf || x2.m_kind == ref_kind::inf)
+        return make_ref(ref_kind::inf, sign);
+
+    return make_ref_log(x1.m_log + x2.m_log, sign);
+};
+
+static ref_value ref_div(const ref_value& x1, const ref_value& x2)
+{
+    bool sign           = x1.m_sign != x2.m_sign;
+
+    if (x1.m_kind == ref_kind::nan || x2.m_kind == ref_kind::nan)
+        return make_ref(ref_kind::nan, false);
+
+    if (x1.m_kind == x2.m_kind && x1.m_kind != ref_kind::regular)
+        return make_ref(ref_kind::nan, false);
+
+    if (x1.m_kind == ref_kind::zero || x2.m_kind == ref_kind::inf)
+        return make_ref(ref_kind::zero, sign);
+
+    if (x1.m_kind == ref_kind::inf || x2.m_kind == ref_kind::zero)
+        return make_ref(ref_kind::inf, sign);
+
+    return make_ref_log(x1.m_log - x2.m_log, sign);
+};
+
+static ref_value ref_exp(const ref_value& x, const ref_value&)
+{
+    // log of the result is equal to x
+    return make_ref_log(ref_signed_value(x), false);
+};
+
+static ref_value ref_log(const ref_value& x, const ref_value&)
+{
+    switch (x.m_kind)
+    {
+        case ref_kind::nan:     return make_ref(ref_kind::nan, false);
+        case ref_kind::zero:    return make_ref(ref_kind::inf, true);
+        case ref_kind::inf:     return make_ref(ref_kind::inf, false);
+        default:                return make_ref_value(x.m_log);
+    };
+};
+
+static ref_value ref_pow(const ref_value& x, const ref_value& y)
+{
+    ref_value none      = make_ref(ref_kind::zero, false);
+    return ref_exp(ref_mult(y, ref_log(x, none)), none);
+};
+
+static bool ref_less(const ref_value& x1, const ref_value& x2)
+{
+    if (x1.m_kind == ref_kind::nan || x2.m_kind == ref_kind::nan)
+        return false;
+
+    int s1              = x1.m_kind == ref_kind::zero ? 0 : (x1.m_sign ? -1 : 1);
+    int s2              = x2.m_kind == ref_kind::zero ? 0 : (x2.m_sign ? -1 : 1);
+
+    if (s1 != s2)
+        return s1 < s2;
+
+    if (s1 == 0)
+        return false;
+
+    hp_float inf        = std::numeric_limits<hp_float>::infinity();
+    hp_float l1         = x1.m_kind == ref_kind::inf ? inf : x1.m_log;
+    hp_float l2         = x2.m_kind == ref_kind::inf ? inf : x2.m_log;
+
+    return s1 > 0 ? l1 < l2 : l1 > l2;
+};
+
+//----------------------------------------------------------------------
+//                        conversions
+//----------------------------------------------------------------------
+static ref_value to_ref(const gsli_double& x)
+{
+    using config_type   = gsli_double::config_type;
+
+    if (is_nan(x) == true)
+        return make_ref(ref_kind::nan, false);
+
+    if (is_zero(x) == true)
+        return make_ref(ref_kind::zero, false);
+
+    if (is_inf(x) == true)
+        return make_ref(ref_kind::inf, is_negative(x));
+
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+
+    int level           = rep.level();
+
+    if (level == 0)
+        return make_ref_log(log(hp_float(rep.index())), rep.sign_index());
+
+    // log(phi(k, x)) = log(MAX_0) + psi(k - 1, x) - MIN_1
+    hp_float min_1      = hp_float(config_type::min_index_1);
+    hp_float max_1      = hp_float(config_type::max_index_1);
+    hp_float psi        = hp_float(rep.index());
+
+    for (int k = 1; k < std::abs(level); ++k)
+        psi             = max_1 * exp(hp_float(psi - min_1));
+
+    hp_float res        = log(hp_float(config_type::max_index_0)) + psi - min_1;
+
+    return make_ref_log(level > 0 ? res : hp_float(-res), rep.sign_index());
+};
+
+static ref_value to_ref(const log_double& x)
+{
+    return make_ref_log(hp_float(x.m_log), x.m_sign);
+};
+
+static ref_value to_ref(const mant_exp& x)
+{
+    if (is_regular(x) == false)
+        return make_ref_value(hp_float(x.m_mant));
+
+    hp_float res        = log(hp_float(std::fabs(x.m_mant))) 
+                        + hp_float(x.m_exp) * log(hp_float(2));
+
+    return make_ref_log(res, x.m_mant < 0.0);
+};
+
+static ref_value to_ref(const bin_float& x)
+{
+    if (isnan(x) || isinf(x) || x == 0)
+        return make_ref_value(hp_float(x));
+
+    return make_ref_log(log(hp_float(abs(x))), x < 0);
+};
+
+// decompose regular x into m * 2^e, where 0.5 <= m < 1; return false
+// if e is outside of [-2^62, 2^62]
+static bool ref_mant_exp(const ref_value& x, double& m, int64_t& e)
+{
+    static const hp_float max_exp   = hp_float(int64_t(1) << 62);
+
+    hp_float ln_2       = log(hp_float(2));
+    hp_float t          = x.m_log / ln_2;
+
+    if (abs(t) > max_exp)
+        return false;
+
+    hp_float k          = floor(t);
+
+    m                   = exp(hp_float((t - k) * ln_2)).convert_to<double>() / 2.0;
+    e                   = k.convert_to<int64_t>() + 1;
+    m                   = x.m_sign == true ? -m : m;
+
+    return true;
+};
+
+static void from_ref(const ref_value& x, log_double& res)
+{
+    switch (x.m_kind)
+    {
+        case ref_kind::nan:     res = make_log_double(std::nan("")); return;
+        case ref_kind::zero:    res = make_log_double(0.0); return;
+        case ref_kind::inf:     
+            res = make_log_double(std::numeric_limits<double>::infinity());
+            res.m_sign  = x.m_sign;
+            return;
+        default:
+            res = log_double{x.m_log.convert_to<double>(), x.m_sign};
+            return;
+    };
+};
+
+static void from_ref(const ref_value& x, mant_exp& res)
+{
+    double m;
+    int64_t e;
+
+    if (x.m_kind == ref_kind::regular && ref_mant_exp(x, m, e) == true)
+        res             = make_mant_exp(m, e);
+    else if (x.m_kind == ref_kind::regular)
+        res             = make_mant_exp(x.m_log > 0 ? (x.m_sign ? -1.0 : 1.0) 
+                                        * std::numeric_limits<double>::infinity() : 0.0, 0);
+    else
+        res             = make_mant_exp(ref_signed_value(x).convert_to<double>(), 0);
+};
+
+static void from_ref(const ref_value& x, bin_float& res)
+{
+    double m;
+    int64_t e;
+
+    if (x.m_kind == ref_kind::regular && ref_mant_exp(x, m, e) == true)
+        res             = ldexp(bin_float(m), static_cast<long long>(e));
+    else if (x.m_kind == ref_kind::regular)
+        res             = x.m_log > 0 ? bin_float(x.m_sign ? -1 : 1) 
+                                        * std::numeric_limits<bin_float>::infinity()
+                                      : bin_float(0);
+    else
+        res             = bin_float(ref_signed_value(x));
+};
+
+static void convert(const std::vector<gsli_double>& x, std::vector<gsli_double>& res)
+{
+    res                 = x;
+};
+
+template<class T>
+static void convert(const std::vector<gsli_double>& x, std::vector<T>& res)
+{
+    res.resize(x.size());
+
+    for (size_t i = 0; i < x.size(); ++i)
+        from_ref(to_ref(x[i]), res[i]);
+};
+
+//----------------------------------------------------------------------
+//                        operations
+//----------------------------------------------------------------------
+struct op_plus
+{
+    template<class T>
+    T operator()(const T& x, const T& y) const  { return x + y; };
+};
+
+struct op_mult
+{
+    template<class T>
+    T operator()(const T& x, const T& y) const  { return x * y; };
+};
+
+struct op_div
+{
+    template<class T>
+    T operator()(const T& x, const T& y) const  { return x / y; };
+};
+
+struct op_exp
+{
+    template<class T>
+    T operator()(const T& x, const T&) const    { return exp(x); };
+};
+
+struct op_log
+{
+    template<class T>
+    T operator()(const T& x, const T&) const    { return log_abs(x); };
+};
+
+struct op_pow
+{
+    template<class T>
+    T operator()(const T& x, const T& y) const  { return pow_abs(x, y); };
+};
+
+struct op_cmp
+{
+    template<class T>
+    bool operator()(const T& x, const T& y) const   { return x < y; };
+};
+
+//----------------------------------------------------------------------
+//                        measurement
+//----------------------------------------------------------------------
+// sink preventing elimination of benchmarked code
+static const void* volatile g_sink  = nullptr;
+
+template<class Func>
+static void time_block(const Func& run_block, size_t n, const bench_options& opts,
+                       compare_result& res)
+{
+    // calibrate number of blocks in a sample
+    double min_time     = opts.m_min_time_ms * 1.0e6;
+    uint64_t n_iter     = 1;
+
+    while (run_block(n_iter) < min_time && n_iter < (uint64_t(1) << 30))
+        n_iter          *= 2;
+
+    int reps            = std::max(opts.m_reps, 1);
+
+    std::vector<double> samples(reps);
+
+    for (int i = 0; i < reps; ++i)
+        samples[i]      = run_block(n_iter) / double(n_iter * n);
+
+    double stddev;
+    sample_stats(samples, res.m_ns_mean, stddev, res.m_ns_ci95);
+
+    res.m_ops_per_sec   = res.m_ns_mean > 0.0 ? 1.0e9 / res.m_ns_mean : 0.0;
+};
+
+template<class T, class Func>
+static void time_op(const Func& f, const std::vector<T>& x, const std::vector<T>& y,
+                    const bench_options& opts, compare_result& res)
+{
+    using clock         = std::chrono::steady_clock;
+    using result_type   = decltype(f(x[0], y[0]));
+
+    size_t n            = x.size();
+
+    // std::vector<bool> cannot be used
+    std::unique_ptr<result_type[]> out(new result_type[n]);
+
+    auto run_block      = [&](uint64_t n_iter) -> double
+    {
+        clock::time_point start = clock::now();
+
+        for (uint64_t it = 0; it < n_iter; ++it)
+        {
+            for (size_t i = 0; i < n; ++i)
+                out[i]  = f(x[i], y[i]);
+
+            g_sink      = out.get();
+        };
+
+        clock::time_point stop  = clock::now();
+
+        return double(std::chrono::duration_cast<std::chrono::nanoseconds>
+                            (stop - start).count());
+    };
+
+    time_block(run_block, n, opts, res);
+};
+
+template<class T, class Func>
+static void time_reduce(const Func& f, const std::vector<T>& x, 
+                        const bench_options& opts, compare_result& res)
+{
+    using clock         = std::chrono::steady_clock;
+
+    size_t n            = x.size();
+
+    std::vector<T> out(1);
+
+    auto run_block      = [&](uint64_t n_iter) -> double
+    {
+        clock::time_point start = clock::now();
+
+        for (uint64_t it = 0; it < n_iter; ++it)
+        {
+            T acc       = x[0];
+
+            for (size_t i = 1; i < n; ++i)
+                acc     = f(acc, x[i]);
+
+            out[0]      = acc;
+            g_sink      = &out[0];
+        };
+
+        clock::time_point stop  = clock::now();
+
+        return double(std::chrono::duration_cast<std::chrono::nanoseconds>
+                            (stop - start).count());
+    };
+
+    time_block(run_block, n, opts, res);
+};
+
+//----------------------------------------------------------------------
+//                        accuracy
+//----------------------------------------------------------------------
+// accumulated errors of checked results
+struct error_sums
+{
+    double      m_rel;
+    double      m_log;
+    int64_t     m_n_rel;
+    int64_t     m_n_log;
+
+    error_sums()    : m_rel(0.0), m_log(0.0), m_n_rel(0), m_n_log(0) {};
+};
+
+// largest |log|ref|| of level 0 references; relative errors of results on
+// higher levels are meaningless, since neighbouring level k numbers are
+// far apart, and exp(log|x| - log|ref|) - 1 can overflow
+static const double g_rel_err_max_log = gsli_double::config_type::max_index_exp_0 
+                                      * std::log(2.0);
+
+// compare result with reference value
+static void check_result(const ref_value& val, const ref_value& ref, compare_result& res,
+                         error_sums& sums)
+{
+    // results without finite reference are not checked
+    if (ref.m_kind == ref_kind::nan || ref.m_kind == ref_kind::inf)
+        return;
+
+    ++res.m_checked;
+
+    if (ref.m_kind == ref_kind::zero)
+    {
+        if (val.m_kind != ref_kind::zero)
+            ++res.m_failed;
+
+        return;
+    };
+
+    if (val.m_kind != ref_kind::regular || val.m_sign != ref.m_sign)
+    {
+        ++res.m_failed;
+        return;
+    };
+
+    hp_float dif        = val.m_log - ref.m_log;
+
+    hp_float scale      = std::max(hp_float(1), hp_float(abs(ref.m_log)));
+    double log_err      = hp_float(abs(dif) / scale).convert_to<double>();
+
+    res.m_max_log_err   = std::max(res.m_max_log_err, log_err);
+    sums.m_log          += log_err;
+    ++sums.m_n_log;
+
+    if (abs(ref.m_log) <= g_rel_err_max_log)
+    {
+        double err          = abs(hp_float(exp(dif) - 1)).convert_to<double>();
+        res.m_max_rel_err   = std::max(res.m_max_rel_err, err);
+        sums.m_rel          += err;
+        ++sums.m_n_rel;
+    };
+};
+
+// set mean errors
+static void set_mean_errors(const error_sums& sums, compare_result& res)
+{
+    res.m_mean_rel_err  = sums.m_n_rel > 0 ? sums.m_rel / double(sums.m_n_rel) : 0.0;
+    res.m_mean_log_err  = sums.m_n_log > 0 ? sums.m_log / double(sums.m_n_log) : 0.0;
+};
+
+// check accuracy of first m_acc_size results; x0, y0 are original
+// operands, x, y are operands converted to type T
+template<class T, class Func, class Ref>
+static void check_op(const Func& f, const Ref& ref_f, 
+                     const std::vector<gsli_double>& x0, const std::vector<gsli_double>& y0,
+                     const std::vector<T>& x, const std::vector<T>& y, 
+                     size_t n, compare_result& res)
+{
+    error_sums sums;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        ref_value rx    = to_ref(x[i]);
+        ref_value ry    = to_ref(y[i]);
+
+        if (rx.m_kind != ref_kind::regular || ry.m_kind != ref_kind::regular)
+        {
+            // operands are not representable; compare with reference
+            // computed for original operands
+            ref_value ref   = ref_f(to_ref(x0[i]), to_ref(y0[i]));
+            ref_value none  = make_ref(ref_kind::nan, false);
+
+            check_result(none, ref, res, sums);
+            continue;
+        };
+
+        check_result(to_ref(f(x[i], y[i])), ref_f(rx, ry), res, sums);
+    };
+
+    set_mean_errors(sums, res);
+};
+
+template<class T>
+static void check_cmp(const std::vector<T>& x, const std::vector<T>& y, size_t n,
+                      compare_result& res)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        ref_value rx    = to_ref(x[i]);
+        ref_value ry    = to_ref(y[i]);
+
+        ++res.m_checked;
+
+        if (rx.m_kind != ref_kind::regular || ry.m_kind != ref_kind::regular)
+        {
+            // comparison of infinities is not reliable
+            ++res.m_failed;
+            continue;
+        };
+
+        if ((x[i] < y[i]) != ref_less(rx, ry))
+            ++res.m_failed;
+    };
+};
+
+template<class T, class Func, class Ref>
+static void check_reduce(const Func& f, const Ref& ref_f, const std::vector<gsli_double>& x0, 
+                         const std::vector<T>& x, size_t n, compare_result& res)
+{
+    if (n == 0)
+        return;
+
+    error_sums sums;
+    bool range_ok       = true;
+
+    ref_value ref       = to_ref(x[0]);
+    ref_value ref_0     = to_ref(x0[0]);
+    T acc               = x[0];
+
+    range_ok            = range_ok && ref.m_kind == ref_kind::regular;
+
+    for (size_t i = 1; i < n; ++i)
+    {
+        ref_value ri    = to_ref(x[i]);
+
+        range_ok        = range_ok && ri.m_kind == ref_kind::regular;
+        ref             = ref_f(ref, ri);
+        ref_0           = ref_f(ref_0, to_ref(x0[i]));
+        acc             = f(acc, x[i]);
+    };
+
+    if (range_ok == false)
+        check_result(make_ref(ref_kind::nan, false), ref_0, res, sums);
+    else
+        check_result(to_ref(acc), ref, res, sums);
+
+    set_mean_errors(sums, res);
+};
+
+//----------------------------------------------------------------------
+//                        benchmark runner
+//----------------------------------------------------------------------
+template<class T>
+static void run_type(int op, const std::vector<gsli_double>& x0, 
+                     const std::vector<gsli_double>& y0, const bench_options& opts,
+                     compare_result& res)
+{
+    std::vector<T> x, y;
+
+    convert(x0, x);
+    convert(y0, y);
+
+    size_t n_acc        = std::min(opts.m_acc_size, x.size());
+
+    switch (op)
+    {
+        case 0:
+            time_op(op_plus(), x, y, opts, res);
+            check_op(op_plus(), ref_plus, x0, y0, x, y, n_acc, res);
+            break;
+        case 1:
+            time_op(op_mult(), x, y, opts, res);
+            check_op(op_mult(), ref_mult, x0, y0, x, y, n_acc, res);
+            break;
+        case 2:
+            time_op(op_div(), x, y, opts, res);
+            check_op(op_div(), ref_div, x0, y0, x, y, n_acc, res);
+            break;
+        case 3:
+            time_op(op_exp(), x, x, opts, res);
+            check_op(op_exp(), ref_exp, x0, x0, x, x, n_acc, res);
+            break;
+        case 4:
+            time_op(op_log(), x, x, opts, res);
+            check_op(op_log(), ref_log, x0, x0, x, x, n_acc, res);
+            break;
+        case 5:
+            time_op(op_pow(), x, y, opts, res);
+            check_op(op_pow(), ref_pow, x0, y0, x, y, n_acc, res);
+            break;
+        case 6:
+            time_op(op_cmp(), x, y, opts, res);
+            check_cmp(x, y, n_acc, res);
+            break;
+        case 7:
+            time_reduce(op_plus(), x, opts, res);
+            check_reduce(op_plus(), ref_plus, x0, x, n_acc, res);
+            break;
+        default:
+            time_reduce(op_mult(), x, opts, res);
+            check_reduce(op_mult(), ref_mult, x0, x, n_acc, res);
+            break;
+    };
+};
+
+static void make_operands(int dist, uint64_t seed, size_t n, std::vector<gsli_double>& vec)
+{
+    std::mt19937_64 gen(seed);
+
+    vec.resize(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        // dist = 5 is a mixture of levels -2...2
+        int level       = dist < 5 ? dist - 2 : int(gen() % 5) - 2;
+        vec[i]          = random_operand(level, gen);
+    };
+};
+
+#endif
+
+//----------------------------------------------------------------------
+//                        compare_gsli
+//----------------------------------------------------------------------
+compare_gsli::compare_gsli(const bench_options& opts)
+    : m_opts(opts)
+{};
+
+bool compare_gsli::is_available()
+{
+    #ifdef GSLI_BENCH_HAS_BOOST
+        return true;
+    #else
+        return false;
+    #endif
+};
+
+bool compare_gsli::selected(const std::string& name) const
+{
+    if (m_opts.m_filters.empty() == true)
+        return true;
+
+    for (const std::string& filter : m_opts.m_filters)
+    {
+        if (name.find(filter) != std::string::npos)
+            return true;
+    };
+
+    return false;
+};
+
+std::vector<std::string> compare_gsli::list() const
+{
+    std::vector<std::string> res;
+
+    for (int op = 0; op < n_ops; ++op)
+    for (int type = 0; type < n_types; ++type)
+    for (int dist = 0; dist < n_dists; ++dist)
+    {
+        std::string name    = make_name(op, type, dist);
+
+        if (selected(name) == true)
+            res.push_back(name);
+    };
+
+    return res;
+};
+
+std::vector<compare_result> compare_gsli::run(std::ostream* progress) const
+{
+    std::vector<compare_result> res;
+
+    #ifdef GSLI_BENCH_HAS_BOOST
+        for (int dist = 0; dist < n_dists; ++dist)
+        {
+            std::vector<gsli_double> x, y;
+
+            make_operands(dist, m_opts.m_seed, m_opts.m_size, x);
+            make_operands(dist, m_opts.m_seed + 1, m_opts.m_size, y);
+
+            for (int op = 0; op < n_ops; ++op)
+            for (int type = 0; type < n_types; ++type)
+            {
+                std::string name    = make_name(op, type, dist);
+
+                if (selected(name) == false)
+                    continue;
+
+                compare_result r    = compare_result();
+
+                r.m_name            = name;
+                r.m_op              = g_op_names[op];
+                r.m_type            = g_type_names[type];
+                r.m_dist            = g_dist_names[dist];
+
+                switch (type)
+                {
+                    case 0:     run_type<gsli_double>(op, x, y, m_opts, r); break;
+                    case 1:     run_type<log_double>(op, x, y, m_opts, r); break;
+                    case 2:     run_type<mant_exp>(op, x, y, m_opts, r); break;
+                    default:    run_type<bin_float>(op, x, y, m_opts, r); break;
+                };
+
+                res.push_back(r);
+
+                if (progress != nullptr)
+                    write_text(*progress, std::vector<compare_result>(1, r));
+            };
+        };
+    #else
+        (void)progress;
+    #endif
+
+    return res;
+};
+
+//----------------------------------------------------------------------
+//                        output
+//----------------------------------------------------------------------
+void compare_gsli::write_text(std::ostream& os, const std::vector<compare_result>& res)
+{
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    // full statistics are written in csv and json formats
+    for (const compare_result& r : res)
+    {
+        double fail = r.m_checked > 0 ? 100.0 * double(r.m_failed) / double(r.m_checked) 
+                                      : 0.0;
+
+        os << std::left << std::setw(24) << r.m_name << std::right << std::fixed
+           << std::setprecision(2) << std::setw(10) << r.m_ns_mean << " ns/op +- "
+           << std::setw(6) << r.m_ns_ci95 << std::setprecision(0) 
+           << std::setw(12) << r.m_ops_per_sec << " ops/s"
+           << std::setw(6) << r.m_checked << " checked" 
+           << std::setprecision(1) << std::setw(7) << fail << "% failed"
+           << std::scientific << std::setprecision(2)
+           << "  L0 rel err " << std::setw(9) << r.m_max_rel_err
+           << "  log err " << std::setw(9) << r.m_max_log_err
+           << " (mean " << std::setw(9) << r.m_mean_log_err << ")" << "\n";
+    };
+
+    os.flags(flags);
+    os.precision(prec);
+};
+
+void compare_gsli::write_csv(std::ostream& os, const std::vector<compare_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << "name,op,type,dist,ns_mean,ns_ci95,ops_per_sec,checked,failed,"
+       << "max_rel_err,mean_rel_err,max_log_err,mean_log_err" << "\n";
+
+    os << std::setprecision(17);
+
+    for (const compare_result& r : res)
+    {
+        os << r.m_name << "," << r.m_op << "," << r.m_type << "," << r.m_dist 
+           << "," << r.m_ns_mean << "," << r.m_ns_ci95 << "," << r.m_ops_per_sec 
+           << "," << r.m_checked << "," << r.m_failed << "," << r.m_max_rel_err 
+           << "," << r.m_mean_rel_err << "," << r.m_max_log_err 
+           << "," << r.m_mean_log_err << "\n";
+    };
+
+    os.precision(prec);
+};
+
+void compare_gsli::write_json(std::ostream& os, const std::vector<compare_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << std::setprecision(17);
+    os << "{" << "\n" << "  \"comparisons\": [" << "\n";
+
+    for (size_t i = 0; i < res.size(); ++i)
+    {
+        const compare_result& r = res[i];
+
+        os << "    {"
+           << "\"name\": \"" << json_escape(r.m_name) << "\", "
+           << "\"op\": \"" << json_escape(r.m_op) << "\", "
+           << "\"type\": \"" << json_escape(r.m_type) << "\", "
+           << "\"dist\": \"" << json_escape(r.m_dist) << "\", "
+           << "\"ns_mean\": " << r.m_ns_mean << ", "
+           << "\"ns_ci95\": " << r.m_ns_ci95 << ", "
+           << "\"ops_per_sec\": " << r.m_ops_per_sec << ", "
+           << "\"checked\": " << r.m_checked << ", "
+           << "\"failed\": " << r.m_failed << ", ";
+
+        // infinite errors are not valid json numbers
+        const char* names[] = {"max_rel_err", "mean_rel_err", "max_log_err", 
+                               "mean_log_err"};
+        double errors[]     = {r.m_max_rel_err, r.m_mean_rel_err, r.m_max_log_err,
+                               r.m_mean_log_err};
+
+        for (int j = 0; j < 4; ++j)
+        {
+            os << "\"" << names[j] << "\": ";
+
+            if (std::isfinite(errors[j]) == true)
+                os << errors[j];
+            else
+                os << "null";
+
+            os << (j < 3 ? ", " : "}");
+        };
+
+        if (i + 1 < res.size())
+            os << ",";
+
+        os << "\n";
+    };
+
+    os << "  ]" << "\n" << "}" << "\n";
+    os.precision(prec);
+};
+
+}};
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "bench_gsli.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace sli { namespace bench
+{
+
+// result of a single comparative benchmark
+struct compare_result
+{
+    std::string     m_name;
+    std::string     m_op;
+    std::string     m_type;
+    std::string     m_dist;
+
+    // mean and half width of 95% confidence interval of time per operation
+    // in nanoseconds; for reductions time per element
+    double          m_ns_mean;
+    double          m_ns_ci95;
+
+    // operations per second
+    double          m_ops_per_sec;
+
+    // number of checked results; results for which the reference value
+    // is not finite are not checked
+    int64_t         m_checked;
+
+    // number of failed results: operands not representable in the type,
+    // results with wrong sign, wrong special value or wrong comparison
+    int64_t         m_failed;
+
+    // maximum and mean relative error of results, that did not fail and
+    // whose reference is a level 0 number; 0 if there are no such results
+    double          m_max_rel_err;
+    double          m_mean_rel_err;
+
+    // maximum and mean error of logarithms of absolute values of results,
+    // that did not fail, i.e. |log|x| - log|ref|| / max(1, |log|ref||);
+    // relative errors of values of level k numbers can be very large, since
+    // neighbouring representable numbers are far apart
+    double          m_max_log_err;
+    double          m_mean_log_err;
+};
+
+// comparative benchmark of gsli_double and alternative wide range types:
+// log_double (sign and logarithm of absolute value), mant_exp (double
+// mantissa and 64-bit exponent) and boost::multiprecision cpp_bin_float
+// with 53-bit mantissa and 64-bit exponent; operands are random numbers
+// on levels -2...2 (distributions L-2, ..., L+2, and mixed, i.e. random
+// level for each operand); accuracy is measured against a reference
+// computed in logarithmic space with 40 decimal digits
+//
+// benchmark names have form op/type/dist; available only if boost
+// headers are found
+class compare_gsli
+{
+    public:
+        explicit compare_gsli(const bench_options& opts);
+
+        // return true if comparative benchmarks are available
+        static bool                 is_available();
+
+        // return names of all benchmarks selected by filters
+        std::vector<std::string>    list() const;
+
+        // run selected benchmarks; if progress is not null, then results
+        // are printed as text while running
+        std::vector<compare_result> run(std::ostream* progress) const;
+
+    public:
+        // write results
+        static void     write_text(std::ostream& os, const std::vector<compare_result>& res);
+        static void     write_csv(std::ostream& os, const std::vector<compare_result>& res);
+        static void     write_json(std::ostream& os, const std::vector<compare_result>& res);
+
+    private:
+        bench_options               m_opts;
+
+    private:
+        bool            selected(const std::string& name) const;
+};
+
+}};
\ No newline at end of file
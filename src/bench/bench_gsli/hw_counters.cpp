@@ -0,0 +1,186 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "hw_counters.h"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <cstring>
+
+    #define GSLI_HAS_PERF_EVENT
+#endif
+
+namespace sli { namespace bench
+{
+
+#ifdef GSLI_HAS_PERF_EVENT
+
+static int open_event(uint32_t type, uint64_t config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    // this thread, any cpu, no group
+    long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    return int(fd);
+};
+
+static int open_counter(hw_counters::counter c)
+{
+    const uint64_t cache_read_miss  = (uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8)
+                                    | (uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+
+    switch (c)
+    {
+        case hw_counters::cycles:
+            return open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        case hw_counters::instructions:
+            return open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        case hw_counters::branch_misses:
+            return open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        case hw_counters::l1d_misses:
+            return open_event(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cache_read_miss);
+        case hw_counters::llc_misses:
+            return open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        default:
+            return -1;
+    };
+};
+
+#endif
+
+hw_counters::hw_counters()
+{
+    for (int i = 0; i < count; ++i)
+    {
+        m_value[i]  = 0;
+
+        #ifdef GSLI_HAS_PERF_EVENT
+            m_fd[i] = open_counter(counter(i));
+        #else
+            m_fd[i] = -1;
+        #endif
+    };
+};
+
+hw_counters::~hw_counters()
+{
+    #ifdef GSLI_HAS_PERF_EVENT
+        for (int i = 0; i < count; ++i)
+        {
+            if (m_fd[i] >= 0)
+                close(m_fd[i]);
+        };
+    #endif
+};
+
+bool hw_counters::is_available() const
+{
+    for (int i = 0; i < count; ++i)
+    {
+        if (m_fd[i] >= 0)
+            return true;
+    };
+
+    return false;
+};
+
+bool hw_counters::is_available(counter c) const
+{
+    return m_fd[c] >= 0;
+};
+
+void hw_counters::start()
+{
+    #ifdef GSLI_HAS_PERF_EVENT
+        for (int i = 0; i < count; ++i)
+        {
+            if (m_fd[i] < 0)
+                continue;
+
+            ioctl(m_fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        };
+    #endif
+};
+
+void hw_counters::stop()
+{
+    #ifdef GSLI_HAS_PERF_EVENT
+        for (int i = 0; i < count; ++i)
+        {
+            if (m_fd[i] >= 0)
+                ioctl(m_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        };
+
+        for (int i = 0; i < count; ++i)
+        {
+            m_value[i]          = 0;
+
+            if (m_fd[i] < 0)
+                continue;
+
+            // value, time enabled, time running
+            uint64_t data[3];
+
+            if (read(m_fd[i], data, sizeof(data)) != ssize_t(sizeof(data)))
+                continue;
+
+            if (data[2] == 0)
+                continue;
+
+            if (data[2] < data[1])
+                data[0]         = uint64_t(double(data[0]) * double(data[1]) / double(data[2]));
+
+            m_value[i]          = data[0];
+        };
+    #endif
+};
+
+uint64_t hw_counters::get(counter c) const
+{
+    return m_value[c];
+};
+
+const char* hw_counters::name(counter c)
+{
+    switch (c)
+    {
+        case cycles:        return "cycles";
+        case instructions:  return "instructions";
+        case branch_misses: return "branch_misses";
+        case l1d_misses:    return "l1d_misses";
+        case llc_misses:    return "llc_misses";
+        default:            return "unknown";
+    };
+};
+
+}};
\ No newline at end of file
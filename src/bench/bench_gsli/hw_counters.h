@@ -0,0 +1,84 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace sli { namespace bench
+{
+
+// hardware performance counters of the calling thread; counters are read
+// using perf_event_open on Linux; on other systems, or when the kernel
+// does not allow access to counters (see perf_event_paranoid), counters
+// are not available and all values are zero
+class hw_counters
+{
+    public:
+        // collected events
+        enum counter : int
+        {
+            cycles          = 0,
+            instructions,
+            branch_misses,
+            l1d_misses,         // L1 data cache read misses
+            llc_misses,         // last level cache misses
+            count
+        };
+
+    private:
+        // file descriptors of opened events; -1 if event is not available
+        int                 m_fd[count];
+
+        // values collected between last start and stop
+        uint64_t            m_value[count];
+
+    public:
+        // open all counters; counters, that cannot be opened, are not
+        // available
+        hw_counters();
+
+        // close counters
+        ~hw_counters();
+
+        hw_counters(const hw_counters&) = delete;
+        hw_counters&        operator=(const hw_counters&) = delete;
+
+        // return true if any counter is available
+        bool                is_available() const;
+
+        // return true if counter c is available
+        bool                is_available(counter c) const;
+
+        // reset and enable counters
+        void                start();
+
+        // disable counters and read values; values are scaled if events
+        // were multiplexed by the kernel
+        void                stop();
+
+        // return value of counter c collected between last start and stop
+        uint64_t            get(counter c) const;
+
+        // return name of a counter
+        static const char*  name(counter c);
+};
+
+}};
\ No newline at end of file
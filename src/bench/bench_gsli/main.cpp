@@ -0,0 +1,271 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "bench_gsli.h"
+#include "compare_gsli.h"
+#include "stream_gsli.h"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+
+static void print_usage()
+{
+    std::cout 
+        << "usage: bench_gsli [options]" << "\n"
+        << "  --filter <str>        run benchmarks with names containing str;" << "\n"
+        << "                        can be given many times" << "\n"
+        << "  --mode <mode>         latency, throughput or both (default)" << "\n"
+        << "  --size <n>            number of operands in a block (default 1000)" << "\n"
+        << "  --reps <n>            number of samples (default 10)" << "\n"
+        << "  --min-time <ms>       minimum duration of a sample (default 0.5)" << "\n"
+        << "  --seed <n>            random seed (default 1)" << "\n"
+        << "  --format <fmt>        text (default), csv or json" << "\n"
+        << "  --output <file>       write results to file instead of stdout" << "\n"
+        << "  --counters            collect hardware performance counters (cycles," << "\n"
+        << "                        instructions, branch and cache misses, ipc);" << "\n"
+        << "                        requires perf_event_open on Linux" << "\n"
+        << "  --compare             run comparative benchmarks of gsli_double and" << "\n"
+        << "                        alternative wide range types (requires boost)" << "\n"
+        << "  --acc-size <n>        number of results checked for accuracy by" << "\n"
+        << "                        comparative benchmarks (default 200)" << "\n"
+        << "  --stream              run memory-bandwidth-bound streaming benchmarks" << "\n"
+        << "  --max-mb <n>          maximum size of arrays in MiB used by streaming" << "\n"
+        << "                        benchmarks (default 512)" << "\n"
+        << "  --threads <n>         maximum number of threads used by streaming" << "\n"
+        << "                        benchmarks (default: number of hardware threads)" << "\n"
+        << "  --diff <before> <after>" << "\n"
+        << "                        compare two result files written with" << "\n"
+        << "                        --format csv; print speedup of every benchmark" << "\n"
+        << "                        and geometric mean of speedups per operation" << "\n"
+        << "  --list                print names of selected benchmarks" << "\n"
+        << "  --help                print this message" << "\n"
+        << "benchmark names have form op/class_1[/class_2]/mode, where class is" << "\n"
+        << "one of L-4, ..., L-1, L0, L+1, ..., L+4, special; comparative benchmark" << "\n"
+        << "names have form op/type/dist; streaming benchmark names have form" << "\n"
+        << "op/size/threads/store, where store is st or nt (non-temporal)" << "\n";
+};
+
+// list or run benchmarks of a suite and write results
+template<class Suite>
+static int run_suite(const Suite& suite, const std::string& format, 
+                     const std::string& output, bool list)
+{
+    if (list == true)
+    {
+        for (const std::string& name : suite.list())
+            std::cout << name << "\n";
+
+        return 0;
+    };
+
+    std::ofstream file;
+
+    if (output.empty() == false)
+    {
+        file.open(output);
+
+        if (!file)
+        {
+            std::cout << "unable to open " << output << "\n";
+            return 1;
+        };
+    };
+
+    std::ostream& os    = output.empty() ? std::cout : file;
+
+    // progress is printed when results are not written as text to stdout
+    bool show_progress  = output.empty() == false || format != "text";
+
+    auto res            = suite.run(show_progress ? &std::cerr : nullptr);
+
+    if (format == "json")
+        Suite::write_json(os, res);
+    else if (format == "csv")
+        Suite::write_csv(os, res);
+    else
+        Suite::write_text(os, res);
+
+    return 0;
+};
+
+int main(int argc, const char* argv[])
+{
+    using namespace sli::bench;
+
+    bench_options opts;
+    std::string format  = "text";
+    std::string output;
+    bool list           = false;
+    bool compare        = false;
+    bool stream         = false;
+    std::string diff_before;
+    std::string diff_after;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool has_value  = i + 1 < argc;
+
+        if (arg == "--help")
+        {
+            print_usage();
+            return 0;
+        }
+        else if (arg == "--list")
+        {
+            list        = true;
+        }
+        else if (arg == "--compare")
+        {
+            compare             = true;
+        }
+        else if (arg == "--acc-size" && has_value)
+        {
+            opts.m_acc_size     = size_t(std::max(std::atol(argv[++i]), 0L));
+        }
+        else if (arg == "--stream")
+        {
+            stream              = true;
+        }
+        else if (arg == "--max-mb" && has_value)
+        {
+            opts.m_stream_max_mb    = size_t(std::max(std::atol(argv[++i]), 1L));
+        }
+        else if (arg == "--threads" && has_value)
+        {
+            opts.m_threads      = std::max(std::atoi(argv[++i]), 1);
+        }
+        else if (arg == "--diff" && i + 2 < argc)
+        {
+            diff_before         = argv[++i];
+            diff_after          = argv[++i];
+        }
+        else if (arg == "--counters")
+        {
+            opts.m_hw_counters  = true;
+        }
+        else if (arg == "--filter" && has_value)
+        {
+            opts.m_filters.push_back(argv[++i]);
+        }
+        else if (arg == "--mode" && has_value)
+        {
+            std::string mode    = argv[++i];
+            opts.m_latency      = mode == "latency" || mode == "both";
+            opts.m_throughput   = mode == "throughput" || mode == "both";
+        }
+        else if (arg == "--size" && has_value)
+        {
+            opts.m_size         = size_t(std::max(std::atol(argv[++i]), 1L));
+        }
+        else if (arg == "--reps" && has_value)
+        {
+            opts.m_reps         = std::max(std::atoi(argv[++i]), 1);
+        }
+        else if (arg == "--min-time" && has_value)
+        {
+            opts.m_min_time_ms  = std::atof(argv[++i]);
+        }
+        else if (arg == "--seed" && has_value)
+        {
+            opts.m_seed         = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--format" && has_value)
+        {
+            format              = argv[++i];
+        }
+        else if (arg == "--output" && has_value)
+        {
+            output              = argv[++i];
+        }
+        else
+        {
+            std::cout << "invalid argument: " << arg << "\n";
+            print_usage();
+            return 1;
+        };
+    };
+
+    if (format != "text" && format != "csv" && format != "json")
+    {
+        std::cout << "invalid format: " << format << "\n";
+        return 1;
+    };
+
+    if (diff_before.empty() == false)
+    {
+        std::vector<bench_result> before;
+        std::vector<bench_result> after;
+
+        if (bench_gsli::read_csv(diff_before, before) == false)
+        {
+            std::cout << "unable to read " << diff_before << "\n";
+            return 1;
+        };
+
+        if (bench_gsli::read_csv(diff_after, after) == false)
+        {
+            std::cout << "unable to read " << diff_after << "\n";
+            return 1;
+        };
+
+        bench_gsli::write_diff(std::cout, before, after);
+        return 0;
+    };
+
+    try
+    {
+        if (compare == true)
+        {
+            if (compare_gsli::is_available() == false)
+            {
+                std::cout << "comparative benchmarks require boost" << "\n";
+                return 1;
+            };
+
+            return run_suite(compare_gsli(opts), format, output, list);
+        };
+
+        if (stream == true)
+            return run_suite(stream_gsli(opts), format, output, list);
+
+        bench_gsli bench(opts);
+
+        if (opts.m_hw_counters == true && bench.has_hw_counters() == false)
+            std::cerr << "hardware counters are not available" << "\n";
+
+        return run_suite(bench, format, output, list);
+    }
+    catch(std::exception& ex)
+    {
+        std::cout << ex.what();
+        return 1;
+    }
+    catch(gsli::assert_exception& ex)
+    {
+        std::cout << ex.what();
+        return 1;
+    };
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,541 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "stream_gsli.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define GSLI_BENCH_HAS_NT_STORE
+#endif
+
+namespace sli { namespace bench
+{
+
+//----------------------------------------------------------------------
+//                        operations
+//----------------------------------------------------------------------
+// benchmarked operations; plain double kernels are listed first, since
+// they are used as baselines of gsli_double operations
+enum stream_op : int
+{
+    op_double_add   = 0,    // z = x + y for double
+    op_double_scale,        // z = 2 * x for double
+    op_add,                 // z = x + y, level 0 operands (fast path)
+    op_mult,                // z = x * y, level 0 operands (fast path)
+    op_mult_l1,             // z = x * y, level 1 operands (general path)
+    op_exp,                 // z = exp(x), level 0 operands
+    op_log,                 // z = log_abs(x), level 0 operands
+    op_count
+};
+
+static const char* g_op_names[]     = {"double_add", "double_scale", "add", "mult",
+                                       "mult_l1", "exp", "log_abs"};
+
+static bool is_unary(int op)
+{
+    return op == op_double_scale || op == op_exp || op == op_log;
+};
+
+static int baseline_op(int op)
+{
+    return is_unary(op) == true ? op_double_scale : op_double_add;
+};
+
+// number of arrays read or written by an operation
+static int num_arrays(int op)
+{
+    return is_unary(op) == true ? 2 : 3;
+};
+
+struct kernel_double_add
+{
+    double operator()(double x, double y) const             { return x + y; };
+};
+
+struct kernel_double_scale
+{
+    double operator()(double x, double) const               { return 2.0 * x; };
+};
+
+struct kernel_add
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x + y; };
+};
+
+struct kernel_mult
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double& y) const
+    { return x * y; };
+};
+
+struct kernel_exp
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double&) const
+    { return exp(x); };
+};
+
+struct kernel_log
+{
+    gsli_double operator()(const gsli_double& x, const gsli_double&) const
+    { return log_abs(x); };
+};
+
+//----------------------------------------------------------------------
+//                        kernels
+//----------------------------------------------------------------------
+static_assert(sizeof(gsli_double) == sizeof(double), "invalid size of gsli_double");
+
+static double store_bits(double x)
+{
+    return x;
+};
+
+static double store_bits(const gsli_double& x)
+{
+    return x.get_internal_rep();
+};
+
+// evaluate z[i] = f(x[i], y[i]) for i in [first, last); if nt is true,
+// then results are written with non-temporal stores
+template<class T, class Func>
+static void run_kernel(const Func& f, const T* x, const T* y, T* z, size_t first, 
+                       size_t last, bool nt)
+{
+    #ifdef GSLI_BENCH_HAS_NT_STORE
+        if (nt == true)
+        {
+            double* out = reinterpret_cast<double*>(z);
+            size_t i    = first;
+
+            // _mm_stream_pd requires 16-byte alignment
+            if (i < last && (reinterpret_cast<uintptr_t>(out + i) & 15) != 0)
+            {
+                z[i]    = f(x[i], y[i]);
+                ++i;
+            };
+
+            for (; i + 1 < last; i += 2)
+            {
+                double r0   = store_bits(f(x[i], y[i]));
+                double r1   = store_bits(f(x[i + 1], y[i + 1]));
+                _mm_stream_pd(out + i, _mm_set_pd(r1, r0));
+            };
+
+            if (i < last)
+                z[i]    = f(x[i], y[i]);
+
+            _mm_sfence();
+            return;
+        };
+    #else
+        (void)nt;
+    #endif
+
+    for (size_t i = first; i < last; ++i)
+        z[i]            = f(x[i], y[i]);
+};
+
+// run n_iter passes over arrays using n_threads threads; return elapsed
+// time in nanoseconds
+template<class T, class Func>
+static double run_passes(const Func& f, const std::vector<T>& x, const std::vector<T>& y,
+                         std::vector<T>& z, int n_threads, bool nt, uint64_t n_iter)
+{
+    using clock         = std::chrono::steady_clock;
+
+    size_t n            = x.size();
+
+    // chunk boundaries are multiples of 8 elements
+    size_t chunk        = (n / size_t(n_threads) + 7) / 8 * 8;
+
+    auto work           = [&](int t)
+    {
+        size_t first    = std::min(n, chunk * size_t(t));
+        size_t last     = t + 1 == n_threads ? n : std::min(n, first + chunk);
+
+        for (uint64_t it = 0; it < n_iter; ++it)
+            run_kernel(f, x.data(), y.data(), z.data(), first, last, nt);
+    };
+
+    clock::time_point start = clock::now();
+
+    std::vector<std::thread> threads;
+
+    for (int t = 1; t < n_threads; ++t)
+        threads.emplace_back(work, t);
+
+    work(0);
+
+    for (std::thread& th : threads)
+        th.join();
+
+    clock::time_point stop  = clock::now();
+
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>
+                        (stop - start).count());
+};
+
+template<class T, class Func>
+static void measure(const Func& f, const std::vector<T>& x, const std::vector<T>& y,
+                    int n_threads, bool nt, const bench_options& opts, 
+                    stream_result& res)
+{
+    std::vector<T> z(x.size());
+
+    // thread creation is included in measured time; long samples make
+    // this cost negligible
+    double min_time     = std::max(opts.m_min_time_ms, 10.0) * 1.0e6;
+    uint64_t n_iter     = 1;
+
+    while (run_passes(f, x, y, z, n_threads, nt, n_iter) < min_time 
+           && n_iter < (uint64_t(1) << 30))
+    {
+        n_iter          *= 2;
+    };
+
+    int reps            = std::max(opts.m_reps, 1);
+    double n_elem       = double(n_iter) * double(x.size());
+
+    std::vector<double> samples(reps);
+
+    for (int i = 0; i < reps; ++i)
+        samples[i]      = run_passes(f, x, y, z, n_threads, nt, n_iter) / n_elem;
+
+    double stddev;
+    sample_stats(samples, res.m_ns_mean, stddev, res.m_ns_ci95);
+
+    res.m_ops_per_sec   = res.m_ns_mean > 0.0 ? 1.0e9 / res.m_ns_mean : 0.0;
+};
+
+// fill vec with n copies of a random pattern
+template<class T, class Gen>
+static void fill_operands(std::vector<T>& vec, size_t n, const Gen& gen_value, 
+                          uint64_t seed)
+{
+    static const size_t pattern_size    = 4096;
+
+    std::mt19937_64 gen(seed);
+
+    vec.resize(n);
+
+    for (size_t i = 0; i < std::min(n, pattern_size); ++i)
+        vec[i]          = gen_value(gen);
+
+    for (size_t i = pattern_size; i < n; ++i)
+        vec[i]          = vec[i - pattern_size];
+};
+
+static stream_result run_config(int op, uint64_t bytes, int n_threads, bool nt,
+                                const bench_options& opts)
+{
+    stream_result res   = stream_result();
+    size_t n            = size_t(bytes / (sizeof(double) * num_arrays(op)));
+    n                   = std::max(n, size_t(8));
+
+    std::uniform_real_distribution<double> unif(0.5, 2.0);
+    std::uniform_real_distribution<double> unif_exp(-10.0, 10.0);
+    std::uniform_real_distribution<double> unif_ind(1.5, 100.0);
+
+    auto gen_double     = [&](std::mt19937_64& g) -> double
+    {
+        return (g() & 1) != 0 ? -unif(g) : unif(g);
+    };
+
+    auto gen_level_0    = [&](std::mt19937_64& g) -> gsli_double
+    {
+        return gsli_double(op == op_exp ? unif_exp(g) : gen_double(g));
+    };
+
+    auto gen_level_1    = [&](std::mt19937_64& g) -> gsli_double
+    {
+        return gsli_double(1, (g() & 1) != 0 ? -unif_ind(g) : unif_ind(g));
+    };
+
+    if (op == op_double_add || op == op_double_scale)
+    {
+        std::vector<double> x, y;
+
+        fill_operands(x, n, gen_double, opts.m_seed);
+        fill_operands(y, n, gen_double, opts.m_seed + 1);
+
+        if (op == op_double_add)
+            measure(kernel_double_add(), x, y, n_threads, nt, opts, res);
+        else
+            measure(kernel_double_scale(), x, y, n_threads, nt, opts, res);
+    }
+    else
+    {
+        std::vector<gsli_double> x, y;
+
+        if (op == op_mult_l1)
+        {
+            fill_operands(x, n, gen_level_1, opts.m_seed);
+            fill_operands(y, n, gen_level_1, opts.m_seed + 1);
+        }
+        else
+        {
+            fill_operands(x, n, gen_level_0, opts.m_seed);
+            fill_operands(y, n, gen_level_0, opts.m_seed + 1);
+        };
+
+        switch (op)
+        {
+            case op_add:    measure(kernel_add(), x, y, n_threads, nt, opts, res); break;
+            case op_exp:    measure(kernel_exp(), x, y, n_threads, nt, opts, res); break;
+            case op_log:    measure(kernel_log(), x, y, n_threads, nt, opts, res); break;
+            default:        measure(kernel_mult(), x, y, n_threads, nt, opts, res); break;
+        };
+    };
+
+    res.m_op            = g_op_names[op];
+    res.m_bytes         = bytes;
+    res.m_threads       = n_threads;
+    res.m_nt_store      = nt;
+    res.m_gb_per_sec    = res.m_ops_per_sec * double(sizeof(double) * num_arrays(op)) 
+                        * 1.0e-9;
+    res.m_bw_ratio      = 1.0;
+
+    return res;
+};
+
+static std::string format_size(uint64_t bytes)
+{
+    std::ostringstream os;
+
+    if (bytes >= (uint64_t(1) << 30) && bytes % (uint64_t(1) << 30) == 0)
+        os << (bytes >> 30) << "GiB";
+    else if (bytes >= (uint64_t(1) << 20) && bytes % (uint64_t(1) << 20) == 0)
+        os << (bytes >> 20) << "MiB";
+    else
+        os << (bytes >> 10) << "KiB";
+
+    return os.str();
+};
+
+//----------------------------------------------------------------------
+//                        stream_gsli
+//----------------------------------------------------------------------
+stream_gsli::stream_gsli(const bench_options& opts)
+    : m_opts(opts)
+{};
+
+bool stream_gsli::has_nt_store()
+{
+    #ifdef GSLI_BENCH_HAS_NT_STORE
+        return true;
+    #else
+        return false;
+    #endif
+};
+
+std::string stream_gsli::make_name(const config& c)
+{
+    std::ostringstream os;
+
+    os << g_op_names[c.m_op] << "/" << format_size(c.m_bytes) << "/t" << c.m_threads
+       << "/" << (c.m_nt_store == true ? "nt" : "st");
+
+    return os.str();
+};
+
+bool stream_gsli::selected(const std::string& name) const
+{
+    if (m_opts.m_filters.empty() == true)
+        return true;
+
+    for (const std::string& filter : m_opts.m_filters)
+    {
+        if (name.find(filter) != std::string::npos)
+            return true;
+    };
+
+    return false;
+};
+
+std::vector<stream_gsli::config> stream_gsli::make_configs() const
+{
+    std::vector<config> res;
+
+    uint64_t max_bytes  = uint64_t(std::max(m_opts.m_stream_max_mb, size_t(1))) << 20;
+    int max_threads     = std::max(m_opts.m_threads, 1);
+
+    std::vector<int> threads;
+
+    for (int t = 1; t < max_threads; t *= 2)
+        threads.push_back(t);
+
+    threads.push_back(max_threads);
+
+    for (uint64_t bytes = uint64_t(16) << 10; bytes <= max_bytes; bytes *= 4)
+    for (int t : threads)
+    for (int nt = 0; nt < (has_nt_store() ? 2 : 1); ++nt)
+    for (int op = 0; op < op_count; ++op)
+    {
+        config c        = config{op, bytes, t, nt != 0};
+
+        if (selected(make_name(c)) == true)
+            res.push_back(c);
+    };
+
+    return res;
+};
+
+std::vector<std::string> stream_gsli::list() const
+{
+    std::vector<std::string> res;
+
+    for (const config& c : make_configs())
+        res.push_back(make_name(c));
+
+    return res;
+};
+
+std::vector<stream_result> stream_gsli::run(std::ostream* progress) const
+{
+    using key_type      = std::tuple<int, uint64_t, int, bool>;
+
+    std::vector<stream_result> res;
+
+    // results of baseline kernels
+    std::map<key_type, double> baseline;
+
+    for (const config& c : make_configs())
+    {
+        stream_result r = run_config(c.m_op, c.m_bytes, c.m_threads, c.m_nt_store, m_opts);
+        r.m_name        = make_name(c);
+
+        if (c.m_op == baseline_op(c.m_op))
+        {
+            baseline[key_type(c.m_op, c.m_bytes, c.m_threads, c.m_nt_store)] 
+                        = r.m_gb_per_sec;
+        }
+        else
+        {
+            key_type key    = key_type(baseline_op(c.m_op), c.m_bytes, c.m_threads, 
+                                       c.m_nt_store);
+
+            // baseline is measured if it was not selected
+            if (baseline.find(key) == baseline.end())
+            {
+                baseline[key]   = run_config(baseline_op(c.m_op), c.m_bytes, c.m_threads,
+                                             c.m_nt_store, m_opts).m_gb_per_sec;
+            };
+
+            double base     = baseline[key];
+            r.m_bw_ratio    = base > 0.0 ? r.m_gb_per_sec / base : 0.0;
+        };
+
+        res.push_back(r);
+
+        if (progress != nullptr)
+            write_text(*progress, std::vector<stream_result>(1, r));
+    };
+
+    return res;
+};
+
+//----------------------------------------------------------------------
+//                        output
+//----------------------------------------------------------------------
+void stream_gsli::write_text(std::ostream& os, const std::vector<stream_result>& res)
+{
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    for (const stream_result& r : res)
+    {
+        os << std::left << std::setw(30) << r.m_name << std::right << std::fixed
+           << std::setprecision(3) << std::setw(10) << r.m_ns_mean << " ns/elem +- "
+           << std::setw(6) << r.m_ns_ci95 << std::setprecision(0) 
+           << std::setw(12) << r.m_ops_per_sec << " elem/s"
+           << std::setprecision(2) << std::setw(9) << r.m_gb_per_sec << " GB/s"
+           << std::setw(7) << r.m_bw_ratio << " of baseline" << "\n";
+    };
+
+    os.flags(flags);
+    os.precision(prec);
+};
+
+void stream_gsli::write_csv(std::ostream& os, const std::vector<stream_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << "name,op,bytes,threads,nt_store,ns_mean,ns_ci95,ops_per_sec,gb_per_sec,"
+       << "bw_ratio" << "\n";
+
+    os << std::setprecision(17);
+
+    for (const stream_result& r : res)
+    {
+        os << r.m_name << "," << r.m_op << "," << r.m_bytes << "," << r.m_threads 
+           << "," << (r.m_nt_store ? 1 : 0) << "," << r.m_ns_mean << "," << r.m_ns_ci95 
+           << "," << r.m_ops_per_sec << "," << r.m_gb_per_sec << "," << r.m_bw_ratio 
+           << "\n";
+    };
+
+    os.precision(prec);
+};
+
+void stream_gsli::write_json(std::ostream& os, const std::vector<stream_result>& res)
+{
+    std::streamsize prec            = os.precision();
+
+    os << std::setprecision(17);
+    os << "{" << "\n" << "  \"streams\": [" << "\n";
+
+    for (size_t i = 0; i < res.size(); ++i)
+    {
+        const stream_result& r  = res[i];
+
+        os << "    {"
+           << "\"name\": \"" << r.m_name << "\", "
+           << "\"op\": \"" << r.m_op << "\", "
+           << "\"bytes\": " << r.m_bytes << ", "
+           << "\"threads\": " << r.m_threads << ", "
+           << "\"nt_store\": " << (r.m_nt_store ? "true" : "false") << ", "
+           << "\"ns_mean\": " << r.m_ns_mean << ", "
+           << "\"ns_ci95\": " << r.m_ns_ci95 << ", "
+           << "\"ops_per_sec\": " << r.m_ops_per_sec << ", "
+           << "\"gb_per_sec\": " << r.m_gb_per_sec << ", "
+           << "\"bw_ratio\": " << r.m_bw_ratio << "}";
+
+        if (i + 1 < res.size())
+            os << ",";
+
+        os << "\n";
+    };
+
+    os << "  ]" << "\n" << "}" << "\n";
+    os.precision(prec);
+};
+
+}};
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "bench_gsli.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace sli { namespace bench
+{
+
+// result of a single streaming benchmark
+struct stream_result
+{
+    std::string     m_name;
+    std::string     m_op;
+
+    // total size of all arrays in bytes
+    uint64_t        m_bytes;
+
+    // number of threads
+    int             m_threads;
+
+    // true if results were written using non-temporal stores
+    bool            m_nt_store;
+
+    // mean and half width of 95% confidence interval of time per element
+    // in nanoseconds
+    double          m_ns_mean;
+    double          m_ns_ci95;
+
+    // elements processed per second
+    double          m_ops_per_sec;
+
+    // memory traffic in GB/s, assuming that every array element is read
+    // or written once
+    double          m_gb_per_sec;
+
+    // ratio of memory traffic to memory traffic of the corresponding plain
+    // double kernel with the same size, number of threads and store type;
+    // values close to 1 indicate, that the operation is memory-bound
+    double          m_bw_ratio;
+};
+
+// streaming benchmarks; operations are evaluated on arrays, that are
+// larger than L1 cache up to arrays, that are much larger than the last
+// level cache; array sizes are 16 KiB, 64 KiB, ... up to m_stream_max_mb;
+// results are written with regular or non-temporal stores, using 1, 2,
+// 4, ... up to m_threads threads; every gsli_double operation is
+// compared with a plain double kernel with the same memory traffic
+//
+// benchmark names have form op/size/threads/store, e.g. add/64MiB/t2/nt;
+// non-temporal stores are available only on x86 processors with SSE2
+class stream_gsli
+{
+    public:
+        explicit stream_gsli(const bench_options& opts);
+
+        // return names of all benchmarks selected by filters
+        std::vector<std::string>    list() const;
+
+        // run selected benchmarks; if progress is not null, then results
+        // are printed as text while running
+        std::vector<stream_result>  run(std::ostream* progress) const;
+
+        // return true if non-temporal stores are supported
+        static bool                 has_nt_store();
+
+    public:
+        // write results
+        static void     write_text(std::ostream& os, const std::vector<stream_result>& res);
+        static void     write_csv(std::ostream& os, const std::vector<stream_result>& res);
+        static void     write_json(std::ostream& os, const std::vector<stream_result>& res);
+
+    private:
+        struct config
+        {
+            int         m_op;
+            uint64_t    m_bytes;
+            int         m_threads;
+            bool        m_nt_store;
+        };
+
+    private:
+        bench_options               m_opts;
+
+    private:
+        bool                selected(const std::string& name) const;
+        std::vector<config> make_configs() const;
+        static std::string  make_name(const config& c);
+};
+
+}};
\ No newline at end of file
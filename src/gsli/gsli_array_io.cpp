@@ -0,0 +1,372 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_array_io.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_file_map.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        header encoding
+//----------------------------------------------------------------------
+static const char       array_magic[8]  = {'G', 'S', 'L', 'I', 'A', 'R', 'R', '1'};
+static const uint32_t   array_version   = 1;
+
+static void array_store(unsigned char* ptr, uint64_t val, int bytes)
+{
+    for (int i = 0; i < bytes; ++i)
+        ptr[i]  = (unsigned char)(val >> (8 * i));
+};
+
+static uint64_t array_load(const unsigned char* ptr, int bytes)
+{
+    uint64_t val    = 0;
+
+    for (int i = 0; i < bytes; ++i)
+        val         |= uint64_t(ptr[i]) << (8 * i);
+
+    return val;
+};
+
+static bool array_host_big_endian()
+{
+    uint16_t probe  = 1;
+    unsigned char byte;
+    std::memcpy(&byte, &probe, 1);
+
+    return byte == 0;
+};
+
+GSLI_INLINE
+array_header array_header::make(uint64_t n, array_encoding enc)
+{
+    using config    = gsli_double::config_type;
+
+    array_header h;
+    h.m_version             = array_version;
+    h.m_max_level           = config::max_level;
+    h.m_max_index_exp_0     = config::max_index_exp_0;
+    h.m_max_index_exp_1     = config::max_index_exp_1;
+    h.m_min_index_exp_1     = config::min_index_exp_1;
+    h.m_precision           = config::precision;
+    h.m_big_endian          = array_host_big_endian();
+    h.m_size                = n;
+    h.m_data_offset         = array_header_size;
+    h.m_encoding            = enc;
+
+    return h;
+};
+
+GSLI_INLINE
+const char* array_status_name(array_status st)
+{
+    switch (st)
+    {
+        case array_status::ok:              return "ok";
+        case array_status::io_error:        return "io error";
+        case array_status::bad_magic:       return "not a gsli array file";
+        case array_status::bad_version:     return "unsupported format version";
+        case array_status::bad_config:      return "different gsli_double config";
+        case array_status::bad_byte_order:  return "different byte order";
+        case array_status::bad_encoding:    return "unsupported encoding";
+        case array_status::truncated:       return "truncated file";
+        default:                            return "unknown";
+    };
+};
+
+GSLI_INLINE
+void write_array_header(const array_header& h, unsigned char* buf)
+{
+    std::memset(buf, 0, array_header_size);
+    std::memcpy(buf, array_magic, sizeof(array_magic));
+
+    array_store(buf + 8,  h.m_version, 4);
+    array_store(buf + 12, array_header_size, 4);
+    array_store(buf + 16, uint32_t(h.m_max_level), 4);
+    array_store(buf + 20, uint32_t(h.m_max_index_exp_0), 4);
+    array_store(buf + 24, uint32_t(h.m_max_index_exp_1), 4);
+    array_store(buf + 28, uint32_t(h.m_precision), 4);
+    array_store(buf + 32, h.m_big_endian ? 1 : 0, 4);
+    array_store(buf + 36, uint32_t(h.m_min_index_exp_1), 4);
+    array_store(buf + 40, h.m_size, 8);
+    array_store(buf + 48, h.m_data_offset, 8);
+    array_store(buf + 56, uint32_t(h.m_encoding), 4);
+};
+
+GSLI_INLINE
+array_status read_array_header(const unsigned char* buf, array_header& h)
+{
+    if (std::memcmp(buf, array_magic, sizeof(array_magic)) != 0)
+        return array_status::bad_magic;
+
+    h.m_version             = uint32_t(array_load(buf + 8, 4));
+    uint64_t header_size    = array_load(buf + 12, 4);
+    h.m_max_level           = int(int32_t(array_load(buf + 16, 4)));
+    h.m_max_index_exp_0     = int(int32_t(array_load(buf + 20, 4)));
+    h.m_max_index_exp_1     = int(int32_t(array_load(buf + 24, 4)));
+    h.m_precision           = int(int32_t(array_load(buf + 28, 4)));
+    h.m_big_endian          = array_load(buf + 32, 4) != 0;
+    h.m_min_index_exp_1     = int(int32_t(array_load(buf + 36, 4)));
+    h.m_size                = array_load(buf + 40, 8);
+    h.m_data_offset         = array_load(buf + 48, 8);
+    uint64_t encoding       = array_load(buf + 56, 4);
+
+    // mapped elements must be aligned
+    if (h.m_version != array_version || header_size != array_header_size
+        || h.m_data_offset < array_header_size 
+        || h.m_data_offset % alignof(double) != 0)
+    {
+        return array_status::bad_version;
+    };
+
+    array_header ref        = array_header::make(0);
+
+    if (h.m_max_level != ref.m_max_level || h.m_max_index_exp_0 != ref.m_max_index_exp_0
+        || h.m_max_index_exp_1 != ref.m_max_index_exp_1 
+        || h.m_min_index_exp_1 != ref.m_min_index_exp_1
+        || h.m_precision != ref.m_precision)
+    {
+        return array_status::bad_config;
+    };
+
+    if (h.m_big_endian != ref.m_big_endian)
+        return array_status::bad_byte_order;
+
+    if (encoding > uint64_t(array_encoding::block_codec))
+        return array_status::bad_encoding;
+
+    h.m_encoding            = array_encoding(encoding);
+
+    // number of bytes must not overflow
+    if (h.m_encoding == array_encoding::raw
+        && h.m_size > (uint64_t(-1) - h.m_data_offset) / sizeof(double))
+    {
+        return array_status::truncated;
+    };
+
+    return array_status::ok;
+};
+
+GSLI_INLINE
+array_status check_array_buffer(const unsigned char* buf, size_t size, array_header& h)
+{
+    if (size < array_header_size)
+        return array_status::truncated;
+
+    array_status st = read_array_header(buf, h);
+
+    if (st != array_status::ok)
+        return st;
+
+    if (h.m_encoding != array_encoding::raw)
+        return array_status::bad_encoding;
+
+    if (h.m_data_offset + h.m_size * sizeof(double) > size)
+        return array_status::truncated;
+
+    return array_status::ok;
+};
+
+//----------------------------------------------------------------------
+//                        streams
+//----------------------------------------------------------------------
+GSLI_INLINE
+void write_array(std::ostream& os, const gsli_double* x, size_t n)
+{
+    static_assert(sizeof(gsli_double) == sizeof(double), "invalid gsli_double size");
+
+    unsigned char buf[array_header_size];
+    write_array_header(array_header::make(n), buf);
+
+    os.write((const char*)buf, array_header_size);
+    os.write((const char*)x, std::streamsize(n * sizeof(gsli_double)));
+};
+
+GSLI_INLINE
+array_status read_array(std::istream& is, std::vector<gsli_double>& x)
+{
+    unsigned char buf[array_header_size];
+
+    if (!is.read((char*)buf, array_header_size))
+        return array_status::io_error;
+
+    array_header h;
+    array_status st = read_array_header(buf, h);
+
+    if (st != array_status::ok)
+        return st;
+
+    if (h.m_encoding != array_encoding::raw)
+        return array_status::bad_encoding;
+
+    // skip padding written by future versions; offsets that cannot be
+    // skipped in a stream are not supported
+    uint64_t pad    = h.m_data_offset - array_header_size;
+
+    if (pad > uint64_t(std::numeric_limits<std::streamsize>::max()))
+        return array_status::bad_version;
+
+    is.ignore(std::streamsize(pad));
+
+    if (is.gcount() != std::streamsize(pad))
+        return array_status::truncated;
+
+    if (h.m_size > size_t(-1) / sizeof(gsli_double))
+        return array_status::truncated;
+
+    // read in bounded chunks; a corrupted size must not trigger a huge
+    // allocation before the end of stream is reached
+    const size_t chunk  = size_t(1) << 20;
+    size_t n            = size_t(h.m_size);
+
+    std::vector<gsli_double> res;
+    res.reserve(std::min(n, chunk));
+
+    while (res.size() < n)
+    {
+        size_t pos      = res.size();
+        size_t count    = std::min(n - pos, chunk);
+        res.resize(pos + count);
+
+        if (!is.read((char*)(res.data() + pos), std::streamsize(count * sizeof(gsli_double))))
+            return array_status::truncated;
+    };
+
+    x.swap(res);
+    return array_status::ok;
+};
+
+GSLI_INLINE
+array_status write_array_file(const std::string& file, const gsli_double* x, size_t n)
+{
+    std::ofstream os(file, std::ios::binary);
+
+    if (!os)
+        return array_status::io_error;
+
+    write_array(os, x, n);
+    os.close();
+
+    return os ? array_status::ok : array_status::io_error;
+};
+
+GSLI_INLINE
+array_status read_array_file(const std::string& file, std::vector<gsli_double>& x)
+{
+    std::ifstream is(file, std::ios::binary);
+
+    if (!is)
+        return array_status::io_error;
+
+    return read_array(is, x);
+};
+
+//----------------------------------------------------------------------
+//                        mapped_array
+//----------------------------------------------------------------------
+GSLI_INLINE
+mapped_array::mapped_array()
+    : m_map(nullptr), m_map_size(0), m_header(array_header::make(0))
+    , m_data(nullptr), m_size(0)
+{};
+
+GSLI_INLINE
+mapped_array::~mapped_array()
+{
+    close();
+};
+
+GSLI_INLINE
+mapped_array::mapped_array(mapped_array&& other)
+    : m_map(other.m_map), m_map_size(other.m_map_size), m_header(other.m_header)
+    , m_data(other.m_data), m_size(other.m_size)
+{
+    other.m_map         = nullptr;
+    other.m_map_size    = 0;
+    other.m_data        = nullptr;
+    other.m_size        = 0;
+};
+
+GSLI_INLINE
+mapped_array& mapped_array::operator=(mapped_array&& other)
+{
+    if (this != &other)
+    {
+        close();
+        std::swap(m_map, other.m_map);
+        std::swap(m_map_size, other.m_map_size);
+        std::swap(m_header, other.m_header);
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+    };
+
+    return *this;
+};
+
+GSLI_INLINE
+array_status mapped_array::open(const std::string& file)
+{
+    close();
+
+    size_t size = 0;
+    void* map   = details::map_file(file, false, size);
+
+    if (map == nullptr)
+        return array_status::io_error;
+
+    array_header h;
+    array_status st = check_array_buffer((const unsigned char*)map, size, h);
+
+    if (st != array_status::ok)
+    {
+        details::unmap_file(map, size);
+        return st;
+    };
+
+    m_map       = map;
+    m_map_size  = size;
+    m_header    = h;
+    m_data      = (const gsli_double*)((const char*)map + h.m_data_offset);
+    m_size      = size_t(h.m_size);
+
+    return array_status::ok;
+};
+
+GSLI_INLINE
+void mapped_array::close()
+{
+    if (m_map != nullptr)
+        details::unmap_file(m_map, m_map_size);
+
+    m_map       = nullptr;
+    m_map_size  = 0;
+    m_data      = nullptr;
+    m_size      = 0;
+};
+
+};
\ No newline at end of file
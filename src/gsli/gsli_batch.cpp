@@ -0,0 +1,333 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/details/gsli_batch.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_prob.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define GSLI_HAS_CPUID 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+    #define GSLI_HAS_CPUID 1
+#else
+    #define GSLI_HAS_CPUID 0
+#endif
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        cpu detection
+//----------------------------------------------------------------------
+#if GSLI_HAS_CPUID
+
+// call cpuid instruction with given leaf and subleaf; regs = {eax, ebx, ecx, edx}
+static void call_cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, int(leaf), int(subleaf));
+
+    for (int i = 0; i < 4; ++i)
+        regs[i]     = unsigned(r[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+};
+
+// return extended control register XCR0, which describes register states
+// saved by the operating system
+static uint64_t call_xgetbv()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (uint64_t(hi) << 32) | lo;
+#endif
+};
+
+#endif
+
+GSLI_INLINE
+details::batch_isa details::detect_batch_isa()
+{
+#if GSLI_HAS_CPUID
+    unsigned regs[4];
+
+    call_cpuid(0, 0, regs);
+    unsigned max_leaf   = regs[0];
+
+    if (max_leaf < 7)
+        return batch_isa::sse2;
+
+    call_cpuid(1, 0, regs);
+
+    // AVX registers can be used only if the operating system saves them
+    bool has_osxsave    = (regs[2] & (1u << 27)) != 0;
+    bool has_avx        = (regs[2] & (1u << 28)) != 0;
+
+    if (has_osxsave == false || has_avx == false)
+        return batch_isa::sse2;
+
+    uint64_t xcr0       = call_xgetbv();
+
+    // XMM and YMM states
+    bool os_avx         = (xcr0 & 0x06) == 0x06;
+
+    // XMM, YMM, opmask, ZMM_Hi256 and Hi16_ZMM states
+    bool os_avx512      = (xcr0 & 0xe6) == 0xe6;
+
+    call_cpuid(7, 0, regs);
+
+    bool has_avx2       = (regs[1] & (1u << 5)) != 0;
+    bool has_avx512f    = (regs[1] & (1u << 16)) != 0;
+    bool has_avx512dq   = (regs[1] & (1u << 17)) != 0;
+
+    if (os_avx512 == true && has_avx2 == true && has_avx512f == true 
+        && has_avx512dq == true)
+    {
+        return batch_isa::avx512;
+    };
+
+    if (os_avx == true && has_avx2 == true)
+        return batch_isa::avx2;
+
+    return batch_isa::sse2;
+#else
+    return batch_isa::sse2;
+#endif
+};
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4996) //getenv may be unsafe
+#endif
+
+GSLI_INLINE
+details::batch_isa details::select_batch_isa()
+{
+    batch_isa best      = detect_batch_isa();
+    const char* env     = std::getenv(GSLI_BATCH_ISA_ENV);
+
+    if (env == nullptr)
+        return best;
+
+    for (int i = 0; i < batch_isa_count; ++i)
+    {
+        batch_isa isa   = batch_isa(i);
+
+        if (std::strcmp(env, batch_isa_name(isa)) != 0)
+            continue;
+
+        // instruction set not supported by this CPU
+        if (isa > best)
+            return best;
+
+        return isa;
+    };
+
+    // unknown value
+    return best;
+};
+
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+GSLI_INLINE
+const char* details::batch_isa_name(batch_isa isa)
+{
+    switch (isa)
+    {
+        case batch_isa::sse2:   return "sse2";
+        case batch_isa::avx2:   return "avx2";
+        case batch_isa::avx512: return "avx512";
+    };
+
+    return "unknown";
+};
+
+GSLI_INLINE
+bool details::init_batch_kernels(batch_isa isa, batch_kernels& table)
+{
+    if (isa > detect_batch_isa())
+        return false;
+
+    switch (isa)
+    {
+        case batch_isa::sse2:
+            init_batch_kernels_sse2(table);
+            return true;
+        case batch_isa::avx2:
+            init_batch_kernels_avx2(table);
+            return true;
+        case batch_isa::avx512:
+            init_batch_kernels_avx512(table);
+            return true;
+    };
+
+    return false;
+};
+
+//----------------------------------------------------------------------
+//                        batch functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+void details::exp_kernel(const double* x, double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.exp_kernel(x, res, n);
+};
+
+GSLI_INLINE
+void details::log_kernel(const double* x, double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.log_kernel(x, res, n);
+};
+
+GSLI_INLINE
+void convert(const double* x, gsli_double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.convert(x, res, n);
+};
+
+GSLI_INLINE
+void get_value(const gsli_double* x, double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.get_value(x, res, n);
+};
+
+GSLI_INLINE
+void plus(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.plus(x, y, res, n);
+};
+
+GSLI_INLINE
+void minus(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.minus(x, y, res, n);
+};
+
+GSLI_INLINE
+void mult(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.mult(x, y, res, n);
+};
+
+GSLI_INLINE
+void div(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.div(x, y, res, n);
+};
+
+GSLI_INLINE
+void less(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.less(x, y, res, n);
+};
+
+GSLI_INLINE
+void greater(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.greater(x, y, res, n);
+};
+
+GSLI_INLINE
+void leq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.leq(x, y, res, n);
+};
+
+GSLI_INLINE
+void geq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.geq(x, y, res, n);
+};
+
+GSLI_INLINE
+void eq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.eq(x, y, res, n);
+};
+
+GSLI_INLINE
+gsli_double sum(const gsli_double* x, size_t n)
+{
+    return g_global_constants.m_batch_kernels.sum(x, n);
+};
+
+GSLI_INLINE
+gsli_double prod(const gsli_double* x, size_t n)
+{
+    return g_global_constants.m_batch_kernels.prod(x, n);
+};
+
+GSLI_INLINE
+gsli_prob sum(const gsli_prob* x, size_t n)
+{
+    return g_global_constants.m_batch_kernels.sum_prob(x, n);
+};
+
+GSLI_INLINE
+void details::plus_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                           size_t n)
+{
+    g_global_constants.m_batch_kernels.plus_level_0(x, y, res, n);
+};
+
+GSLI_INLINE
+void details::minus_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                            size_t n)
+{
+    g_global_constants.m_batch_kernels.minus_level_0(x, y, res, n);
+};
+
+GSLI_INLINE
+void details::mult_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                           size_t n)
+{
+    g_global_constants.m_batch_kernels.mult_level_0(x, y, res, n);
+};
+
+GSLI_INLINE
+void details::count_moderate(const gsli_double* x, size_t n, size_t* n_zero, 
+                             size_t* n_moderate)
+{
+    g_global_constants.m_batch_kernels.count_moderate(x, n, n_zero, n_moderate);
+};
+
+GSLI_INLINE
+void details::codec_unpack(const unsigned char* exp_src, const unsigned char* mant_src,
+                int exp_bits, int mant_bits, int exp_base, uint64_t* res, size_t n)
+{
+    g_global_constants.m_batch_kernels.codec_unpack(exp_src, mant_src, exp_bits, 
+                mant_bits, exp_base, res, n);
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,38 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/details/gsli_batch.h"
+
+// batch kernels compiled for sse2 instruction set
+#define GSLI_BATCH_NAMESPACE    batch_sse2
+#define GSLI_BATCH_TARGET       GSLI_TARGET_SSE2
+
+#include "gsli/details/gsli_batch_impl.inl"
+
+namespace sli
+{
+
+GSLI_INLINE
+void details::init_batch_kernels_sse2(batch_kernels& table)
+{
+    batch_sse2::init_table(table);
+};
+
+};
\ No newline at end of file
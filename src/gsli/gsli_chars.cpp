@@ -0,0 +1,692 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_chars.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_rep.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+static std::chars_format to_std_format(chars_format fmt)
+{
+    switch (fmt)
+    {
+        case chars_format::scientific:  return std::chars_format::scientific;
+        case chars_format::fixed:       return std::chars_format::fixed;
+        case chars_format::hex:         return std::chars_format::hex;
+        case chars_format::general:
+        default:                        return std::chars_format::general;
+    };
+};
+
+static to_chars_result chars_fail(char* last)
+{
+    return to_chars_result{last, std::errc::value_too_large};
+};
+
+// write n characters of str
+static to_chars_result chars_write(char* first, char* last, const char* str, size_t n)
+{
+    if (size_t(last - first) < n)
+        return chars_fail(last);
+
+    std::memcpy(first, str, n);
+    return to_chars_result{first + n, std::errc()};
+};
+
+// write a double; shortest form is used if precision is negative
+static to_chars_result chars_write_double(char* first, char* last, double v, 
+                                          chars_format fmt, int precision)
+{
+    std::to_chars_result res;
+
+    if (precision < 0)
+        res = std::to_chars(first, last, v, to_std_format(fmt));
+    else
+        res = std::to_chars(first, last, v, to_std_format(fmt), precision);
+
+    if (res.ec != std::errc())
+        return chars_fail(last);
+
+    return to_chars_result{res.ptr, std::errc()};
+};
+
+static to_chars_result chars_write_gsli(char* first, char* last, const gsli_double& x,
+                                        chars_format fmt, int precision)
+{
+    using config    = gsli_double::config_type;
+
+    const double& v = x.get_internal_rep();
+
+    // level 0 numbers are stored directly
+    if (details::is_level_0(v) == true)
+        return chars_write_double(first, last, v, fmt, precision);
+
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+
+    int level       = rep.level();
+
+    if (level == config::max_level + 1)
+    {
+        if (rep.is_nan() == true)
+            return chars_write(first, last, "NaN", 3);
+        else if (rep.sign_index() == true)
+            return chars_write(first, last, "-Inf", 4);
+        else
+            return chars_write(first, last, "Inf", 3);
+    };
+
+    // zero
+    if (level == 0 || level == -config::max_level - 1)
+        return chars_write_double(first, last, rep.signed_index(), fmt, precision);
+
+    // level k value {k, index}
+    static_assert(config::max_level < 10, "level must have one digit");
+
+    char* pos       = first;
+
+    if (last - pos < 3)
+        return chars_fail(last);
+
+    *pos++          = '{';
+
+    if (level < 0)
+    {
+        *pos++      = '-';
+        level       = -level;
+    };
+
+    *pos++          = char('0' + level);
+
+    if (last - pos < 2)
+        return chars_fail(last);
+
+    *pos++          = ',';
+    *pos++          = ' ';
+
+    to_chars_result res = chars_write_double(pos, last, rep.signed_index(), fmt, precision);
+
+    if (res.ec != std::errc() || res.ptr == last)
+        return chars_fail(last);
+
+    *res.ptr        = '}';
+    return to_chars_result{res.ptr + 1, std::errc()};
+};
+
+//----------------------------------------------------------------------
+//                        to_chars
+//----------------------------------------------------------------------
+GSLI_INLINE
+to_chars_result to_chars(char* first, char* last, const gsli_double& x)
+{
+    return chars_write_gsli(first, last, x, chars_format::general, -1);
+};
+
+GSLI_INLINE
+to_chars_result to_chars(char* first, char* last, const gsli_double& x, chars_format fmt)
+{
+    return chars_write_gsli(first, last, x, fmt, -1);
+};
+
+GSLI_INLINE
+to_chars_result to_chars(char* first, char* last, const gsli_double& x, chars_format fmt,
+                         int precision)
+{
+    gsli_assert(precision >= 0, "invalid precision");
+    return chars_write_gsli(first, last, x, fmt, precision);
+};
+
+//----------------------------------------------------------------------
+//                        parsing helpers
+//----------------------------------------------------------------------
+// maximum number of decimal numbers in a nested exponent notation
+static const int chars_max_segments     = 9;
+
+static const double chars_ln10          = 2.30258509299404568402;
+
+// decimal number without exponent, i.e. a part of nested exponent
+// notation; value is m_sign * m_mant * 10^m_adj
+struct chars_segment
+{
+    const char* m_first;
+    const char* m_last;
+    double      m_sign;
+    double      m_mant;
+    int64_t     m_adj;
+};
+
+static from_chars_result chars_invalid(const char* first)
+{
+    return from_chars_result{first, std::errc::invalid_argument};
+};
+
+static bool chars_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+};
+
+static char chars_lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+};
+
+// return true if [first, last) starts with a lowercase word str ignoring
+// case
+static bool chars_match(const char* first, const char* last, const char* str)
+{
+    for (; *str != 0; ++str, ++first)
+    {
+        if (first == last || chars_lower(*first) != *str)
+            return false;
+    };
+
+    return true;
+};
+
+static const char* chars_skip_ws(const char* first, const char* last)
+{
+    while (first != last && (*first == ' ' || *first == '\t'))
+        ++first;
+
+    return first;
+};
+
+// scan a signed decimal number ddd.ddd; if sign_plus is true, then also
+// leading + is accepted; return null if there are no digits; first 19
+// significant digits are accumulated in an integer, remaining digits
+// only change the exponent
+static const char* chars_scan_segment(const char* first, const char* last, bool sign_plus,
+                                      chars_segment& seg)
+{
+    const char* pos = first;
+    seg.m_first     = first;
+    seg.m_sign      = 1.0;
+
+    if (pos != last && (*pos == '-' || (*pos == '+' && sign_plus == true)))
+    {
+        seg.m_sign  = (*pos == '-') ? -1.0 : 1.0;
+        ++pos;
+    };
+
+    uint64_t mant   = 0;
+    int64_t adj     = 0;
+    int n_sig       = 0;
+    int n_digits    = 0;
+    bool frac       = false;
+
+    for (; pos != last; ++pos)
+    {
+        if (*pos == '.' && frac == false)
+        {
+            frac    = true;
+            continue;
+        };
+
+        if (chars_is_digit(*pos) == false)
+            break;
+
+        ++n_digits;
+
+        if (n_sig < 19)
+        {
+            mant    = mant * 10 + uint64_t(*pos - '0');
+            n_sig   += (mant != 0) ? 1 : 0;
+            adj     -= (frac == true) ? 1 : 0;
+        }
+        else if (frac == false)
+        {
+            adj     += 1;
+        };
+    };
+
+    if (n_digits == 0)
+        return nullptr;
+
+    seg.m_last      = pos;
+    seg.m_mant      = double(mant);
+    seg.m_adj       = adj;
+    return pos;
+};
+
+// return true if x is zero or a normal number; denormal numbers
+// returned by std::from_chars are less accurate than gsli_double
+static bool chars_is_normal(double x)
+{
+    return x == 0.0 || std::abs(x) >= std::numeric_limits<double>::min();
+};
+
+// set val to s * 10^exponent correctly rounded; return false if the
+// exponent is not a small integer or the result is not in the range of
+// doubles
+static bool chars_exact_pow10(const chars_segment& s, const gsli_double& exponent,
+                              double& val)
+{
+    double e        = exponent.get_value();
+
+    if (!(std::abs(e) <= 100000.0) || e != std::floor(e))
+        return false;
+
+    // build text ddd.ddde<exponent> and parse it with std::from_chars
+    char buf[96];
+    const char* first   = s.m_first + (*s.m_first == '+' ? 1 : 0);
+    size_t length       = size_t(s.m_last - first);
+
+    if (length > 64)
+        return false;
+
+    std::memcpy(buf, first, length);
+    buf[length]         = 'e';
+
+    std::to_chars_result res_e  = std::to_chars(buf + length + 1, buf + sizeof(buf), 
+                                                int64_t(e));
+    std::from_chars_result res  = std::from_chars(buf, res_e.ptr, val);
+
+    return res.ec == std::errc() && res.ptr == res_e.ptr && chars_is_normal(val) == true;
+};
+
+// parse {k, index}
+static from_chars_result chars_parse_level(const char* first, const char* last, 
+                                           gsli_double& x)
+{
+    const char* pos = chars_skip_ws(first + 1, last);
+
+    int level;
+    std::from_chars_result res_lev  = std::from_chars(pos, last, level);
+
+    if (res_lev.ec != std::errc())
+        return chars_invalid(first);
+
+    // only levels of representable numbers are accepted
+    const int max_level = gsli_double::config_type::max_level;
+
+    if (level < -max_level || level > max_level)
+        return chars_invalid(first);
+
+    pos             = chars_skip_ws(res_lev.ptr, last);
+
+    if (pos == last || *pos != ',')
+        return chars_invalid(first);
+
+    pos             = chars_skip_ws(pos + 1, last);
+
+    double index;
+    std::from_chars_result res_ind  = std::from_chars(pos, last, index);
+
+    if (res_ind.ec != std::errc())
+        return chars_invalid(first);
+
+    pos             = chars_skip_ws(res_ind.ptr, last);
+
+    if (pos == last || *pos != '}')
+        return chars_invalid(first);
+
+    x               = (level == 0) ? gsli_double(index) : gsli_double(level, index);
+    return from_chars_result{pos + 1, std::errc()};
+};
+
+// parse decimal number with nested exponents
+static from_chars_result chars_parse_nested(const char* first, const char* last,
+                                            gsli_double& x)
+{
+    chars_segment seg[chars_max_segments];
+    int n_seg       = 0;
+
+    const char* pos = chars_scan_segment(first, last, false, seg[0]);
+
+    if (pos == nullptr)
+        return chars_invalid(first);
+
+    n_seg           = 1;
+
+    // exponent is accepted only if it is followed by a number
+    while (pos != last && (*pos == 'e' || *pos == 'E') && n_seg < chars_max_segments)
+    {
+        const char* next    = chars_scan_segment(pos + 1, last, true, seg[n_seg]);
+
+        if (next == nullptr)
+            break;
+
+        pos         = next;
+        ++n_seg;
+    };
+
+    // decimal numbers in the range of normal doubles are correctly
+    // rounded by std::from_chars
+    if (n_seg <= 2)
+    {
+        double val;
+        std::from_chars_result res  = std::from_chars(first, pos, val);
+
+        if (res.ec == std::errc() && res.ptr == pos && chars_is_normal(val) == true)
+        {
+            x       = gsli_double(val);
+            return from_chars_result{pos, std::errc()};
+        };
+    };
+
+    // evaluate from the last exponent: v_i = m_i * 10^(adj_i + v_{i+1});
+    // the last number has no exponent and is read exactly if possible
+    gsli_double exponent;
+    const chars_segment& seg_last   = seg[n_seg - 1];
+    double val_last;
+
+    std::from_chars_result res_last = std::from_chars(seg_last.m_first + 
+                    (*seg_last.m_first == '+' ? 1 : 0), seg_last.m_last, val_last);
+
+    if (n_seg > 1 && res_last.ec == std::errc() && res_last.ptr == seg_last.m_last
+            && chars_is_normal(val_last) == true)
+    {
+        exponent    = gsli_double(val_last);
+        --n_seg;
+    };
+
+    for (int i = n_seg - 1; i >= 0; --i)
+    {
+        const chars_segment& s  = seg[i];
+        double val;
+
+        if (s.m_mant == 0.0)
+        {
+            exponent    = gsli_double(0.0);
+        }
+        else if (chars_exact_pow10(s, exponent, val) == true)
+        {
+            exponent    = gsli_double(val);
+        }
+        else
+        {
+            gsli_double p10 = exp((exponent + double(s.m_adj)) * chars_ln10);
+            exponent    = s.m_sign * s.m_mant * p10;
+        };
+    };
+
+    if (seg[0].m_mant != 0.0 && (is_zero(exponent) == true || is_inf(exponent) == true))
+        return from_chars_result{pos, std::errc::result_out_of_range};
+
+    x               = exponent;
+
+    if (seg[0].m_mant == 0.0)
+        x           = gsli_double(seg[0].m_sign * 0.0);
+
+    return from_chars_result{pos, std::errc()};
+};
+
+static from_chars_result chars_parse_gsli(const char* first, const char* last, 
+                                          gsli_double& x, chars_format fmt)
+{
+    if (first == last)
+        return chars_invalid(first);
+
+    if (*first == '{')
+        return chars_parse_level(first, last, x);
+
+    bool neg        = *first == '-';
+    const char* pos = neg ? first + 1 : first;
+
+    if (chars_match(pos, last, "inf") == true)
+    {
+        pos         += chars_match(pos, last, "infinity") ? 8 : 3;
+        x           = gsli_double::make_infinity(neg);
+        return from_chars_result{pos, std::errc()};
+    };
+
+    if (chars_match(pos, last, "nan") == true)
+    {
+        x           = gsli_double::make_nan();
+        return from_chars_result{pos + 3, std::errc()};
+    };
+
+    if (fmt == chars_format::general)
+        return chars_parse_nested(first, last, x);
+
+    double val;
+    std::from_chars_result res  = std::from_chars(first, last, val, to_std_format(fmt));
+
+    if (res.ec == std::errc::invalid_argument)
+        return chars_invalid(first);
+
+    if (res.ec != std::errc())
+        return from_chars_result{res.ptr, res.ec};
+
+    x               = gsli_double(val);
+    return from_chars_result{res.ptr, std::errc()};
+};
+
+//----------------------------------------------------------------------
+//                        from_chars
+//----------------------------------------------------------------------
+GSLI_INLINE
+from_chars_result from_chars(const char* first, const char* last, gsli_double& x)
+{
+    return chars_parse_gsli(first, last, x, chars_format::general);
+};
+
+GSLI_INLINE
+from_chars_result from_chars(const char* first, const char* last, gsli_double& x,
+                             chars_format fmt)
+{
+    return chars_parse_gsli(first, last, x, fmt);
+};
+
+//----------------------------------------------------------------------
+//                        tower helpers
+//----------------------------------------------------------------------
+// a positive number x on level k > 0 with index i is decoded as 
+// ln(x) = y_k + c0, where y_1 = i and y_j = exp(y_{j-1} + c1) for
+// j > 1; numbers on level -k are decoded as ln(x) = -(y_k + c0n)
+using chars_config                  = gsli_double::config_type;
+
+static const double chars_lnln10    = std::log(chars_ln10);
+static const double chars_c0        = std::log(chars_config::max_index_0)
+                                    - chars_config::min_index_1;
+static const double chars_c0n       = -std::log(chars_config::min_index_0)
+                                    - chars_config::min_index_1;
+static const double chars_c1        = std::log(chars_config::max_index_1)
+                                    - chars_config::min_index_1;
+
+// exponents larger than this value are written as towers; fractional
+// part of a larger exponent is not accurate enough to give one digit
+// of the mantissa
+static const double chars_max_exp   = 1.0e14;
+
+// write 10^z as m e E, where E = floor(z)
+static to_chars_result chars_write_pow10(char* first, char* last, double z, int digits)
+{
+    double e        = std::floor(z);
+
+    // leading digits of the exponent are not available in the mantissa
+    int n_exp       = (std::abs(e) < 1.0) ? 1 : int(std::log10(std::abs(e))) + 1;
+    int prec        = std::max(1, std::min(digits, 15 - n_exp));
+    double m        = std::pow(10.0, z - e);
+
+    // mantissa is written as d.ddde+00, or as 1.000e+01 if rounded up
+    char buf[32];
+    std::to_chars_result res    = std::to_chars(buf, buf + sizeof(buf), m, 
+                                        std::chars_format::scientific, prec - 1);
+
+    char* pos_e     = std::find(buf, res.ptr, 'e');
+
+    if (std::strncmp(pos_e, "e+01", 4) == 0)
+        e           += 1.0;
+
+    // remove trailing zeros
+    char* end       = pos_e;
+
+    if (std::find(buf, pos_e, '.') != pos_e)
+    {
+        while (end[-1] == '0')
+            --end;
+
+        if (end[-1] == '.')
+            --end;
+    };
+
+    size_t length   = size_t(end - buf);
+
+    if (size_t(last - first) < length + 1)
+        return chars_fail(last);
+
+    std::memcpy(first, buf, length);
+    first[length]   = 'e';
+
+    std::to_chars_result res_e  = std::to_chars(first + length + 1, last, int64_t(e));
+
+    if (res_e.ec != std::errc())
+        return chars_fail(last);
+
+    return to_chars_result{res_e.ptr, std::errc()};
+};
+
+static to_chars_result chars_write_tower(char* first, char* last, const gsli_double& x,
+                                         int digits)
+{
+    const double& v = x.get_internal_rep();
+
+    if (details::is_level_0(v) == true)
+        return chars_write_double(first, last, v, chars_format::general, digits);
+
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+
+    size_t level;
+    bool sign_level;
+    rep.level_sign(level, sign_level);
+
+    // special values and zero
+    if (level == 0 || level == size_t(chars_config::max_level + 1))
+        return chars_write_gsli(first, last, x, chars_format::general, digits);
+
+    // find the last finite y_p
+    double y        = rep.index();
+    size_t p        = 1;
+
+    for (; p < level; ++p)
+    {
+        double y_next   = std::exp(y + chars_c1);
+
+        if (y_next == std::numeric_limits<double>::infinity())
+            break;
+
+        y           = y_next;
+    };
+
+    // iterated decimal logarithms z_1 = log10(|x|), z_j = log10(z_{j-1});
+    // z_k is the first finite value; if y_{p+1} is not finite, then 
+    // z_{k-1} is not finite and ln(ln(z_{k-2})) = y_p + c1 up to
+    // negligible terms
+    double z;
+    size_t k;
+
+    if (p == level)
+    {
+        z           = (y + (sign_level ? chars_c0n : chars_c0)) / chars_ln10;
+        k           = 1;
+    }
+    else
+    {
+        z           = (y + chars_c1 - chars_lnln10) / chars_ln10;
+        k           = level - p + 1;
+    };
+
+    while (z >= chars_max_exp)
+    {
+        z           = std::log10(z);
+        ++k;
+    };
+
+    char* pos       = first;
+
+    if (last - pos < 3 * int(k) + 1)
+        return chars_fail(last);
+
+    if (rep.sign_index() == true)
+        *pos++      = '-';
+
+    if (k == 1)
+        return chars_write_pow10(pos, last, sign_level ? -z : z, digits);
+
+    // |x| = 10^(+-z_1), z_j = 10^z_{j+1}
+    *pos++          = '1';
+    *pos++          = 'e';
+
+    if (sign_level == true)
+        *pos++      = '-';
+
+    for (size_t j = 2; j < k; ++j)
+    {
+        *pos++      = '1';
+        *pos++      = 'e';
+    };
+
+    return chars_write_pow10(pos, last, z, digits);
+};
+
+//----------------------------------------------------------------------
+//                        to_chars_tower
+//----------------------------------------------------------------------
+GSLI_INLINE
+to_chars_result to_chars_tower(char* first, char* last, const gsli_double& x, int digits)
+{
+    gsli_assert(digits >= 1 && digits <= 17, "invalid number of digits");
+    return chars_write_tower(first, last, x, digits);
+};
+
+GSLI_INLINE
+to_chars_result to_chars_tower(char* first, char* last, const gsli_double* x, size_t n,
+                               int digits, char sep)
+{
+    gsli_assert(digits >= 1 && digits <= 17, "invalid number of digits");
+
+    char* pos       = first;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            if (pos == last)
+                return chars_fail(last);
+
+            *pos++  = sep;
+        };
+
+        to_chars_result res = chars_write_tower(pos, last, x[i], digits);
+
+        if (res.ec != std::errc())
+            return res;
+
+        pos         = res.ptr;
+    };
+
+    return to_chars_result{pos, std::errc()};
+};
+
+};
\ No newline at end of file
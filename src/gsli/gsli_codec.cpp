@@ -0,0 +1,502 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_codec.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_batch.h"
+#include "gsli/details/gsli_rep.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        helpers
+//----------------------------------------------------------------------
+static const size_t codec_header_size   = 8;
+
+// number of readable bytes after compressed data required by codec_unpack
+static const size_t codec_padding       = 8;
+
+static const uint64_t codec_frac_mask   = (uint64_t(1) << 52) - 1;
+
+static void codec_store(unsigned char* ptr, uint64_t val, int bytes)
+{
+    for (int i = 0; i < bytes; ++i)
+        ptr[i]  = (unsigned char)(val >> (8 * i));
+};
+
+static uint64_t codec_load(const unsigned char* ptr, int bytes)
+{
+    uint64_t val    = 0;
+
+    for (int i = 0; i < bytes; ++i)
+        val         |= uint64_t(ptr[i]) << (8 * i);
+
+    return val;
+};
+
+static uint64_t codec_bits(const gsli_double& x)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &x.get_internal_rep(), sizeof(bits));
+    return bits;
+};
+
+// return true if x is stored in bit streams
+static bool codec_is_inlier(const gsli_double& x)
+{
+    using config    = gsli_double::config_type;
+
+    // internal representation of level 0 numbers is the value itself
+    double a        = std::abs(x.get_internal_rep());
+    return a == 0.0 || (a >= config::min_index_0 && a <= config::max_index_0);
+};
+
+static int codec_level(const gsli_double& x)
+{
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+    return rep.level();
+};
+
+static int codec_bit_width(uint64_t val)
+{
+    int width   = 0;
+
+    while (val != 0)
+    {
+        ++width;
+        val     >>= 1;
+    };
+
+    return width;
+};
+
+static int codec_trailing_zeros(uint64_t val)
+{
+    int count   = 0;
+
+    while (count < 52 && (val & 1) == 0)
+    {
+        ++count;
+        val     >>= 1;
+    };
+
+    return count;
+};
+
+static size_t codec_stream_bytes(size_t n, int width)
+{
+    return (n * size_t(width) + 7) / 8;
+};
+
+// write n fields of given width (at most 56 bits) to a stream starting
+// at ptr; fields cannot have bits set above width
+static void codec_pack(unsigned char* ptr, const uint64_t* fields, size_t n, int width)
+{
+    // less than 8 bits are pending after each step
+    uint64_t acc    = 0;
+    int pending     = 0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        acc         |= fields[i] << pending;
+        pending     += width;
+
+        while (pending >= 8)
+        {
+            *ptr++  = (unsigned char)acc;
+            acc     >>= 8;
+            pending -= 8;
+        };
+    };
+
+    if (pending > 0)
+        *ptr        = (unsigned char)acc;
+};
+
+// return size of block with n elements starting at ptr, or 0 if block is
+// invalid; avail is number of bytes available
+static size_t codec_block_bytes(const unsigned char* ptr, size_t avail, size_t n)
+{
+    if (avail < codec_header_size)
+        return 0;
+
+    int exp_bits    = ptr[2];
+    int mant_bits   = ptr[3];
+    size_t n_out    = size_t(codec_load(ptr + 4, 2));
+
+    if (exp_bits > 11 || mant_bits > 52 || n_out > n)
+        return 0;
+
+    size_t size     = codec_header_size;
+    size_t n_in     = n - n_out;
+
+    if (n_out > 0)
+    {
+        size_t map_bytes    = (n + 7) / 8;
+
+        if (avail < size + map_bytes)
+            return 0;
+
+        size_t count        = 0;
+
+        for (size_t i = 0; i < n; ++i)
+            count           += (ptr[size + i / 8] >> (i % 8)) & 1;
+
+        if (count != n_in)
+            return 0;
+
+        size                += map_bytes;
+    };
+
+    size            += codec_stream_bytes(n_in, exp_bits);
+    size            += codec_stream_bytes(n_in, mant_bits + 1);
+    size            += n_out * sizeof(double);
+
+    return size <= avail ? size : 0;
+};
+
+//----------------------------------------------------------------------
+//                        compressed_array
+//----------------------------------------------------------------------
+GSLI_INLINE
+compressed_array::compressed_array()
+    : m_size(0), m_data(codec_padding, 0)
+{};
+
+GSLI_INLINE
+void compressed_array::assign(const gsli_double* x, size_t n)
+{
+    using config_type   = gsli_double::config_type;
+
+    size_t n_blocks     = (n + codec_block_size - 1) / codec_block_size;
+
+    m_size              = n;
+    m_offsets.resize(n_blocks);
+    m_data.clear();
+
+    uint64_t exps[codec_block_size];
+    uint64_t mants[codec_block_size];
+    bool inlier[codec_block_size];
+
+    for (size_t k = 0; k < n_blocks; ++k)
+    {
+        const gsli_double* blk  = x + k * codec_block_size;
+        size_t len      = std::min(codec_block_size, n - k * codec_block_size);
+
+        // statistics of inliers
+        uint64_t min_e  = 0x7ff;
+        uint64_t max_e  = 0;
+        uint64_t frac   = 0;
+        size_t n_in     = 0;
+        int min_lev     = config_type::max_level + 1;
+        int max_lev     = -(config_type::max_level + 1);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            inlier[i]       = codec_is_inlier(blk[i]);
+
+            if (inlier[i] == false)
+            {
+                int lev     = codec_level(blk[i]);
+                min_lev     = std::min(min_lev, lev);
+                max_lev     = std::max(max_lev, lev);
+                continue;
+            };
+
+            uint64_t bits   = codec_bits(blk[i]);
+            uint64_t e      = (bits >> 52) & 0x7ff;
+
+            ++n_in;
+            frac            |= bits & codec_frac_mask;
+            min_lev         = std::min(min_lev, 0);
+            max_lev         = std::max(max_lev, 0);
+
+            if (e == 0)
+                continue;
+
+            min_e           = std::min(min_e, e);
+            max_e           = std::max(max_e, e);
+        };
+
+        bool has_nonzero    = max_e != 0;
+        int exp_bits        = has_nonzero ? codec_bit_width(max_e - min_e + 1) : 0;
+        int shift           = frac == 0 ? 52 : codec_trailing_zeros(frac);
+        int mant_bits       = 52 - shift;
+        size_t n_out        = len - n_in;
+        uint64_t base       = has_nonzero ? min_e : 1;
+
+        // split inliers into fields
+        size_t pos          = 0;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            if (inlier[i] == false)
+                continue;
+
+            uint64_t bits   = codec_bits(blk[i]);
+            uint64_t e      = (bits >> 52) & 0x7ff;
+            uint64_t sign   = bits >> 63;
+
+            exps[pos]       = e == 0 ? 0 : e - base + 1;
+            mants[pos]      = (sign << mant_bits) | ((bits & codec_frac_mask) >> shift);
+            ++pos;
+        };
+
+        size_t map_bytes    = n_out > 0 ? (len + 7) / 8 : 0;
+        size_t exp_bytes    = codec_stream_bytes(n_in, exp_bits);
+        size_t mant_bytes   = codec_stream_bytes(n_in, mant_bits + 1);
+        size_t block_bytes  = codec_header_size + map_bytes + exp_bytes + mant_bytes
+                            + n_out * sizeof(double);
+
+        size_t offset       = m_data.size();
+        m_offsets[k]        = offset;
+        m_data.resize(offset + block_bytes, 0);
+
+        unsigned char* ptr  = m_data.data() + offset;
+
+        codec_store(ptr, base, 2);
+        ptr[2]              = (unsigned char)exp_bits;
+        ptr[3]              = (unsigned char)mant_bits;
+        codec_store(ptr + 4, n_out, 2);
+        ptr[6]              = (unsigned char)int8_t(min_lev);
+        ptr[7]              = (unsigned char)int8_t(max_lev);
+        ptr                 += codec_header_size;
+
+        if (n_out > 0)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                if (inlier[i] == true)
+                    ptr[i / 8]  |= (unsigned char)(1 << (i % 8));
+            };
+
+            ptr             += map_bytes;
+        };
+
+        codec_pack(ptr, exps, n_in, exp_bits);
+        ptr                 += exp_bytes;
+
+        codec_pack(ptr, mants, n_in, mant_bits + 1);
+        ptr                 += mant_bytes;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            if (inlier[i] == false)
+            {
+                std::memcpy(ptr, &blk[i], sizeof(double));
+                ptr         += sizeof(double);
+            };
+        };
+    };
+
+    m_data.resize(m_data.size() + codec_padding, 0);
+};
+
+GSLI_INLINE
+size_t compressed_array::compressed_size() const
+{
+    return m_data.size() - codec_padding + m_offsets.size() * sizeof(uint64_t);
+};
+
+GSLI_INLINE
+size_t compressed_array::decode_block(size_t k, gsli_double* res) const
+{
+    gsli_assert(k < m_offsets.size(), "invalid block index");
+
+    size_t len          = block_length(k);
+    const unsigned char* ptr    = m_data.data() + size_t(m_offsets[k]);
+
+    int exp_base        = int(codec_load(ptr, 2));
+    int exp_bits        = ptr[2];
+    int mant_bits       = ptr[3];
+    size_t n_out        = size_t(codec_load(ptr + 4, 2));
+    size_t n_in         = len - n_out;
+
+    const unsigned char* map    = ptr + codec_header_size;
+    const unsigned char* exps   = map + (n_out > 0 ? (len + 7) / 8 : 0);
+    const unsigned char* mants  = exps + codec_stream_bytes(n_in, exp_bits);
+    const unsigned char* outs   = mants + codec_stream_bytes(n_in, mant_bits + 1);
+
+    uint64_t bits[codec_block_size];
+    details::codec_unpack(exps, mants, exp_bits, mant_bits, exp_base, bits, n_in);
+
+    // gsli_double is not trivial, but its representation is a double;
+    // bits are copied through untyped pointer
+    void* dst           = res;
+
+    if (n_out == 0)
+    {
+        std::memcpy(dst, bits, len * sizeof(double));
+        return len;
+    };
+
+    size_t pos_in       = 0;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        void* dst_i     = res + i;
+
+        if ((map[i / 8] >> (i % 8)) & 1)
+        {
+            std::memcpy(dst_i, bits + pos_in, sizeof(double));
+            ++pos_in;
+        }
+        else
+        {
+            std::memcpy(dst_i, outs, sizeof(double));
+            outs        += sizeof(double);
+        };
+    };
+
+    return len;
+};
+
+GSLI_INLINE
+void compressed_array::decode(gsli_double* res) const
+{
+    for (size_t k = 0; k < m_offsets.size(); ++k)
+        decode_block(k, res + k * codec_block_size);
+};
+
+GSLI_INLINE
+gsli_double compressed_array::get(size_t i) const
+{
+    gsli_assert(i < m_size, "invalid index");
+
+    gsli_double buf[codec_block_size];
+    decode_block(i / codec_block_size, buf);
+
+    return buf[i % codec_block_size];
+};
+
+GSLI_INLINE
+void compressed_array::write(std::ostream& os) const
+{
+    unsigned char buf[array_header_size];
+    write_array_header(array_header::make(m_size, array_encoding::block_codec), buf);
+    os.write((const char*)buf, array_header_size);
+
+    codec_store(buf, m_data.size() - codec_padding, 8);
+    os.write((const char*)buf, 8);
+
+    for (uint64_t off : m_offsets)
+    {
+        codec_store(buf, off, 8);
+        os.write((const char*)buf, 8);
+    };
+
+    os.write((const char*)m_data.data(), std::streamsize(m_data.size() - codec_padding));
+};
+
+GSLI_INLINE
+array_status compressed_array::read(std::istream& is)
+{
+    unsigned char buf[array_header_size];
+
+    if (!is.read((char*)buf, array_header_size))
+        return array_status::io_error;
+
+    array_header h;
+    array_status st = read_array_header(buf, h);
+
+    if (st != array_status::ok)
+        return st;
+
+    if (h.m_encoding != array_encoding::block_codec)
+        return array_status::bad_encoding;
+
+    // skip padding, see read_array
+    uint64_t pad        = h.m_data_offset - array_header_size;
+
+    if (pad > uint64_t(std::numeric_limits<std::streamsize>::max()))
+        return array_status::bad_version;
+
+    is.ignore(std::streamsize(pad));
+
+    if (is.gcount() != std::streamsize(pad) || !is.read((char*)buf, 8))
+        return array_status::truncated;
+
+    uint64_t data_size  = codec_load(buf, 8);
+    uint64_t n_blocks   = (h.m_size + codec_block_size - 1) / codec_block_size;
+
+    // every block has a header; this bounds allocations below
+    if (h.m_size > uint64_t(-1) - codec_block_size 
+        || data_size < n_blocks * codec_header_size
+        || data_size > size_t(-1) - codec_padding)
+    {
+        return array_status::truncated;
+    };
+
+    std::vector<uint64_t> offsets;
+
+    for (uint64_t k = 0; k < n_blocks; ++k)
+    {
+        if (!is.read((char*)buf, 8))
+            return array_status::truncated;
+
+        offsets.push_back(codec_load(buf, 8));
+    };
+
+    // read in bounded chunks, see read_array
+    const size_t chunk  = size_t(1) << 23;
+    std::vector<unsigned char> data;
+
+    while (data.size() < data_size)
+    {
+        size_t pos      = data.size();
+        size_t count    = std::min(size_t(data_size) - pos, chunk);
+        data.resize(pos + count);
+
+        if (!is.read((char*)(data.data() + pos), std::streamsize(count)))
+            return array_status::truncated;
+    };
+
+    // validate all blocks, decoding can then be performed without checks
+    for (uint64_t k = 0; k < n_blocks; ++k)
+    {
+        uint64_t first  = k * codec_block_size;
+        size_t len      = size_t(std::min(uint64_t(codec_block_size), h.m_size - first));
+
+        if (offsets[k] >= data_size)
+            return array_status::truncated;
+
+        size_t off      = size_t(offsets[k]);
+
+        if (codec_block_bytes(data.data() + off, data.size() - off, len) == 0)
+            return array_status::truncated;
+    };
+
+    data.resize(data.size() + codec_padding, 0);
+
+    m_size              = size_t(h.m_size);
+    m_offsets.swap(offsets);
+    m_data.swap(data);
+
+    return array_status::ok;
+};
+
+};
\ No newline at end of file
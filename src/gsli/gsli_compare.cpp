@@ -24,7 +24,8 @@
 namespace sli
 {
 
-bool sli::cmp_eq(const gsli_rep& v1, const gsli_rep& v2)
+GSLI_INLINE
+bool cmp_eq(const gsli_rep& v1, const gsli_rep& v2)
 {
     if (v1.level() != v2.level())
         return false;
@@ -38,12 +39,14 @@ bool sli::cmp_eq(const gsli_rep& v1, const gsli_rep& v2)
     return true;
 };
 
-bool sli::cmp_neq(const gsli_rep& v1, const gsli_rep& v2)
+GSLI_INLINE
+bool cmp_neq(const gsli_rep& v1, const gsli_rep& v2)
 {
     return !cmp_eq(v1, v2);
 };
 
-bool sli::cmp_gt(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+bool cmp_gt(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
 	if (rep_p.level() == 0 && rep_q.level() == 0)
 		return rep_p.signed_index() > rep_q.signed_index();
@@ -112,7 +115,8 @@ bool sli::cmp_gt(const gsli_rep& rep_p, const gsli_rep& rep_q)
     }
 }
 
-bool sli::cmp_lt(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+bool cmp_lt(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
 	if (rep_p.level() == 0 && rep_q.level() == 0)
 		return rep_p.signed_index() < rep_q.signed_index();
@@ -181,7 +185,8 @@ bool sli::cmp_lt(const gsli_rep& rep_p, const gsli_rep& rep_q)
     }
 }
 
-bool sli::cmp_leq(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+bool cmp_leq(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
 	if (rep_p.level() == 0 && rep_q.level() == 0)
 		return rep_p.signed_index() <= rep_q.signed_index();
@@ -250,7 +255,8 @@ bool sli::cmp_leq(const gsli_rep& rep_p, const gsli_rep& rep_q)
     }
 }
 
-bool sli::cmp_geq(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+bool cmp_geq(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
 	if (rep_p.level() == 0 && rep_q.level() == 0)
 		return rep_p.signed_index() >= rep_q.signed_index();
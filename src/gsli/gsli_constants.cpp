@@ -20,15 +20,20 @@
 
 #include "gsli/details/gsli_constants.h"
 #include "gsli/details/gsli_rep.h"
+#include "gsli/details/gsli_math.h"
 
 #include <iostream>
+#include <cstring>
 
-#pragma warning(push)
-#pragma warning(disable: 4127)  // conditional expression is constant
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable: 4127)  // conditional expression is constant
+#endif
 
 namespace sli
 {
 
+GSLI_INLINE
 void global_constants::initialize()
 {
     m_int_sign_arr[0]       = 1;
@@ -47,8 +52,12 @@ void global_constants::initialize()
 
     if (use_decode_table == true)
         initialize_decode_exp(m_decode_exp);
+
+    initialize_ordinal();
+    initialize_batch();
 };
 
+GSLI_INLINE
 void global_constants::init_pow2_pplevel(double* data0)
 {
     using config                = config_type;
@@ -74,6 +83,7 @@ void global_constants::init_pow2_pplevel(double* data0)
     data[max_lev+1] = 1.0;
 };
 
+GSLI_INLINE
 void global_constants::init_pow2_mplevel(double* data0)
 {
     using config                = config_type;
@@ -99,6 +109,7 @@ void global_constants::init_pow2_mplevel(double* data0)
     data[max_lev+1] = -1.0;
 };
 
+GSLI_INLINE
 void global_constants::init_pow2_pmlevel(double* data0)
 {
     using config                = config_type;
@@ -123,6 +134,7 @@ void global_constants::init_pow2_pmlevel(double* data0)
     data[-max_lev-1]= 1.0;
 };
 
+GSLI_INLINE
 void global_constants::init_pow2_mmlevel(double* data0)
 {
     using config                = config_type;
@@ -147,6 +159,7 @@ void global_constants::init_pow2_mmlevel(double* data0)
     data[-max_lev-1]= -1.0;
 };
 
+GSLI_INLINE
 void global_constants::initialize_pow2_pos_decode(double* pow_ptr0)
 {
     using config                = config_type;
@@ -170,6 +183,7 @@ void global_constants::initialize_pow2_pos_decode(double* pow_ptr0)
     pow_ptr[max_lev + 1]        = 1.0;
 };
 
+GSLI_INLINE
 void global_constants::initialize_pow2_neg_decode(double* pow_ptr0)
 {
     using config                = config_type;
@@ -191,6 +205,7 @@ void global_constants::initialize_pow2_neg_decode(double* pow_ptr0)
     pow_ptr[-max_lev - 1]       = 1.0;
 };
 
+GSLI_INLINE
 void global_constants::initialize_decode_exp(int* data)
 {
     using config                = config_type;
@@ -248,14 +263,88 @@ void global_constants::initialize_decode_exp(int* data)
     }
 };
 
+using details::math_kernel::get_bits;
+
+GSLI_INLINE
+void global_constants::initialize_ordinal()
+{
+    using config                = config_type;
+    static const int max_lev    = config::max_level;
+
+    int pos_0                   = max_lev + 1;
+
+    // encoded absolute values on level k form a continuous range of
+    // bit patterns; ranges on consecutive levels are separated by unused
+    // bit patterns; on negative levels encoded values are decreasing,
+    // when represented values are increasing
+
+    // zero level
+    m_band_first[0]             = get_bits(0.0);
+    m_band_last[0]              = get_bits(0.0);
+    m_ord_base[0]               = 0;
+    m_ord_dir[0]                = 0;
+    m_ord_first[0]              = 0;
+
+    int64_t ord                 = 1;
+
+    for (int lev = -max_lev; lev <= max_lev; ++lev)
+    {
+        int pos                 = pos_0 + lev;
+
+        double first            = config::min_index_0;
+        double last             = config::max_index_0;
+
+        if (lev != 0)
+        {
+            first               = config::min_index_1r * m_encode_data[pos];
+            last                = config::max_index_1 * m_encode_data[pos];
+        };
+
+        m_band_first[pos]       = get_bits(first);
+        m_band_last[pos]        = get_bits(last);
+        m_ord_first[pos]        = ord;
+
+        if (lev < 0)
+        {
+            m_ord_base[pos]     = ord + int64_t(m_band_last[pos]);
+            m_ord_dir[pos]      = -1;
+        }
+        else
+        {
+            m_ord_base[pos]     = ord - int64_t(m_band_first[pos]);
+            m_ord_dir[pos]      = 1;
+        };
+
+        ord                     += int64_t(m_band_last[pos] - m_band_first[pos]) + 1;
+    };
+
+    // inf level
+    int pos_inf                 = pos_0 + max_lev + 1;
+
+    m_band_first[pos_inf]       = get_bits(config::inf);
+    m_band_last[pos_inf]        = get_bits(config::inf);
+    m_ord_base[pos_inf]         = ord;
+    m_ord_dir[pos_inf]          = 0;
+    m_ord_first[pos_inf]        = ord;
+};
+
+GSLI_INLINE
+void global_constants::initialize_batch()
+{
+    m_batch_isa                 = details::select_batch_isa();
+    details::init_batch_kernels(m_batch_isa, m_batch_kernels);
+};
+
+GSLI_INLINE
 void global_constants::destroy()
 {};
 
-global_constants g_global_constants;
+GSLI_INLINE global_constants g_global_constants;
 
 // nifty counter
-static int g_counter = 0;
+GSLI_STATIC_VAR int g_counter = 0;
 
+GSLI_INLINE
 global_constants_initializer::global_constants_initializer()
 {
     if (g_counter == 0)
@@ -264,6 +353,7 @@ global_constants_initializer::global_constants_initializer()
     ++g_counter;
 };
 
+GSLI_INLINE
 global_constants_initializer::~global_constants_initializer()
 {
     --g_counter;
@@ -274,4 +364,6 @@ global_constants_initializer::~global_constants_initializer()
 
 };
 
-#pragma warning(pop)
\ No newline at end of file
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
\ No newline at end of file
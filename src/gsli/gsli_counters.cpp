@@ -0,0 +1,144 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_counters.h"
+
+#include <iostream>
+#include <iomanip>
+
+namespace sli
+{
+
+GSLI_INLINE thread_local path_counters details::g_path_counters = {};
+
+//----------------------------------------------------------------------
+//                        path_counters
+//----------------------------------------------------------------------
+GSLI_INLINE
+path_counters& path_counters::operator+=(const path_counters& other)
+{
+    for (int i = 0; i < n_op; ++i)
+    for (int j = 0; j < n_path; ++j)
+        m_count[i][j]   += other.m_count[i][j];
+
+    return *this;
+};
+
+GSLI_INLINE
+bool path_counters_enabled()
+{
+    #ifdef GSLI_COUNTERS
+        return true;
+    #else
+        return false;
+    #endif
+};
+
+GSLI_INLINE
+path_counters get_path_counters()
+{
+    return details::g_path_counters;
+};
+
+GSLI_INLINE
+void reset_path_counters()
+{
+    details::g_path_counters = path_counters();
+};
+
+GSLI_INLINE
+const char* counter_op_name(counter_op op)
+{
+    switch (op)
+    {
+        case counter_op::plus:      return "plus";
+        case counter_op::mult:      return "mult";
+        case counter_op::div:       return "div";
+        case counter_op::pow_abs:   return "pow_abs";
+        case counter_op::pow_int:   return "pow_int";
+        case counter_op::inv:       return "inv";
+        case counter_op::exp:       return "exp";
+        case counter_op::log:       return "log";
+        case counter_op::cmp:       return "cmp";
+        default:                    return "unknown";
+    };
+};
+
+GSLI_INLINE
+const char* counter_path_name(counter_path path)
+{
+    switch (path)
+    {
+        case counter_path::fast:        return "fast";
+        case counter_path::level_0:     return "level_0";
+        case counter_path::level_0_k:   return "level_0_k";
+        case counter_path::level_k:     return "level_k";
+        case counter_path::special:     return "special";
+        default:                        return "unknown";
+    };
+};
+
+//----------------------------------------------------------------------
+//                        printing
+//----------------------------------------------------------------------
+GSLI_INLINE
+std::ostream& operator<<(std::ostream& os, const path_counters& counters)
+{
+    const int w_op      = 10;
+    const int w_count   = 12;
+    const int n_path    = path_counters::n_path;
+
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    os << std::left << std::setw(w_op) << "op" << std::right;
+
+    for (int j = 0; j < n_path; ++j)
+        os << std::setw(w_count) << counter_path_name(counter_path(j));
+
+    os << std::setw(w_count) << "fast %" << "\n";
+
+    for (int i = 0; i < path_counters::n_op; ++i)
+    {
+        counter_op op   = counter_op(i);
+        uint64_t fast   = counters.get(op, counter_path::fast);
+        uint64_t total  = fast + counters.get_general(op);
+
+        if (total == 0)
+            continue;
+
+        os << std::left << std::setw(w_op) << counter_op_name(op) << std::right;
+
+        for (int j = 0; j < n_path; ++j)
+            os << std::setw(w_count) << counters.get(op, counter_path(j));
+
+        double ratio    = 100.0 * double(fast) / double(total);
+
+        os << std::setw(w_count) << std::fixed << std::setprecision(2) << ratio 
+           << "\n";
+
+        os.flags(flags);
+        os.precision(prec);
+    };
+
+    return os;
+};
+
+};
\ No newline at end of file
@@ -20,7 +20,9 @@
 
 #include "gsli/gsli_double.h"
 #include "gsli/gsli_functions.h"
+#include "gsli/gsli_flags.h"
 
+#include <cmath>
 #include <limits>
 #include <iostream>
 
@@ -30,6 +32,7 @@ namespace sli
 //----------------------------------------------------------------------
 //                        gsli_double
 //----------------------------------------------------------------------
+GSLI_INLINE
 gsli_double::gsli_double(int level, double index)    
 {
     bool sign_index;
@@ -38,6 +41,7 @@ gsli_double::gsli_double(int level, double index)
     encode_data_normalize(m_data, sign_index, level);
 }
 
+GSLI_INLINE
 void gsli_double::build_gsli(double abs_a, bool is_neg)
 {
 	if (abs_a == 0.0)
@@ -79,6 +83,111 @@ void gsli_double::build_gsli(double abs_a, bool is_neg)
     };
 }
 
+// return t * log(2) + log_m, where t is an integer; the product is 
+// computed in double-double precision, thus cancellation of t * log(2)
+// and log_m does not increase the error
+static double mant_exp_log(double t, double log_m)
+{
+    // log(2) = log_2_hi + log_2_lo
+    static const double log_2_hi    = 6.93147180559945286227e-01;
+    static const double log_2_lo    = 2.319046813846299558e-17;
+
+    // t * log_2_hi = prod + err is computed by Dekker's algorithm; factors
+    // are split into 26-bit halves; fma is not used, since it is slow if 
+    // not supported by hardware, and results should not depend on it
+    static const double split       = 134217729.0;
+
+    double c        = split * log_2_hi;
+    double c_hi     = c - (c - log_2_hi);
+    double c_lo     = log_2_hi - c_hi;
+
+    double p        = split * t;
+    double t_hi     = p - (p - t);
+    double t_lo     = t - t_hi;
+
+    double prod     = t * log_2_hi;
+    double err      = ((t_hi * c_hi - prod) + t_hi * c_lo + t_lo * c_hi) + t_lo * c_lo;
+    err             = err + t * log_2_lo;
+
+    return (prod + log_m) + err;
+};
+
+GSLI_INLINE
+gsli_double::gsli_double(double mant, int64_t exp, mant_exp)
+{
+    if (mant == 0.0 || std::abs(mant) > std::numeric_limits<double>::max()
+        || details::is_nan(mant) == true)
+    {
+        *this       = gsli_double(mant);
+        return;
+    };
+
+    // mant = m * 2^e_m, 0.5 <= |m| < 1
+    int e_m;
+    double m        = std::frexp(mant, &e_m);
+    bool is_neg     = m < 0.0;
+    double abs_m    = std::abs(m);
+
+    // |x| is in [2^(e - 1), 2^e); for large |exp| the exponent is not 
+    // exact, but then rounding errors are smaller than resolution of
+    // indices
+    const int64_t lim   = int64_t(1) << 53;
+    bool exact          = exp > -lim && exp < lim;
+    int64_t e           = exact ? exp + e_m : 0;
+    double e_d          = exact ? double(e) : double(exp) + double(e_m);
+
+    const int exp_0     = config_type::max_index_exp_0;
+
+    // MIN_0 = 2^-exp_0 <= |x| <= MAX_0 = 2^exp_0
+    if (exact == true && e >= 1 - exp_0 && e <= exp_0)
+    {
+        m_data      = std::ldexp(m, int(e));
+        return;
+    };
+
+    if (exact == true && e == exp_0 + 1 && abs_m == 0.5)
+    {
+        m_data      = details::signed_value(is_neg, config_type::max_index_0);
+        return;
+    };
+
+    double log_m    = std::log(abs_m);
+
+    if (e_d > 0.0)
+    {
+        // log(|x|/MAX_0) = log(|m|) + (e - exp_0) * log(2)
+        double log_off  = mant_exp_log(e_d - exp_0, log_m);
+        build_gsli_log(log_off, 1, is_neg);
+    }
+    else
+    {
+        // -log(|x|*MAX_0) = -log(|m|) - (e + exp_0) * log(2)
+        double log_off  = -mant_exp_log(e_d + exp_0, log_m);
+        build_gsli_log(log_off, -1, is_neg);
+    };
+};
+
+GSLI_INLINE
+void gsli_double::build_gsli_log(double log_off, int sign_level, bool is_neg)
+{
+    double index    = log_off + config_type::min_index_1;
+    int level       = 1;
+
+    if (index <= config_type::min_index_1)
+    {
+        // this value should be rounded to max or min on level 0
+        m_data      = sign_level > 0 ? config_type::max_index_0 : config_type::min_index_0;
+        m_data      = details::signed_value(is_neg, m_data);
+        return;
+    };
+
+    gsli_rep::calc_level_index(index, level, 1);
+
+    m_data          = index;
+    encode_data_normalize(m_data, is_neg, sign_level * level);
+};
+
+GSLI_INLINE
 double gsli_double::encode_data_inf(bool sign)
 {
     // regular values are mapped to regular double values;
@@ -90,6 +199,7 @@ double gsli_double::encode_data_inf(bool sign)
         return std::numeric_limits<double>::infinity();
 }
 
+GSLI_INLINE
 double gsli_double::encode_data_nan()
 {
     // regular values are mapped to regular double values;
@@ -98,6 +208,7 @@ double gsli_double::encode_data_nan()
     return std::numeric_limits<double>::quiet_NaN();
 }
 
+GSLI_INLINE
 void gsli_double::encode_data_normalize(double& index, bool sign_index, int signed_level)
 {
     // rep requires, that index is not too small
@@ -107,11 +218,20 @@ void gsli_double::encode_data_normalize(double& index, bool sign_index, int sign
     if (std::abs(signed_level) > config_type::max_level)
     {
         if (signed_level < 0)
+        {
             index = sign_index ? -0.0 : 0.0;
+            raise_flags(flag_underflow);
+        }
         else if (details::is_nan(index) == true)
+        {
             index = encode_data_nan();
+            raise_flags(flag_nan);
+        }
         else 
+        {
             index = encode_data_inf(sign_index);
+            raise_flags(flag_overflow);
+        };
 
         return;
     };
@@ -123,4 +243,136 @@ void gsli_double::encode_data_normalize(double& index, bool sign_index, int sign
     return encode_data(index, sign_index, signed_level);
 };
 
+//----------------------------------------------------------------------
+//                        binary exponents
+//----------------------------------------------------------------------
+GSLI_INLINE
+double frexp(const gsli_double& x, int64_t& exp)
+{
+    using config_type   = gsli_double::config_type;
+
+    const double& data  = x.get_internal_rep();
+    exp                 = 0;
+
+    if (data == 0.0 || is_finite(x) == false)
+        return x.get_value();
+
+    if (gsli_rep::can_use_float_rep(std::abs(data)) == true)
+    {
+        int e;
+        double m        = std::frexp(data, &e);
+        exp             = e;
+        return m;
+    };
+
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+
+    size_t lev;
+    bool sign_lev;
+    rep.level_sign(lev, sign_lev);
+
+    const double max_e  = 9223372036854775807.0;
+    double sign         = rep.sign_index() ? -1.0 : 1.0;
+
+    // |x| = 2^base * e^s
+    double s, base;
+
+    if (lev == 1)
+    {
+        // |x| = MAX_0 * exp(index - MIN_1) ^ (+-1); s is computed from the
+        // index directly, since log|x| is less accurate
+        s               = rep.index() - config_type::min_index_1;
+        base            = config_type::max_index_exp_0;
+
+        if (sign_lev == true)
+        {
+            s           = -s;
+            base        = -base;
+        };
+    }
+    else
+    {
+        gsli_double log_x   = log_abs(x);
+        s                   = log_x.get_internal_rep();
+        base                = 0.0;
+
+        // |log|x|| > MAX_0
+        if (gsli_rep::can_use_float_rep(std::abs(s)) == false)
+            s               = details::signed_value(sign_lev, max_e);
+    };
+
+    // |x| = 2^(base + k) * e^r, where r = s - k * log(2) should be in
+    // [-log(2), 0); since k need not be representable by double, k is
+    // split into k_hi + k_lo; rounding errors of s / log(2) are removed by
+    // the second reduction
+    double k_d          = std::floor(s / config_type::log_2) + 1.0 + base;
+
+    if (k_d >= max_e || k_d <= -max_e)
+    {
+        exp             = k_d > 0.0 ? INT64_MAX : INT64_MIN;
+        return sign * 0.5;
+    };
+
+    int64_t k           = int64_t(k_d - base);
+    double k_hi         = double(k);
+    double k_lo         = double(k - int64_t(k_hi));
+    double r            = mant_exp_log(-k_lo, mant_exp_log(-k_hi, s));
+
+    double j            = std::floor(r / config_type::log_2) + 1.0;
+    r                   = mant_exp_log(-j, r);
+    k                   += int64_t(j);
+
+    double m            = std::exp(r);
+
+    if (m >= 1.0)
+    {
+        m               *= 0.5;
+        k               += 1;
+    }
+    else if (m < 0.5)
+    {
+        m               *= 2.0;
+        k               -= 1;
+    };
+
+    exp                 = k + int64_t(base);
+    return sign * m;
+};
+
+GSLI_INLINE
+gsli_double ldexp(const gsli_double& x, int64_t exp)
+{
+    const double& data  = x.get_internal_rep();
+
+    if (data == 0.0 || exp == 0 || is_finite(x) == false)
+        return x;
+
+    if (gsli_rep::can_use_float_rep(std::abs(data)) == true)
+        return gsli_double(data, exp, gsli_double::mant_exp());
+
+    int64_t e;
+    double m            = frexp(x, e);
+
+    bool overflow       = e == INT64_MAX || e == INT64_MIN
+                        || (exp > 0 && e > INT64_MAX - exp)
+                        || (exp < 0 && e < INT64_MIN - exp);
+
+    if (overflow == false)
+        return gsli_double(m, e + exp, gsli_double::mant_exp());
+
+    // binary exponent of the result is not representable; if |log|x|| is
+    // larger than MAX_0, then |exp * log(2)| is smaller than its resolution
+    gsli_double log_x   = log_abs(x);
+    double log_v        = log_x.get_internal_rep();
+
+    if (gsli_rep::can_use_float_rep(std::abs(log_v)) == false)
+        return x;
+
+    log_v               = log_v + double(exp) * gsli_double::config_type::log_2;
+    gsli_double res     = sli::exp(gsli_double(log_v));
+
+    return is_negative(x) ? -res : res;
+};
+
 };
\ No newline at end of file
@@ -26,6 +26,7 @@
 namespace gsli
 {
 
+GSLI_INLINE
 assert_exception::assert_exception(const std::string& file_, int line_, const std::string& message_)
     :file(file_),line(line_), message(message_)
 {
@@ -35,11 +36,13 @@ assert_exception::assert_exception(const std::string& file_, int line_, const st
     message = message + " in file: " + file_ + " at line " + os.str();
 };
 
+GSLI_INLINE
 std::string assert_exception::what() const
 {
     return message;
 };
 
+GSLI_INLINE
 void assert_exception::make(const char* txt, const char* description, 
                             const char* file, int line)
 {
@@ -18,354 +18,217 @@
 *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 */
 
+
 #include "gsli/gsli_functions.h"
 #include "gsli/gsli_error.h"
 #include "gsli/details/gsli_functions_rep.h"
+#include "gsli/details/gsli_math.h"
 
-#include <boost/math/special_functions/next.hpp>
+#include <cstring>
 
 namespace sli
 {
 
-namespace bm = boost::math;
-
 //----------------------------------------------------------------------
-//                        error related
+//                        helper functions
 //----------------------------------------------------------------------
 
-static gsli_rep eval_next_lev_k(const gsli_rep& rep, bool up)
-{
-    using config    = gsli_rep::config_type;
+// sign bit of IEEE 754 double value
+static const uint64_t sign_mask = uint64_t(1) << 63;
 
-    bool index_up   = true;
-    bool level_up   = true;
+// bit pattern of a double value and double value with given bit pattern
+using details::math_kernel::get_bits;
+using details::math_kernel::make_double;
 
-    if (rep.sign_index() == true)
-    {
-        index_up    = !index_up;
-        level_up    = !level_up;
-    }
+// return ordinal number of encoded value data; ordinal numbers of 
+// consecutive gsli values differ by one, zero has ordinal number 0, and
+// ord(-x) = -ord(x); data cannot be NaN
+static inline int64_t get_ordinal(double data)
+{
+    uint64_t bits               = get_bits(data);
+    int64_t ord                 = g_global_constants.abs_ordinal(bits & ~sign_mask);
 
-    if (rep.level() < 0)
-    {
-        index_up    = !index_up;
-    }
+    return (bits & sign_mask) ? -ord : ord;
+};
 
-    if (up == false)
-    {
-        index_up    = !index_up;
-        level_up    = !level_up;
-    };
+// return encoded value with ordinal number ord; ordinal numbers outside
+// valid range are mapped to infinities; if ord = 0, then zero with sign
+// zero_sign is returned
+static inline double make_from_ordinal(int64_t ord, bool zero_sign)
+{
+    using config                = gsli_double::config_type;
+    static const int pos_inf    = 2 * config::max_level + 2;
 
-    double dir      = index_up ? config::inf : -config::inf;
-    double ind_new  = std::nextafter(rep.index(), dir);
+    const global_constants& gc  = g_global_constants;
 
-    if (ind_new <= config::max_index_1 && ind_new > config::min_index_1)
-        return gsli_rep(rep.level(), ind_new, rep.sign_index());
+    bool sign                   = ord < 0 || (ord == 0 && zero_sign == true);
+    int64_t abs_ord             = ord < 0 ? -ord : ord;
 
-    if (level_up == true)
-    {
-        int new_lev = rep.level() + 1;
-
-        if (new_lev > config::max_level)
-        {
-            return gsli_rep::make_inf(rep.sign_index());
-        }
-        else if (new_lev == 0)
-        {
-            return gsli_rep(config::min_index_0, rep.sign_index());
-        }
-        else
-        {
-            bool sign_lev   = (new_lev < 0) ? true : false;
-            if (sign_lev == false)
-                return gsli_rep(new_lev, config::min_index_1r, rep.sign_index());           
-            else
-                return gsli_rep(new_lev, config::max_index_1, rep.sign_index());
-        }
-    }
-    else
-    {
-        int new_lev = rep.level() - 1;
-
-        if (new_lev < -config::max_level)
-        {
-            return gsli_rep::make_zero(rep.sign_index());
-        }
-        else if (new_lev == 0)
-        {
-            return gsli_rep(config::max_index_0, rep.sign_index());
-        }
-        else
-        {
-            bool sign_lev   = (new_lev < 0) ? true : false;
-
-            if (sign_lev == false)
-                return gsli_rep(new_lev, config::max_index_1, rep.sign_index());
-            else
-                return gsli_rep(new_lev, config::min_index_1r, rep.sign_index());
-        }
-    };
-}
+    if (abs_ord > gc.m_ord_first[pos_inf])
+        abs_ord                 = gc.m_ord_first[pos_inf];
 
-gsli_rep sli::nextabove(const gsli_rep& rep)
-{
-    using config = gsli_double::config_type;
+    int pos                     = pos_inf;
 
-    fptype ft   = rep.fpclassify();
+    while (gc.m_ord_first[pos] > abs_ord)
+        --pos;
 
-    switch(ft)
-    {
-        case fptype::nan:
-            return gsli_rep::make_nan();
-
-        case fptype::inf:
-        {
-            if (rep.sign_index() == false)
-                return gsli_rep::make_inf(false);
-            else
-                return gsli_rep(config::max_level, config::max_index_1, true);
-        }
-
-        case fptype::zero:
-            return gsli_rep(-config::max_level, config::max_index_1, false);
-
-        case fptype::level_0:
-        {            
-            if (rep.sign_index() == false)
-            {        
-                double ind_new  = std::nextafter(rep.index(), config::inf);
-
-                if (ind_new > config::max_index_0)
-                    return gsli_rep(1, config::min_index_1r, false);
-                else 
-                    return gsli_rep(ind_new, false);
-            }
-            else
-            {
-                double ind_new  = std::nextafter(rep.index(), -config::inf);
-
-                if (ind_new < config::min_index_0)
-                    return gsli_rep(-1, config::min_index_1r, true);
-                else 
-                    return gsli_rep(ind_new, true);
-            }
-        }
-
-        case fptype::level_k:
-        {
-            return eval_next_lev_k(rep, true);
-        }
-
-        default:
-        {
-            gsli_assert(false, "unknown case");
-            throw;
-        }
-    };
-};
-
-gsli_rep sli::nextbelow(const gsli_rep& rep)
-{
-    using config = gsli_double::config_type;
+    uint64_t off                = uint64_t(abs_ord - gc.m_ord_first[pos]);
+    uint64_t abs_bits           = gc.m_ord_dir[pos] < 0 ? gc.m_band_last[pos] - off
+                                                        : gc.m_band_first[pos] + off;
 
-    fptype ft   = rep.fpclassify();
-
-    switch(ft)
-    {
-        case fptype::nan:
-            return gsli_rep::make_nan();
-
-        case fptype::inf:
-        {
-            if (rep.sign_index() == true)
-                return gsli_rep::make_inf(true);
-            else
-                return gsli_rep(config::max_level, config::max_index_1, false);
-        }
-
-        case fptype::zero:
-            return gsli_rep(-config::max_level, config::max_index_1, true);
-
-        case fptype::level_0:
-        {            
-            if (rep.sign_index() == false)
-            {        
-                double ind_new  = std::nextafter(rep.index(), -config::inf);
-
-                if (ind_new < config::min_index_0)
-                    return gsli_rep(-1, config::min_index_1r, false);
-                else 
-                    return gsli_rep(ind_new, false);
-            }
-            else
-            {
-                double ind_new  = std::nextafter(rep.index(), config::inf);
-
-                if (ind_new > config::max_index_0)
-                    return gsli_rep(1, config::min_index_1r, true);
-                else 
-                    return gsli_rep(ind_new, true);
-            }
-        }
-
-        case fptype::level_k:
-        {
-            return eval_next_lev_k(rep, false);
-        }
-
-        default:
-        {
-            gsli_assert(false, "unknown case");
-            throw;
-        }
-    };
+    return make_double(sign ? abs_bits | sign_mask : abs_bits);
 };
 
-double sli::float_distance(gsli_rep x, gsli_rep y)
+// return encoded value of the number, which is n representations above
+// (if n > 0) or below (if n < 0) the number encoded by data
+static inline double advance_encoded(double data, int64_t n)
 {
-    using config_type = gsli_double::config_type;
+    using config                = gsli_double::config_type;
+    static const int pos_inf    = 2 * config::max_level + 2;
 
-    double inc  = 0;
+    // maximum step, for which bit pattern arithmetic cannot overflow
+    static const int64_t max_step   = int64_t(1) << 52;
 
-    // process nan and zero
-    if (x.is_nan() == true || y.is_nan() == true)
-        return config_type::nan;
+    const global_constants& gc  = g_global_constants;
 
-    if (x.is_zero() == true)
-    {
-        if (y.is_zero() == true)
-            return 0.0;
-
-        x   = gsli_rep::min();
-        y   = abs(y);
-        inc += 1.0;
-    }
-    else if (y.is_zero() == true)
-    {
-        y   = abs(x);
-        x   = gsli_rep::min();
-        inc += 1.0;
-    };
+    if (details::is_nan(data) == true)
+        return data;
 
-    if (x.sign_index() != y.sign_index())
-    {
-        double d1   = float_distance(gsli_rep::min(), abs(x)) + 1;
-        double d2   = float_distance(gsli_rep::min(), abs(y)) + 1;
+    uint64_t bits               = get_bits(data);
+    uint64_t sign               = bits & sign_mask;
+    uint64_t abs_bits           = bits & ~sign_mask;
+    int pos                     = gc.level_pos(abs_bits);
 
-        return d1 + d2 + inc;
-    }
+    // change of bit pattern, that increases absolute value; zero for 
+    // zero and infinities
+    int64_t dir                 = gc.m_ord_dir[pos];
 
-    //signs are the same; x, y are regular or inf
-    
-    if (x.sign_index() == true)
+    // encoded values on given level form a continuous range of bit 
+    // patterns; if the new value is outside this range, then level must
+    // be changed
+    if (dir != 0 && n <= max_step && n >= -max_step)
     {
-        x   = abs(x);
-        y   = abs(y);
-    }
+        int64_t step            = (sign == 0) ? dir * n : -dir * n;
+        uint64_t new_bits       = abs_bits + uint64_t(step);
 
-    // process inf
-    if (x.is_inf() == true)
-    {
-        if (y.is_inf() == true)
-            return inc;
-
-        x   = y;
-        y   = gsli_rep::max();
-        inc += 1;
-    }
-    else if (y.is_inf() == true)
-    {
-        y   = gsli_rep::max();
-        inc += 1;
+        if (new_bits >= gc.m_band_first[pos] && new_bits <= gc.m_band_last[pos])
+            return make_double(new_bits | sign);
     };
 
-    //x and y are positive regular
-    if (cmp_lt(y, x) == true)
-        std::swap(x,y);
+    int64_t max_ord             = gc.m_ord_first[pos_inf];
+    int64_t ord                 = get_ordinal(data);
 
-    if (cmp_eq(x, y) == true)
-        return inc;
+    // avoid overflow; ordinal numbers outside valid range are mapped
+    // to infinities
+    if (n > 0 && ord > max_ord - n)
+        ord                     = max_ord;
+    else if (n < 0 && ord < -max_ord - n)
+        ord                     = -max_ord;
+    else
+        ord                     += n;
 
-    //x and y are positive regular and x < y
+    return make_from_ordinal(ord, sign != 0);
+};
 
-    int lev_x       = x.level();
-    int lev_y       = y.level();
+// return distance between numbers encoded by data_x and data_y
+static inline double float_distance_encoded(double data_x, double data_y)
+{
+    using config                = gsli_double::config_type;
 
-    double ind_x    = x.index();
-    double ind_y    = y.index();
+    if (details::is_nan(data_x) == true || details::is_nan(data_y) == true)
+        return config::nan;
 
-    if (lev_x == lev_y)
-        return std::abs(bm::float_distance(ind_x, ind_y)) + inc;
+    int64_t ord_x               = get_ordinal(data_x);
+    int64_t ord_y               = get_ordinal(data_y);
 
-    // distance between smallest and largest number on level 0
-    static const double distance_level_0    
-                        = std::abs(bm::float_distance(config_type::min_index_0, 
-                            config_type::max_index_0));
+    // distance between largest and smallest number does not fit in
+    // int64_t, but fits in uint64_t
+    uint64_t dist               = ord_x >= ord_y ? uint64_t(ord_x) - uint64_t(ord_y)
+                                                 : uint64_t(ord_y) - uint64_t(ord_x);
 
-    // distance between smallest and largest number on level 1
-    static const double distance_level_1
-                        = std::abs(bm::float_distance(config_type::min_index_1r, 
-                            config_type::max_index_1));
+    return double(dist);
+};
 
-    if (lev_x < 0 && lev_y > 0)
-    {
-        // largest number on negative level
-        gsli_rep m1     = gsli_rep(-1, config_type::min_index_1r, false);
+//----------------------------------------------------------------------
+//                        error related
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_double nextabove(const gsli_double& x)
+{
+    double res  = advance_encoded(x.get_internal_rep(), 1);
+    return gsli_double(res, gsli_double::internal_rep());
+};
 
-        // smallest number on positive level
-        gsli_rep m2     = gsli_rep(1, config_type::min_index_1r, false);
+GSLI_INLINE
+gsli_double nextbelow(const gsli_double& x)
+{
+    double res  = advance_encoded(x.get_internal_rep(), -1);
+    return gsli_double(res, gsli_double::internal_rep());
+};
 
-        double d1       = float_distance(x, m1);
-        double d2       = distance_level_0;
-        double d3       = float_distance(m2, y);
+GSLI_INLINE
+double float_distance(const gsli_double& x, const gsli_double& y)
+{
+    return float_distance_encoded(x.get_internal_rep(), y.get_internal_rep());
+};
 
-        return d1 + 1 + d2 + 1 + d3 + inc;
-    }
+GSLI_INLINE
+gsli_double float_advance(const gsli_double& x, int64_t n)
+{
+    double res  = advance_encoded(x.get_internal_rep(), n);
+    return gsli_double(res, gsli_double::internal_rep());
+};
 
-    if (lev_x < 0 && lev_y == 0)
+GSLI_INLINE
+void nextabove(const gsli_double* x, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
     {
-        // largest number on negative level
-        gsli_rep m1     = gsli_rep(-1, config_type::min_index_1r, false);
-
-        double d1       = float_distance(x, m1);
-        double d2       = std::abs(bm::float_distance(config_type::min_index_0, ind_y));
-
-        return d1 + 1 + d2 + inc;
+        double r    = advance_encoded(x[i].get_internal_rep(), 1);
+        res[i]      = gsli_double(r, gsli_double::internal_rep());
     };
-    
-    if (lev_x == 0 && lev_y > 0)
-    {
-        // smallest number on positive level
-        gsli_rep m2     = gsli_rep(1, config_type::min_index_1r, false);
-
-        double d2       = std::abs(bm::float_distance(ind_x, config_type::max_index_0));
-        double d3       = float_distance(m2, y);
+};
 
-        return d2 + 1 + d3 + inc;
+GSLI_INLINE
+void nextbelow(const gsli_double* x, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        double r    = advance_encoded(x[i].get_internal_rep(), -1);
+        res[i]      = gsli_double(r, gsli_double::internal_rep());
     };
+};
+
+GSLI_INLINE
+void float_distance(const gsli_double* x, const gsli_double* y, double* res, 
+                         size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]      = float_distance_encoded(x[i].get_internal_rep(), y[i].get_internal_rep());
+};
 
-    // levels of x and y are both positive or both negative
-    // and different
+GSLI_INLINE
+gsli_rep nextabove(const gsli_rep& rep)
+{
+    gsli_rep res;
+    nextabove(gsli_double(rep)).get_gsli_rep(res);
 
-    int num_full_levels = lev_y - lev_x - 1;
+    return res;
+};
 
-    if (lev_x < 0)
-    {
-        double d1   = std::abs(bm::float_distance(ind_x, config_type::min_index_1r));
-        double d2   = num_full_levels * distance_level_1;
-        double d3   = std::abs(bm::float_distance(ind_y, config_type::max_index_1));
+GSLI_INLINE
+gsli_rep nextbelow(const gsli_rep& rep)
+{
+    gsli_rep res;
+    nextbelow(gsli_double(rep)).get_gsli_rep(res);
 
-        return d1 + d2 + num_full_levels + 1 + d3 + inc;
-    }
-    else
-    {
-        double d1   = std::abs(bm::float_distance(ind_x, config_type::max_index_1));
-        double d2   = num_full_levels * distance_level_1;
-        double d3   = std::abs(bm::float_distance(config_type::min_index_1r, ind_y));
+    return res;
+};
 
-        return d1 + d2 + num_full_levels + 1 + d3 + inc; 
-    }
+GSLI_INLINE
+double float_distance(gsli_rep x, gsli_rep y)
+{
+    return float_distance(gsli_double(x), gsli_double(y));
 };
 
 };
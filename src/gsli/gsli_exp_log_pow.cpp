@@ -25,10 +25,13 @@
 namespace sli
 {
 
-#pragma warning(push)
-#pragma warning(disable:4127)   // conditional expression is constant
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable:4127)   // conditional expression is constant
+#endif
 
-gsli_rep sli::exp(const gsli_rep& rep)
+GSLI_INLINE
+gsli_rep exp(const gsli_rep& rep)
 {
     using config_type = gsli_double::config_type;
 
@@ -103,7 +106,12 @@ gsli_rep sli::exp(const gsli_rep& rep)
     //  psi(level_z - 1, index_z) = |v| - log[M0] + off
 
     if (rep.level() >= config_type::max_level)
-        return gsli_rep::make_inf(false);
+    {
+        if (rep.sign_index() == true)
+            return gsli_rep::make_zero(false);
+        else
+            return gsli_rep::make_inf(false);
+    };
 
     gsli_assert(config_type::has_large_level_0 == true, "has_large_level_0 required");
 
@@ -140,7 +148,8 @@ gsli_rep sli::exp(const gsli_rep& rep)
     };
 }
 
-gsli_rep sli::log_abs(const gsli_rep& rep)
+GSLI_INLINE
+gsli_rep log_abs(const gsli_rep& rep)
 {
     using config_type = gsli_double::config_type;
 
@@ -214,14 +223,16 @@ gsli_rep sli::log_abs(const gsli_rep& rep)
 
     // result has level 0
     // z = M1*exp[ind-1] + log(M0) - 1
-    double z        = std::exp(rep.index() - config_type::min_index_1);
+    double z        = details::exp_index(rep.index() - config_type::min_index_1);
     z               = config_type::max_index_1 * z;
     z               = z + config_type::log_max_index_0_m;
     
     return gsli_rep(z, sign_lev, gsli_rep::inexact());
 }
 
-#pragma warning(pop)
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 // both arguments must be regular
 static gsli_rep pow_abs_regular(const gsli_rep& rep_p, const gsli_rep& rep_q)
@@ -231,7 +242,8 @@ static gsli_rep pow_abs_regular(const gsli_rep& rep_p, const gsli_rep& rep_q)
     return out;
 };
 
-gsli_rep sli::pow_abs(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+gsli_rep pow_abs(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     using config_type = gsli_double::config_type;
 
@@ -348,7 +360,8 @@ static gsli_rep pow_int_regular(const gsli_rep& rep_p, long y)
         return out;
 };
 
-gsli_rep sli::pow_int(const gsli_rep& rep_p, long y)
+GSLI_INLINE
+gsli_rep pow_int(const gsli_rep& rep_p, long y)
 {
     using config_type = gsli_double::config_type;
 
@@ -0,0 +1,207 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/details/gsli_file_map.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace sli
+{
+
+#ifdef _WIN32
+
+GSLI_INLINE
+void* details::map_file(const std::string& file, bool writable, size_t& size)
+{
+    DWORD access    = writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+    HANDLE h_file   = CreateFileA(file.c_str(), access, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (h_file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER file_size;
+
+    if (GetFileSizeEx(h_file, &file_size) == 0 || file_size.QuadPart == 0)
+    {
+        CloseHandle(h_file);
+        return nullptr;
+    };
+
+    DWORD protect   = writable ? PAGE_READWRITE : PAGE_READONLY;
+    DWORD view      = writable ? FILE_MAP_WRITE : FILE_MAP_READ;
+    HANDLE h_map    = CreateFileMappingA(h_file, nullptr, protect, 0, 0, nullptr);
+    void* ptr       = nullptr;
+
+    if (h_map != nullptr)
+    {
+        ptr         = MapViewOfFile(h_map, view, 0, 0, 0);
+        CloseHandle(h_map);
+    };
+
+    // mapped view keeps the file open
+    CloseHandle(h_file);
+
+    size            = size_t(file_size.QuadPart);
+    return ptr;
+};
+
+GSLI_INLINE
+void details::unmap_file(void* ptr, size_t size)
+{
+    (void)size;
+    UnmapViewOfFile(ptr);
+};
+
+GSLI_INLINE
+void details::advise_map(const void* ptr, size_t size, map_advice adv)
+{
+    // read ahead of mapped views is controlled by the system
+    (void)ptr;
+    (void)size;
+    (void)adv;
+};
+
+GSLI_INLINE
+bool details::flush_map(void* ptr, size_t size)
+{
+    return FlushViewOfFile(ptr, size) != 0;
+};
+
+GSLI_INLINE
+bool details::create_file(const std::string& file, uint64_t size)
+{
+    HANDLE h_file   = CreateFileA(file.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (h_file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER pos;
+    pos.QuadPart    = LONGLONG(size);
+
+    bool ok         = SetFilePointerEx(h_file, pos, nullptr, FILE_BEGIN) != 0
+                    && SetEndOfFile(h_file) != 0;
+
+    CloseHandle(h_file);
+    return ok;
+};
+
+#else
+
+GSLI_INLINE
+void* details::map_file(const std::string& file, bool writable, size_t& size)
+{
+    int fd          = ::open(file.c_str(), writable ? O_RDWR : O_RDONLY);
+
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        ::close(fd);
+        return nullptr;
+    };
+
+    int prot        = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* ptr       = mmap(nullptr, size_t(st.st_size), prot, MAP_SHARED, fd, 0);
+
+    // mapping keeps the file open
+    ::close(fd);
+
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+    size            = size_t(st.st_size);
+    return ptr;
+};
+
+GSLI_INLINE
+void details::unmap_file(void* ptr, size_t size)
+{
+    munmap(ptr, size);
+};
+
+GSLI_INLINE
+void details::advise_map(const void* ptr, size_t size, map_advice adv)
+{
+    if (size == 0)
+        return;
+
+    // madvise requires address aligned to page boundary
+    uintptr_t page  = uintptr_t(sysconf(_SC_PAGESIZE));
+    uintptr_t first = uintptr_t(ptr) / page * page;
+    uintptr_t last  = uintptr_t(ptr) + size;
+
+    int flag;
+
+    switch (adv)
+    {
+        case map_advice::sequential:    flag = MADV_SEQUENTIAL; break;
+        case map_advice::will_need:     flag = MADV_WILLNEED; break;
+        case map_advice::dont_need:     flag = MADV_DONTNEED; break;
+        default:                        flag = MADV_NORMAL; break;
+    };
+
+    madvise((void*)first, size_t(last - first), flag);
+};
+
+GSLI_INLINE
+bool details::flush_map(void* ptr, size_t size)
+{
+    uintptr_t page  = uintptr_t(sysconf(_SC_PAGESIZE));
+    uintptr_t first = uintptr_t(ptr) / page * page;
+    uintptr_t last  = uintptr_t(ptr) + size;
+
+    return msync((void*)first, size_t(last - first), MS_SYNC) == 0;
+};
+
+GSLI_INLINE
+bool details::create_file(const std::string& file, uint64_t size)
+{
+    int fd          = ::open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+        return false;
+
+    bool ok         = ftruncate(fd, off_t(size)) == 0;
+
+    ::close(fd);
+    return ok;
+};
+
+#endif
+
+};
\ No newline at end of file
@@ -0,0 +1,47 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_flags.h"
+#include "gsli/details/gsli_flags_impl.h"
+
+namespace sli
+{
+
+GSLI_INLINE thread_local unsigned details::g_range_flags = 0;
+
+GSLI_INLINE
+unsigned test_flags(unsigned mask)
+{
+    return details::g_range_flags & mask;
+};
+
+GSLI_INLINE
+void clear_flags(unsigned mask)
+{
+    details::g_range_flags  &= ~mask;
+};
+
+GSLI_INLINE
+void raise_flags(unsigned mask)
+{
+    details::g_range_flags  |= mask & flag_all;
+};
+
+};
\ No newline at end of file
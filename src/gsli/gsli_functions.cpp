@@ -20,6 +20,9 @@
 
 #include "gsli/gsli_functions.h"
 #include "gsli/gsli_error.h"
+#include "gsli/gsli_counters.h"
+#include "gsli/gsli_trace.h"
+#include "gsli/details/gsli_flags_impl.h"
 #include "gsli/details/gsli_functions_rep.h"
 
 #include <iostream>
@@ -28,33 +31,52 @@ namespace sli
 {
 
 
+GSLI_INLINE
 gsli_double details::inv_general(const gsli_double& v)
 {
     gsli_rep rep;
     v.get_gsli_rep(rep);
 
-    return inv(rep);
+    GSLI_COUNT_GENERAL_1(inv, rep);
+    gsli_double res = inv(rep);
+
+    gsli_rep rep_res;
+    res.get_gsli_rep(rep_res);
+    details::set_range_flags(rep_res, rep);
+
+    return GSLI_TRACE_RESULT_1(inv, v, res);
 };
 
+GSLI_INLINE
 gsli_double details::exp_general(const gsli_double& v)
 {
     gsli_rep rep;
     v.get_gsli_rep(rep);
 
-    rep =  exp(rep);
-    return gsli_double(rep);
+    GSLI_COUNT_GENERAL_1(exp, rep);
+    gsli_rep res = exp(rep);
+    details::set_range_flags(res, rep);
+
+    return GSLI_TRACE_RESULT_1(exp, v, gsli_double(res));
 };
 
+GSLI_INLINE
 gsli_double details::log_general(const gsli_double& v)
 {
     gsli_rep rep;
     v.get_gsli_rep(rep);
 
-    rep = log_abs(rep);
-    return gsli_double(rep);
+    GSLI_COUNT_GENERAL_1(log, rep);
+    gsli_rep res = log_abs(rep);
+
+    // log|x| = 0 is exact for |x| = 1
+    details::set_range_flags(res, rep, rep.is_one());
+
+    return GSLI_TRACE_RESULT_1(log, v, gsli_double(res));
 };
 
 //
+GSLI_INLINE
 gsli_double details::plus_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -63,10 +85,15 @@ gsli_double details::plus_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(plus, rep_1, rep_2);
     gsli_rep ret = plus(rep_1, rep_2);
-    return gsli_double(ret);
+    details::set_range_flags(ret, rep_1, rep_2, 
+                             details::is_exact_cancellation(rep_1, rep_2));
+
+    return GSLI_TRACE_RESULT(plus, x1, x2, gsli_double(ret));
 };
 
+GSLI_INLINE
 gsli_double details::plus_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;    
@@ -74,10 +101,15 @@ gsli_double details::plus_general(const gsli_double& x1, double x2)
 
     gsli_rep rep_2(x2, gsli_rep::normalize());
 
+    GSLI_COUNT_GENERAL(plus, rep_1, rep_2);
     gsli_rep ret = plus(rep_1, rep_2);
-    return gsli_double(ret);
+    details::set_range_flags(ret, rep_1, rep_2, 
+                             details::is_exact_cancellation(rep_1, rep_2));
+
+    return GSLI_TRACE_RESULT(plus, x1, x2, gsli_double(ret));
 };
 
+GSLI_INLINE
 gsli_double details::plus_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_2;
@@ -85,11 +117,16 @@ gsli_double details::plus_general(double x1, const gsli_double& x2)
 
     gsli_rep rep_1(x1, gsli_rep::normalize());
 
+    GSLI_COUNT_GENERAL(plus, rep_1, rep_2);
     gsli_rep ret = plus(rep_1, rep_2);
-    return gsli_double(ret);
+    details::set_range_flags(ret, rep_1, rep_2, 
+                             details::is_exact_cancellation(rep_1, rep_2));
+
+    return GSLI_TRACE_RESULT(plus, x1, x2, gsli_double(ret));
 };
 
 //
+GSLI_INLINE
 gsli_double details::mult_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -98,10 +135,14 @@ gsli_double details::mult_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(mult, rep_1, rep_2);
     gsli_rep res = mult(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(mult, x1, x2, gsli_double(res));
 };
 
+GSLI_INLINE
 gsli_double details::mult_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());
@@ -109,10 +150,14 @@ gsli_double details::mult_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(mult, rep_1, rep_2);
     gsli_rep res = mult(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(mult, x1, x2, gsli_double(res));
 };
 
+GSLI_INLINE
 gsli_double details::mult_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -120,11 +165,15 @@ gsli_double details::mult_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
+    GSLI_COUNT_GENERAL(mult, rep_1, rep_2);
     gsli_rep res = mult(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(mult, x1, x2, gsli_double(res));
 };
 
 //
+GSLI_INLINE
 gsli_double details::div_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -133,10 +182,14 @@ gsli_double details::div_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(div, rep_1, rep_2);
     gsli_rep res = div(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(div, x1, x2, gsli_double(res));
 };
 
+GSLI_INLINE
 gsli_double details::div_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());;
@@ -144,10 +197,14 @@ gsli_double details::div_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(div, rep_1, rep_2);
     gsli_rep res = div(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(div, x1, x2, gsli_double(res));
 };
 
+GSLI_INLINE
 gsli_double details::div_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -155,11 +212,15 @@ gsli_double details::div_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
+    GSLI_COUNT_GENERAL(div, rep_1, rep_2);
     gsli_rep res = div(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(div, x1, x2, gsli_double(res));
 };
 
 //
+GSLI_INLINE
 gsli_double details::pow_abs_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -168,10 +229,14 @@ gsli_double details::pow_abs_general(const gsli_double& x1, const gsli_double& x
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(pow_abs, rep_1, rep_2);
     gsli_rep res = pow_abs(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(pow_abs, x1, x2, gsli_double(res));
 }
 
+GSLI_INLINE
 gsli_double details::pow_abs_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -179,10 +244,14 @@ gsli_double details::pow_abs_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
+    GSLI_COUNT_GENERAL(pow_abs, rep_1, rep_2);
     gsli_rep res = pow_abs(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(pow_abs, x1, x2, gsli_double(res));
 }
 
+GSLI_INLINE
 gsli_double details::pow_abs_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());
@@ -190,22 +259,30 @@ gsli_double details::pow_abs_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
+    GSLI_COUNT_GENERAL(pow_abs, rep_1, rep_2);
     gsli_rep res = pow_abs(rep_1, rep_2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1, rep_2);
+
+    return GSLI_TRACE_RESULT(pow_abs, x1, x2, gsli_double(res));
 }
 
 //
+GSLI_INLINE
 gsli_double details::pow_int_general(const gsli_double& x1, long x2)
 {
     gsli_rep rep_1;
  
     x1.get_gsli_rep(rep_1);
 
+    GSLI_COUNT_GENERAL_1(pow_int, rep_1);
     gsli_rep res = pow_int(rep_1, x2);
-    return gsli_double(res);
+    details::set_range_flags(res, rep_1);
+
+    return GSLI_TRACE_RESULT(pow_int, x1, x2, gsli_double(res));
 };
 
 //
+GSLI_INLINE
 bool details::cmp_gt_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -214,9 +291,11 @@ bool details::cmp_gt_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
-    return cmp_gt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_gt, x1, x2, cmp_gt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_gt_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -224,9 +303,11 @@ bool details::cmp_gt_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
-    return cmp_gt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_gt, x1, x2, cmp_gt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_gt_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());;
@@ -234,9 +315,11 @@ bool details::cmp_gt_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
-    return cmp_gt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_gt, x1, x2, cmp_gt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_lt_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -245,9 +328,11 @@ bool details::cmp_lt_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
-    return cmp_lt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_lt, x1, x2, cmp_lt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_lt_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -255,9 +340,11 @@ bool details::cmp_lt_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
-    return cmp_lt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_lt, x1, x2, cmp_lt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_lt_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());;
@@ -265,9 +352,11 @@ bool details::cmp_lt_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
-    return cmp_lt(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_lt, x1, x2, cmp_lt(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_geq_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -276,9 +365,11 @@ bool details::cmp_geq_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
-    return cmp_geq(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_geq, x1, x2, cmp_geq(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_geq_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -286,9 +377,11 @@ bool details::cmp_geq_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
-    return cmp_geq(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_geq, x1, x2, cmp_geq(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_geq_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());;
@@ -296,9 +389,11 @@ bool details::cmp_geq_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
-    return cmp_geq(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_geq, x1, x2, cmp_geq(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_leq_general(const gsli_double& x1, const gsli_double& x2)
 {
     gsli_rep rep_1;
@@ -307,9 +402,11 @@ bool details::cmp_leq_general(const gsli_double& x1, const gsli_double& x2)
     x1.get_gsli_rep(rep_1);
     x2.get_gsli_rep(rep_2);
 
-    return cmp_leq(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_leq, x1, x2, cmp_leq(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_leq_general(const gsli_double& x1, double x2)
 {
     gsli_rep rep_1;
@@ -317,9 +414,11 @@ bool details::cmp_leq_general(const gsli_double& x1, double x2)
  
     x1.get_gsli_rep(rep_1);
 
-    return cmp_leq(rep_1, rep_2);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_leq, x1, x2, cmp_leq(rep_1, rep_2));
 };
 
+GSLI_INLINE
 bool details::cmp_leq_general(double x1, const gsli_double& x2)
 {
     gsli_rep rep_1(x1, gsli_rep::normalize());;
@@ -327,41 +426,8 @@ bool details::cmp_leq_general(double x1, const gsli_double& x2)
  
     x2.get_gsli_rep(rep_2);
 
-    return cmp_leq(rep_1, rep_2);
-};
-
-//----------------------------------------------------------------------
-//                        error related
-//----------------------------------------------------------------------
-gsli_double sli::nextabove(const gsli_double& x)
-{
-    using config = gsli_double::config_type;
-
-    gsli_rep rep;
-    x.get_gsli_rep(rep);
-
-    return gsli_double(nextabove(rep));
-};
-
-gsli_double sli::nextbelow(const gsli_double& x)
-{
-    using config = gsli_double::config_type;
-
-    gsli_rep rep;
-    x.get_gsli_rep(rep);
-
-    return gsli_double(nextbelow(rep));
-};
-
-double sli::float_distance(const gsli_double& x, const gsli_double& y)
-{
-    using config = gsli_double::config_type;
-
-    gsli_rep rep_x, rep_y;
-    x.get_gsli_rep(rep_x);
-    y.get_gsli_rep(rep_y);
-
-    return float_distance(rep_x, rep_y);
+    GSLI_COUNT_GENERAL(cmp, rep_1, rep_2);
+    return GSLI_TRACE_RESULT(cmp_leq, x1, x2, cmp_leq(rep_1, rep_2));
 };
 
 //----------------------------------------------------------------------
@@ -449,7 +515,8 @@ static bool read_doube_helper(std::istream &is, double &r)
     return true;
 };
 
-std::istream& sli::operator>>(std::istream& is, gsli_double& v)
+GSLI_INLINE
+std::istream& operator>>(std::istream& is, gsli_double& v)
 {    
     char c  = 0;
 
@@ -505,7 +572,8 @@ std::istream& sli::operator>>(std::istream& is, gsli_double& v)
     return is;
 }
 
-std::ostream& sli::operator<<(std::ostream& os, const gsli_double& v)
+GSLI_INLINE
+std::ostream& operator<<(std::ostream& os, const gsli_double& v)
 {
     gsli_rep rep;
     v.get_gsli_rep(rep);
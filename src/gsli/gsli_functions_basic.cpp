@@ -28,7 +28,8 @@ namespace sli
 //----------------------------------------------------------------------
 //                  unary functions
 //----------------------------------------------------------------------
-gsli_double sli::inv(const gsli_rep& rep)
+GSLI_INLINE
+gsli_double inv(const gsli_rep& rep)
 {
 	if (rep.level() == 0)
 		return gsli_double(1.0 / rep.signed_index());
@@ -45,7 +46,8 @@ gsli_double sli::inv(const gsli_rep& rep)
         return gsli_double::make_nan();
 }
 
-gsli_rep sli::inv_rep(const gsli_rep& rep)
+GSLI_INLINE
+gsli_rep inv_rep(const gsli_rep& rep)
 {
     fptype fp   = rep.fpclassify();
 
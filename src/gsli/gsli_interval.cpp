@@ -0,0 +1,484 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+
+#include "gsli/gsli_interval.h"
+
+#include <iostream>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+
+// move x down by ulp representations
+static inline gsli_double round_down(const gsli_double& x, int ulp)
+{
+    return float_advance(x, -ulp);
+};
+
+// move x up by ulp representations
+static inline gsli_double round_up(const gsli_double& x, int ulp)
+{
+    return float_advance(x, ulp);
+};
+
+// number of representations, by which result of x + y is moved outward
+static inline int ulp_plus(const gsli_double& x, const gsli_double& y)
+{
+    // addition of zero is exact
+    if (is_zero(x) == true || is_zero(y) == true)
+        return 0;
+
+    if (details::result_add_level_0(x.get_internal_rep(), y.get_internal_rep()) == true)
+        return gsli_interval::ulp_exact;
+    else
+        return gsli_interval::ulp_general;
+};
+
+// number of representations, by which result of x * y is moved outward
+static inline int ulp_mult(const gsli_double& x, const gsli_double& y)
+{
+    if (details::result_mult_level_0(x.get_internal_rep(), y.get_internal_rep()) == true)
+        return gsli_interval::ulp_exact;
+    else
+        return gsli_interval::ulp_general;
+};
+
+// number of representations, by which result of x / y is moved outward
+static inline int ulp_div(const gsli_double& x, const gsli_double& y)
+{
+    // division of zero is exact
+    if (is_zero(x) == true)
+        return 0;
+
+    if (details::result_div_level_0(x.get_internal_rep(), y.get_internal_rep()) == true)
+        return gsli_interval::ulp_exact;
+    else
+        return gsli_interval::ulp_general;
+};
+
+// build interval with bounds lower, upper moved outward by ulp_lower and
+// ulp_upper representations
+static inline gsli_interval make_rounded(const gsli_double& lower, int ulp_lower, 
+                                const gsli_double& upper, int ulp_upper)
+{
+    if (is_nan(lower) == true || is_nan(upper) == true)
+        return gsli_interval::make_nan();
+
+    return gsli_interval(round_down(lower, ulp_lower), round_up(upper, ulp_upper));
+};
+
+// product of bounds; 0 * Inf is 0
+static inline gsli_double mult_bound(const gsli_double& x, const gsli_double& y)
+{
+    if (is_zero(x) == true || is_zero(y) == true)
+        return gsli_double::make_zero();
+
+    return x * y;
+};
+
+// product of bounds rounded down
+static inline gsli_double mult_down(const gsli_double& x, const gsli_double& y)
+{
+    gsli_double prod    = mult_bound(x, y);
+
+    // multiplication by zero is exact
+    int ulp             = is_zero(prod) == true ? 0 : ulp_mult(x, y);
+    return round_down(prod, ulp);
+};
+
+// product of bounds rounded up
+static inline gsli_double mult_up(const gsli_double& x, const gsli_double& y)
+{
+    gsli_double prod    = mult_bound(x, y);
+
+    // multiplication by zero is exact
+    int ulp             = is_zero(prod) == true ? 0 : ulp_mult(x, y);
+    return round_up(prod, ulp);
+};
+
+// return true if x contains zero
+static inline bool contains_zero(const gsli_interval& x)
+{
+    return is_positive(x.lower()) == false && is_negative(x.upper()) == false;
+};
+
+//----------------------------------------------------------------------
+//                     unary functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+double ulp_width(const gsli_interval& x)
+{
+    return float_distance(x.lower(), x.upper());
+};
+
+GSLI_INLINE
+gsli_interval abs(const gsli_interval& x)
+{
+    if (is_nan(x) == true)
+        return x;
+
+    if (is_negative(x.lower()) == false)
+        return x;
+
+    if (is_positive(x.upper()) == false)
+        return -x;
+
+    gsli_double up  = -x.lower();
+    
+    if (x.upper() > up)
+        up          = x.upper();
+
+    return gsli_interval(gsli_double::make_zero(), up);
+};
+
+GSLI_INLINE
+gsli_interval inv(const gsli_interval& x)
+{
+    if (is_nan(x) == true)
+        return x;
+
+    if (contains_zero(x) == true)
+        return gsli_interval::make_entire();
+
+    // 1/x is decreasing
+    const gsli_double& lo   = x.upper();
+    const gsli_double& up   = x.lower();
+
+    int ulp_lo  = details::result_inv_level_0(lo.get_internal_rep()) 
+                ? gsli_interval::ulp_exact : gsli_interval::ulp_general;
+    int ulp_up  = details::result_inv_level_0(up.get_internal_rep()) 
+                ? gsli_interval::ulp_exact : gsli_interval::ulp_general;
+
+    return make_rounded(inv(lo), ulp_lo, inv(up), ulp_up);
+};
+
+GSLI_INLINE
+gsli_interval exp(const gsli_interval& x)
+{
+    if (is_nan(x) == true)
+        return x;
+
+    // exp is increasing
+    const gsli_double& lo   = x.lower();
+    const gsli_double& up   = x.upper();
+
+    int ulp_lo  = details::result_exp_level_0(lo.get_internal_rep()) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+    int ulp_up  = details::result_exp_level_0(up.get_internal_rep()) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+
+    gsli_interval res   = make_rounded(exp(lo), ulp_lo, exp(up), ulp_up);
+
+    // exp(x) >= 0
+    if (is_negative(res.lower()) == true)
+        res     = gsli_interval(gsli_double::make_zero(), res.upper());
+
+    return res;
+};
+
+GSLI_INLINE
+gsli_interval log_abs(const gsli_interval& x0)
+{
+    if (is_nan(x0) == true)
+        return x0;
+
+    // log is increasing
+    gsli_interval x         = abs(x0);
+
+    const gsli_double& lo   = x.lower();
+    const gsli_double& up   = x.upper();
+
+    int ulp_lo  = details::result_log_level_0(lo.get_internal_rep()) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+    int ulp_up  = details::result_log_level_0(up.get_internal_rep()) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+
+    return make_rounded(log_abs(lo), ulp_lo, log_abs(up), ulp_up);
+};
+
+//----------------------------------------------------------------------
+//                     arithmetic functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_interval operator+(const gsli_interval& x, const gsli_interval& y)
+{
+    gsli_double lo  = x.lower() + y.lower();
+    gsli_double up  = x.upper() + y.upper();
+
+    return make_rounded(lo, ulp_plus(x.lower(), y.lower()), 
+                        up, ulp_plus(x.upper(), y.upper()));
+};
+
+GSLI_INLINE
+gsli_interval operator-(const gsli_interval& x, const gsli_interval& y)
+{
+    gsli_double lo  = x.lower() - y.upper();
+    gsli_double up  = x.upper() - y.lower();
+
+    return make_rounded(lo, ulp_plus(x.lower(), y.upper()), 
+                        up, ulp_plus(x.upper(), y.lower()));
+};
+
+GSLI_INLINE
+gsli_interval operator*(const gsli_interval& x, const gsli_interval& y)
+{
+    if (is_nan(x) == true || is_nan(y) == true)
+        return gsli_interval::make_nan();
+
+    const gsli_double& xl   = x.lower();
+    const gsli_double& xu   = x.upper();
+    const gsli_double& yl   = y.lower();
+    const gsli_double& yu   = y.upper();
+
+    // sign classes: 0 - nonnegative, 1 - nonpositive, 2 - contains zero
+    // in interior
+    int cx  = is_negative(xl) == false ? 0 : (is_positive(xu) == false ? 1 : 2);
+    int cy  = is_negative(yl) == false ? 0 : (is_positive(yu) == false ? 1 : 2);
+
+    switch (3 * cx + cy)
+    {
+        case 0: return gsli_interval(mult_down(xl, yl), mult_up(xu, yu));
+        case 1: return gsli_interval(mult_down(xu, yl), mult_up(xl, yu));
+        case 2: return gsli_interval(mult_down(xu, yl), mult_up(xu, yu));
+        case 3: return gsli_interval(mult_down(xl, yu), mult_up(xu, yl));
+        case 4: return gsli_interval(mult_down(xu, yu), mult_up(xl, yl));
+        case 5: return gsli_interval(mult_down(xl, yu), mult_up(xl, yl));
+        case 6: return gsli_interval(mult_down(xl, yu), mult_up(xu, yu));
+        case 7: return gsli_interval(mult_down(xu, yl), mult_up(xl, yl));
+        default:
+        {
+            // both intervals contain zero in interior
+            gsli_double lo1     = mult_down(xl, yu);
+            gsli_double lo2     = mult_down(xu, yl);
+            gsli_double up1     = mult_up(xl, yl);
+            gsli_double up2     = mult_up(xu, yu);
+
+            return gsli_interval(lo1 < lo2 ? lo1 : lo2, up1 > up2 ? up1 : up2);
+        }
+    };
+};
+
+GSLI_INLINE
+gsli_interval operator/(const gsli_interval& x, const gsli_interval& y)
+{
+    if (is_nan(x) == true || is_nan(y) == true)
+        return gsli_interval::make_nan();
+
+    if (contains_zero(y) == true)
+        return gsli_interval::make_entire();
+
+    const gsli_double* xb[2]    = {&x.lower(), &x.upper()};
+    const gsli_double* yb[2]    = {&y.lower(), &y.upper()};
+
+    gsli_double lo, up;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            gsli_double quot    = *xb[i] / *yb[j];
+
+            // Inf / Inf
+            if (is_nan(quot) == true)
+                return gsli_interval::make_entire();
+
+            int ulp             = ulp_div(*xb[i], *yb[j]);
+
+            gsli_double quot_lo = round_down(quot, ulp);
+            gsli_double quot_up = round_up(quot, ulp);
+
+            if (i + j == 0 || quot_lo < lo)
+                lo              = quot_lo;
+
+            if (i + j == 0 || quot_up > up)
+                up              = quot_up;
+        };
+    };
+
+    return gsli_interval(lo, up);
+};
+
+GSLI_INLINE
+gsli_interval pow_abs(const gsli_interval& x0, const gsli_interval& y)
+{
+    if (is_nan(x0) == true || is_nan(y) == true)
+        return gsli_interval::make_nan();
+
+    // |x|^y = exp(y * log|x|) and y * log|x| is bilinear in (log|x|, y),
+    // therefore bounds are attained at corners
+    gsli_interval x             = abs(x0);
+
+    const gsli_double* xb[2]    = {&x.lower(), &x.upper()};
+    const gsli_double* yb[2]    = {&y.lower(), &y.upper()};
+
+    gsli_double lo, up;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            gsli_double pow     = pow_abs(*xb[i], *yb[j]);
+
+            int ulp             = details::result_pow_abs_level_0(xb[i]->get_internal_rep(),
+                                    yb[j]->get_internal_rep())
+                                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+
+            gsli_double pow_lo  = round_down(pow, ulp);
+            gsli_double pow_up  = round_up(pow, ulp);
+
+            if (i + j == 0 || pow_lo < lo)
+                lo              = pow_lo;
+
+            if (i + j == 0 || pow_up > up)
+                up              = pow_up;
+        };
+    };
+
+    // |x|^y >= 0
+    if (is_negative(lo) == true)
+        lo                      = gsli_double::make_zero();
+
+    return gsli_interval(lo, up);
+};
+
+GSLI_INLINE
+gsli_interval pow_int(const gsli_interval& x, long y)
+{
+    if (is_nan(x) == true)
+        return x;
+
+    if (y == 0)
+        return gsli_interval(gsli_double(1.0));
+
+    gsli_double lo, up;
+
+    if (y % 2 == 0)
+    {
+        // x^y = |x|^y is increasing in |x| for y > 0 and decreasing 
+        // for y < 0
+        gsli_interval ax    = abs(x);
+
+        if (y > 0)
+        {
+            lo              = ax.lower();
+            up              = ax.upper();
+        }
+        else
+        {
+            lo              = ax.upper();
+            up              = ax.lower();
+        };
+    }
+    else
+    {
+        if (y > 0)
+        {
+            // x^y is increasing
+            lo              = x.lower();
+            up              = x.upper();
+        }
+        else
+        {
+            // x^y is decreasing on each side of zero
+            bool lo_neg     = is_negative(x.lower()) 
+                            || (is_zero(x.lower()) && is_zero(x.upper()));
+            bool up_pos     = is_positive(x.upper());
+
+            if (lo_neg == true && up_pos == true)
+                return gsli_interval::make_entire();
+
+            // zero bound is seen as a limit from the interior
+            lo              = is_zero(x.upper()) ? -gsli_double::make_zero() : x.upper();
+            up              = is_zero(x.lower()) ?  gsli_double::make_zero() : x.lower();
+        };
+    };
+
+    int ulp_lo  = details::result_pow_int_level_0(lo.get_internal_rep(), y) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+    int ulp_up  = details::result_pow_int_level_0(up.get_internal_rep(), y) 
+                ? gsli_interval::ulp_func_0 : gsli_interval::ulp_general;
+
+    return make_rounded(pow_int(lo, y), ulp_lo, pow_int(up, y), ulp_up);
+};
+
+//----------------------------------------------------------------------
+//                     batch functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+void plus(const gsli_interval* x, const gsli_interval* y, gsli_interval* res, 
+               size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] + y[i];
+};
+
+GSLI_INLINE
+void minus(const gsli_interval* x, const gsli_interval* y, gsli_interval* res, 
+                size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] - y[i];
+};
+
+GSLI_INLINE
+void mult(const gsli_interval* x, const gsli_interval* y, gsli_interval* res, 
+               size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] * y[i];
+};
+
+GSLI_INLINE
+void div(const gsli_interval* x, const gsli_interval* y, gsli_interval* res, 
+              size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] / y[i];
+};
+
+GSLI_INLINE
+void exp(const gsli_interval* x, gsli_interval* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = exp(x[i]);
+};
+
+GSLI_INLINE
+void log_abs(const gsli_interval* x, gsli_interval* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = log_abs(x[i]);
+};
+
+//----------------------------------------------------------------------
+//                     input-output
+//----------------------------------------------------------------------
+GSLI_INLINE
+std::ostream& operator<<(std::ostream& os, const gsli_interval& x)
+{
+    os << "[" << x.lower() << ", " << x.upper() << "]";
+    return os;
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_mapped_vector.h"
+#include "gsli/gsli_error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        gsli_mapped_vector
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_mapped_vector::gsli_mapped_vector()
+    : m_map(nullptr), m_map_size(0), m_data(nullptr), m_size(0)
+    , m_chunk(default_chunk_size), m_writable(false)
+{};
+
+GSLI_INLINE
+gsli_mapped_vector::~gsli_mapped_vector()
+{
+    close();
+};
+
+GSLI_INLINE
+gsli_mapped_vector::gsli_mapped_vector(gsli_mapped_vector&& other)
+    : m_map(other.m_map), m_map_size(other.m_map_size), m_data(other.m_data)
+    , m_size(other.m_size), m_chunk(other.m_chunk), m_writable(other.m_writable)
+{
+    other.m_map         = nullptr;
+    other.m_map_size    = 0;
+    other.m_data        = nullptr;
+    other.m_size        = 0;
+    other.m_writable    = false;
+};
+
+GSLI_INLINE
+gsli_mapped_vector& gsli_mapped_vector::operator=(gsli_mapped_vector&& other)
+{
+    if (this != &other)
+    {
+        close();
+        std::swap(m_map, other.m_map);
+        std::swap(m_map_size, other.m_map_size);
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_chunk, other.m_chunk);
+        std::swap(m_writable, other.m_writable);
+    };
+
+    return *this;
+};
+
+GSLI_INLINE
+array_status gsli_mapped_vector::open(const std::string& file, bool writable)
+{
+    close();
+
+    size_t size = 0;
+    void* map   = details::map_file(file, writable, size);
+
+    if (map == nullptr)
+        return array_status::io_error;
+
+    array_header h;
+    array_status st = check_array_buffer((const unsigned char*)map, size, h);
+
+    if (st != array_status::ok)
+    {
+        details::unmap_file(map, size);
+        return st;
+    };
+
+    m_map       = map;
+    m_map_size  = size;
+    m_data      = (gsli_double*)((char*)map + h.m_data_offset);
+    m_size      = size_t(h.m_size);
+    m_writable  = writable;
+
+    return array_status::ok;
+};
+
+GSLI_INLINE
+array_status gsli_mapped_vector::create(const std::string& file, size_t n)
+{
+    close();
+
+    if (n > (size_t(-1) - array_header_size) / sizeof(gsli_double))
+        return array_status::io_error;
+
+    // zero bytes encode zeros
+    if (details::create_file(file, array_header_size + n * sizeof(gsli_double)) == false)
+        return array_status::io_error;
+
+    size_t size = 0;
+    void* map   = details::map_file(file, true, size);
+
+    if (map == nullptr)
+        return array_status::io_error;
+
+    write_array_header(array_header::make(n), (unsigned char*)map);
+
+    m_map       = map;
+    m_map_size  = size;
+    m_data      = (gsli_double*)((char*)map + array_header_size);
+    m_size      = n;
+    m_writable  = true;
+
+    return array_status::ok;
+};
+
+GSLI_INLINE
+void gsli_mapped_vector::close()
+{
+    if (m_map != nullptr)
+        details::unmap_file(m_map, m_map_size);
+
+    m_map       = nullptr;
+    m_map_size  = 0;
+    m_data      = nullptr;
+    m_size      = 0;
+    m_writable  = false;
+};
+
+GSLI_INLINE
+bool gsli_mapped_vector::flush()
+{
+    if (m_map == nullptr || m_writable == false)
+        return true;
+
+    return details::flush_map(m_map, m_map_size);
+};
+
+GSLI_INLINE
+void gsli_mapped_vector::set_chunk_size(size_t n)
+{
+    gsli_assert(n > 0, "invalid chunk size");
+    m_chunk     = n;
+};
+
+GSLI_INLINE
+void gsli_mapped_vector::advise(size_t first, size_t n, map_advice adv) const
+{
+    size_t n_chunks = num_chunks();
+
+    if (first >= n_chunks)
+        return;
+
+    n               = std::min(n, n_chunks - first);
+
+    size_t pos      = first * m_chunk;
+    size_t len      = std::min(m_size - pos, n * m_chunk);
+
+    details::advise_map(m_data + pos, len * sizeof(gsli_double), adv);
+};
+
+//----------------------------------------------------------------------
+//                        chunk driver
+//----------------------------------------------------------------------
+GSLI_INLINE
+void details::run_chunks(size_t n, int n_threads, const std::function<void (size_t)>& f)
+{
+    if (n_threads <= 0)
+        n_threads   = std::max(int(std::thread::hardware_concurrency()), 1);
+
+    n_threads       = int(std::min(size_t(n_threads), std::max(n, size_t(1))));
+
+    std::atomic<size_t> next(0);
+
+    // the first exception thrown by f; exceptions cannot leave threads
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    auto work       = [&]()
+    {
+        try
+        {
+            for (size_t i = next++; i < n; i = next++)
+                f(i);
+        }
+        catch (...)
+        {
+            // stop handing out chunks
+            next    = n;
+
+            std::lock_guard<std::mutex> lock(error_mutex);
+
+            if (error == nullptr)
+                error   = std::current_exception();
+        };
+    };
+
+    std::vector<std::thread> threads;
+
+    // if a thread cannot be started, chunks are processed by threads
+    // started so far
+    try
+    {
+        for (int t = 1; t < n_threads; ++t)
+            threads.emplace_back(work);
+    }
+    catch (const std::system_error&)
+    {};
+
+    work();
+
+    for (std::thread& th : threads)
+        th.join();
+
+    if (error != nullptr)
+        std::rethrow_exception(error);
+};
+
+};
\ No newline at end of file
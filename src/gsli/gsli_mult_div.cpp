@@ -49,6 +49,7 @@ struct eval_mult
     static gsli_rep eval_div_overflow(const double& x, const double& y, bool overflow);
 };
 
+GSLI_INLINE
 gsli_rep eval_mult::eval_mult_overflow(const double& x, const double& y, bool overflow)
 {
     using config = gsli_double::config_type;
@@ -65,7 +66,7 @@ gsli_rep eval_mult::eval_mult_overflow(const double& x, const double& y, bool ov
         bool sign;
         
         details::get_sign_abs(res, res_a, sign);
-        res_a       = std::log(res_a) + config_type::min_index_1;
+        res_a       = details::log_index(res_a) + config_type::min_index_1;
 
         return gsli_rep(1, res_a, sign);
     }
@@ -81,12 +82,13 @@ gsli_rep eval_mult::eval_mult_overflow(const double& x, const double& y, bool ov
         bool sign;
         
         details::get_sign_abs(res, res_a, sign);
-        res_a       = -std::log(res_a) + config_type::min_index_1;
+        res_a       = -details::log_index(res_a) + config_type::min_index_1;
 
         return gsli_rep(-1, res_a, sign);
     };
 };
 
+GSLI_INLINE
 gsli_rep eval_mult::eval_div_overflow(const double& x, const double& y, bool overflow)
 {
     using config = gsli_double::config_type;
@@ -103,7 +105,7 @@ gsli_rep eval_mult::eval_div_overflow(const double& x, const double& y, bool ove
         bool sign;
         
         details::get_sign_abs(res, res_a, sign);
-        res_a       = std::log(res_a) + config_type::min_index_1;
+        res_a       = details::log_index(res_a) + config_type::min_index_1;
 
         return gsli_rep(1, res_a, sign);
     }
@@ -119,12 +121,13 @@ gsli_rep eval_mult::eval_div_overflow(const double& x, const double& y, bool ove
         bool sign;
         
         details::get_sign_abs(res, res_a, sign);
-        res_a       = -std::log(res_a) + config_type::min_index_1;
+        res_a       = -details::log_index(res_a) + config_type::min_index_1;
 
         return gsli_rep(-1, res_a, sign);
     };
 };
 
+GSLI_INLINE
 gsli_rep eval_mult::normalize_level_1_0(double index, bool sign_level, bool sign_index)
 {
     if (index > config_type::min_index_1)
@@ -139,16 +142,17 @@ gsli_rep eval_mult::normalize_level_1_0(double index, bool sign_level, bool sign
 
     if (sign_level == true)
     {
-        index   = ::exp(-index) * config_type::min_index_0;
+        index   = details::exp_index(-index) * config_type::min_index_0;
         return gsli_rep(index, sign_index, gsli_rep::inexact());
     }
     else
     {
-        index   = ::exp(index) * config_type::max_index_0;
+        index   = details::exp_index(index) * config_type::max_index_0;
         return gsli_rep(index, sign_index, gsli_rep::inexact());
     }
 }
 
+GSLI_INLINE
 gsli_rep eval_mult::normalize_level_1_2(double index, bool sign_level, bool sign_index)
 {
     if (index <= config_type::max_index_1)
@@ -163,6 +167,7 @@ gsli_rep eval_mult::normalize_level_1_2(double index, bool sign_level, bool sign
     return gsli_rep(lz, index, sign_index);
 };
 
+GSLI_INLINE
 gsli_rep eval_mult::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     gsli_assert(rep_p.is_regular() == true && rep_q.is_regular() == true, 
@@ -255,12 +260,12 @@ gsli_rep eval_mult::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
 
             if (sign_lev_p == false)
             {
-                z   = ::exp(z);                               
+                z   = details::exp_index(z);                               
                 return gsli_rep(z, sign_ind);
             }
             else
             {
-                z   = ::exp(-z);
+                z   = details::exp_index(-z);
                 return gsli_rep(z, sign_ind);
             }
         }
@@ -282,9 +287,12 @@ gsli_rep eval_mult::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
     return gsli_rep(z.level(), z.index(), sign_ind);
 };
 
-#pragma warning(push)
-#pragma warning(disable:4127)   // conditional expression is constant
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable:4127)   // conditional expression is constant
+#endif
 
+GSLI_INLINE
 gsli_rep eval_mult::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     gsli_assert(rep_p.is_regular() == true && rep_q.is_regular() == true, 
@@ -328,7 +336,7 @@ gsli_rep eval_mult::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
         static const double max_0   = config_type::max_index_0;
         static const double min_1   = config_type::min_index_1;
 
-        double w        = ::log(ind_q);
+        double w        = details::log_index(ind_q);
         double z1       = ind_p + g_global_constants.m_double_sign_arr[sign_lev_p] * w;
 
         if (z1 > min_1)
@@ -353,7 +361,7 @@ gsli_rep eval_mult::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
             //      => exp(ind_p-min_1) <= 1/ind_q <= max_0
             // hence exp(ind_p-min_1) will not overflow; max_0 * ind_q will
             // not overflow; and z0 cannot overlow
-            z0      = (max_0 * ind_q) * ::exp(ind_p - min_1);
+            z0      = (max_0 * ind_q) * details::exp_index(ind_p - min_1);
         }
         else
         {
@@ -365,7 +373,7 @@ gsli_rep eval_mult::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
             // hence exp(ind_p-min_1) will not overflow; min_0 * ind_q will
             // not overflow; and z0 cannot overlow
 
-            z0      = (min_0 * ind_q) * ::exp(min_1 - ind_p);
+            z0      = (min_0 * ind_q) * details::exp_index(min_1 - ind_p);
         }        
 
         // z0 can be outside of range of numbers on level 0 due to rounding 
@@ -380,9 +388,12 @@ gsli_rep eval_mult::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
     return gsli_rep(rep_p.level(), rep_p.index(), sign_ret);
 };
 
-#pragma warning(pop)
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
-gsli_rep sli::mult(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+gsli_rep mult(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     using config    = gsli_rep::config_type;
 
@@ -470,7 +481,8 @@ gsli_rep sli::mult(const gsli_rep& rep_p, const gsli_rep& rep_q)
     return gsli_rep::make_inf(sign);
 }
 
-gsli_rep sli::div(const gsli_rep& x1, const gsli_rep& x2)
+GSLI_INLINE
+gsli_rep div(const gsli_rep& x1, const gsli_rep& x2)
 {
     using config    = gsli_rep::config_type;
 
@@ -28,6 +28,12 @@ struct eval_plus
 {
     using config_type = gsli_double::config_type;
 
+    // addition of two level 1 (or two level -1) numbers is trivial if
+    // indices differ by more than log(2^(precision+2)), since then
+    // log(1 +- exp(-|ind_p - ind_q|)) < eps/4 <= ulp(ind_p)/2
+    static constexpr double trivial_index_diff  = (config_type::precision + 2) 
+                                                * config_type::log_2;
+
     // p and q are reqular
     static gsli_rep eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q);
 
@@ -35,6 +41,7 @@ struct eval_plus
     static gsli_rep eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q);
 };
 
+GSLI_INLINE
 gsli_rep eval_plus::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
 	if (rep_p.level() < 0)
@@ -82,8 +89,8 @@ gsli_rep eval_plus::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
     {        
         // exp may overflow, but then w = 0 and result is accurate
         double w    = (ind_q * config_type::min_index_0)
-                    * std::exp(config_type::min_index_1 - ind_p);
-        double z    = ind_p + std::log(1.0 + w);
+                    * details::exp_index(config_type::min_index_1 - ind_p);
+        double z    = ind_p + details::log1p_index(w);
 
         // result cannot be on level 2, since log(2)/MAX_1 < eps/4
         return gsli_rep(1, z, rep_p.sign_index(), gsli_rep::inexact());
@@ -92,9 +99,9 @@ gsli_rep eval_plus::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
     {
         // exp may overflow, but then w = 0 and result is accurate
         double w    = (ind_q * config_type::min_index_0)
-                    * std::exp(config_type::min_index_1 - ind_p);
+                    * details::exp_index(config_type::min_index_1 - ind_p);
+        double z    = ind_p + details::log1p_index(-w);
         w           = 1.0 - w;
-        double z    = ind_p + std::log(w);
 
         // result has level 1 or level 0
 
@@ -105,13 +112,14 @@ gsli_rep eval_plus::eval_sli_float(const gsli_rep& rep_p, const gsli_rep& rep_q)
         // convert level 1 number to level 0 number
         // exp overflow not possible
         z               = (config_type::max_index_0 * w)
-                        * std::exp(ind_p - config_type::min_index_1);
+                        * details::exp_index(ind_p - config_type::min_index_1);
 
         // z can be outside level 0 bounds due to rounding errors of exp
         return gsli_rep(z, rep_p.sign_index(), gsli_rep::inexact());
     };
 };
 
+GSLI_INLINE
 gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     // assumes |p| > |q| or p == q
@@ -152,7 +160,7 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
         using config                    = gsli_double::config_type;
 
         // addition is trivial if |q/p| < 1/MAX_0^2 <= eps/4
-        static const bool is_trivial    = 1.0/(config::max_index_0 * config::max_index_0)
+        static constexpr bool is_trivial    = 1.0/config::max_index_0/config::max_index_0
                                         < config::eps / 4;
 
         // current configuration implies, that every large-small case is trivial
@@ -169,9 +177,12 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
 
         gsli_assert(ind_q <= ind_p, "error in plus");
 
-	    if (rep_p.sign_index() == rep_q.sign_index())
+        if (ind_p - ind_q > trivial_index_diff)
+            return rep_p;
+
+        if (rep_p.sign_index() == rep_q.sign_index())
         {
-            double z    = ind_p + std::log(1 + std::exp(ind_q - ind_p));
+            double z    = ind_p + details::log1p_index(details::exp_index(ind_q - ind_p));
 
             // result cannot be level 2, since log(2)/MAX_1 < eps/4
             gsli_assert(z <= config_type::max_index_1, 
@@ -181,8 +192,9 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
         }
         else
         {
-            double w    = 1 - std::exp(ind_q - ind_p);
-            double z    = ind_p + std::log(w);
+            double e    = details::exp_index(ind_q - ind_p);
+            double w    = 1 - e;
+            double z    = ind_p + details::log1p_index(-e);
 
             // result has level 1 or level 0
 
@@ -193,7 +205,7 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
             // convert level 1 number to level 0 number
             // exp overflow not possible
             z               = (config_type::max_index_0 * w)
-                            * std::exp(ind_p - config_type::min_index_1);
+                            * details::exp_index(ind_p - config_type::min_index_1);
 
             // z can be outside level 0 bounds due to rounding errors of exp
             return gsli_rep(z, rep_p.sign_index(), gsli_rep::inexact());
@@ -207,9 +219,12 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
 
         gsli_assert(ind_p <= ind_q, "error in plus");
 
-	    if (rep_p.sign_index() != rep_q.sign_index())
+        if (ind_q - ind_p > trivial_index_diff)
+            return rep_p;
+
+        if (rep_p.sign_index() != rep_q.sign_index())
         {
-            double z    = ind_p - std::log(1 - std::exp(ind_p - ind_q));
+            double z    = ind_p - details::log1p_index(-details::exp_index(ind_p - ind_q));
 
             // result cannot be level -2, since we assumed, that all
             // additions on level 2 are trivial
@@ -220,8 +235,9 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
         }
         else
         {
-            double w    = 1 + std::exp(ind_p - ind_q);
-            double z    = ind_p - std::log(w);
+            double e    = details::exp_index(ind_p - ind_q);
+            double w    = 1 + e;
+            double z    = ind_p - details::log1p_index(e);
 
             // result has level -1 or level 0
 
@@ -233,7 +249,7 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
             // convert level -1 number to level 0
             // exp overflow not possible
             z               = (config_type::min_index_0 * w) 
-                            * std::exp(config_type::min_index_1 - ind_p);
+                            * details::exp_index(config_type::min_index_1 - ind_p);
 
             // z can be outside level 0 bounds due to rounding errors of exp
             return gsli_rep(z, rep_p.sign_index(), gsli_rep::inexact());
@@ -241,7 +257,8 @@ gsli_rep eval_plus::eval_sli_sli(const gsli_rep& rep_p, const gsli_rep& rep_q)
     }
 };
 
-gsli_rep sli::plus(const gsli_rep& rep_p, const gsli_rep& rep_q)
+GSLI_INLINE
+gsli_rep plus(const gsli_rep& rep_p, const gsli_rep& rep_q)
 {
     fptype ft1  = rep_p.fpclassify();
     fptype ft2  = rep_q.fpclassify();
@@ -326,7 +343,66 @@ gsli_rep sli::plus(const gsli_rep& rep_p, const gsli_rep& rep_q)
     return rep_q;
 }
 
-gsli_rep sli::minus(const gsli_rep& x1, const gsli_rep& x2)
+GSLI_INLINE
+gsli_rep plus_nonneg(const gsli_rep& rep_p, const gsli_rep& rep_q)
+{
+    gsli_assert(rep_p.is_nan() == true || rep_p.sign_index() == false, 
+                "negative argument in plus_nonneg");
+    gsli_assert(rep_q.is_nan() == true || rep_q.sign_index() == false, 
+                "negative argument in plus_nonneg");
+
+    fptype ft1  = rep_p.fpclassify();
+    fptype ft2  = rep_q.fpclassify();
+
+    if (ft1 == fptype::level_0)
+    {
+        if (ft2 == fptype::level_0)
+            return gsli_rep(rep_p.index() + rep_q.index(), gsli_rep::normalize());
+        else if (ft2 == fptype::level_k)
+            return eval_plus::eval_sli_float(rep_q, rep_p);
+    }
+    else if (ft1 == fptype::level_k)
+    {
+        if (ft2 == fptype::level_0)
+        {
+            return eval_plus::eval_sli_float(rep_p, rep_q);
+        }
+        else if (ft2 == fptype::level_k)
+        {
+            // numbers are positive; p >= q if level of p is higher or
+            // levels are equal and index of p is higher on positive level
+            // or lower on negative level
+            int lev_p   = rep_p.level();
+            int lev_q   = rep_q.level();
+
+            bool p_geq  = lev_p > lev_q
+                        || (lev_p == lev_q && (lev_p > 0 ? rep_p.index() >= rep_q.index()
+                                                         : rep_p.index() <= rep_q.index()));
+
+            if (p_geq == true)
+                return eval_plus::eval_sli_sli(rep_p, rep_q);
+            else
+                return eval_plus::eval_sli_sli(rep_q, rep_p);
+        };
+    };
+
+    // one of number is irregular
+
+    if (ft1 == fptype::zero)
+        return rep_q;
+
+    if (ft2 == fptype::zero)
+        return rep_p;
+
+    if (ft1 == fptype::nan || ft2 == fptype::nan)
+        return gsli_rep::make_nan();
+
+    // one of numbers is +inf
+    return gsli_rep::make_inf(false);
+}
+
+GSLI_INLINE
+gsli_rep minus(const gsli_rep& x1, const gsli_rep& x2)
 {
     return plus(x1, uminus(x2));
 }
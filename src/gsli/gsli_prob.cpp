@@ -0,0 +1,100 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_prob.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_functions_rep.h"
+#include "gsli/details/gsli_flags_impl.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_prob details::plus_prob_general(const gsli_prob& x1, const gsli_prob& x2)
+{
+    gsli_rep rep_1;
+    gsli_rep rep_2;
+
+    x1.get_gsli_double().get_gsli_rep(rep_1);
+    x2.get_gsli_double().get_gsli_rep(rep_2);
+
+    gsli_rep ret    = plus_nonneg(rep_1, rep_2);
+    set_range_flags(ret, rep_1, rep_2);
+
+    return gsli_prob(gsli_double(ret).get_internal_rep(), gsli_prob::internal_rep());
+};
+
+GSLI_INLINE
+gsli_prob details::mult_prob_general(const gsli_prob& x1, const gsli_prob& x2)
+{
+    gsli_double ret = mult_general(x1.get_gsli_double(), x2.get_gsli_double());
+    return gsli_prob(ret.get_internal_rep(), gsli_prob::internal_rep());
+};
+
+GSLI_INLINE
+gsli_prob details::div_prob_general(const gsli_prob& x1, const gsli_prob& x2)
+{
+    gsli_double ret = div_general(x1.get_gsli_double(), x2.get_gsli_double());
+    return gsli_prob(ret.get_internal_rep(), gsli_prob::internal_rep());
+};
+
+GSLI_INLINE
+int64_t details::prob_ordinal(const gsli_prob& x)
+{
+    // sign bit is not set
+    uint64_t bits;
+    std::memcpy(&bits, &x.get_internal_rep(), sizeof(bits));
+
+    return g_global_constants.abs_ordinal(bits);
+};
+
+//----------------------------------------------------------------------
+//                     arithmetic functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_prob pow(const gsli_prob& x, const gsli_double& y)
+{
+    gsli_double ret = pow_abs(x.get_gsli_double(), y);
+    return gsli_prob(ret.get_internal_rep(), gsli_prob::internal_rep());
+};
+
+GSLI_INLINE
+gsli_prob pow_int(const gsli_prob& x, long y)
+{
+    gsli_double ret = pow_int(x.get_gsli_double(), y);
+    return gsli_prob(ret.get_internal_rep(), gsli_prob::internal_rep());
+};
+
+//----------------------------------------------------------------------
+//                     input-output
+//----------------------------------------------------------------------
+GSLI_INLINE
+std::ostream& operator<<(std::ostream& os, const gsli_prob& x)
+{
+    return os << x.get_gsli_double();
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,602 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_profile.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_rep.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace sli { namespace profile
+{
+
+//----------------------------------------------------------------------
+//                        thread buffers
+//----------------------------------------------------------------------
+// buffer storing op_profile of a thread; buffers are never freed, buffer
+// of a finished thread is reused by a new thread; only the owning thread
+// modifies a buffer, other threads can read it
+struct thread_buffer
+{
+    static const int n_op       = op_profile::n_op;
+    static const int n_class    = op_profile::n_class;
+
+    std::atomic<uint64_t>   m_count[n_op][n_class][n_class];
+    std::atomic<uint64_t>   m_time_ns[n_op][n_class][n_class];
+    std::atomic<bool>       m_in_use;
+    thread_buffer*          m_next;
+
+    thread_buffer();
+
+    void        clear();
+};
+
+// owner of a buffer of the calling thread; releases the buffer when
+// the thread finishes
+struct buffer_holder
+{
+    thread_buffer*  m_buffer;
+
+    buffer_holder();
+    ~buffer_holder();
+
+    thread_buffer*  get();
+};
+
+// list of all buffers
+GSLI_STATIC_VAR std::atomic<thread_buffer*> g_buffers(nullptr);
+
+GSLI_STATIC_VAR thread_local buffer_holder g_buffer_holder;
+
+// results of timed operations are accumulated here, so that they cannot
+// be removed by the optimizer
+GSLI_STATIC_VAR volatile uint64_t g_profile_sink = 0;
+
+GSLI_INLINE
+thread_buffer::thread_buffer()
+    : m_in_use(true), m_next(nullptr)
+{
+    clear();
+};
+
+GSLI_INLINE
+void thread_buffer::clear()
+{
+    for (int i = 0; i < n_op; ++i)
+    for (int j = 0; j < n_class; ++j)
+    for (int k = 0; k < n_class; ++k)
+    {
+        m_count[i][j][k].store(0, std::memory_order_relaxed);
+        m_time_ns[i][j][k].store(0, std::memory_order_relaxed);
+    };
+};
+
+GSLI_INLINE
+buffer_holder::buffer_holder()
+    : m_buffer(nullptr)
+{};
+
+GSLI_INLINE
+buffer_holder::~buffer_holder()
+{
+    if (m_buffer != nullptr)
+        m_buffer->m_in_use.store(false, std::memory_order_release);
+};
+
+GSLI_INLINE
+thread_buffer* buffer_holder::get()
+{
+    if (m_buffer != nullptr)
+        return m_buffer;
+
+    // try to reuse a buffer of a finished thread
+    for (thread_buffer* buf = g_buffers.load(std::memory_order_acquire); 
+            buf != nullptr; buf = buf->m_next)
+    {
+        bool in_use     = false;
+
+        if (buf->m_in_use.compare_exchange_strong(in_use, true, 
+                                                  std::memory_order_acquire) == true)
+        {
+            m_buffer    = buf;
+            return m_buffer;
+        };
+    };
+
+    thread_buffer* buf  = new thread_buffer();
+    thread_buffer* head = g_buffers.load(std::memory_order_relaxed);
+
+    do
+    {
+        buf->m_next     = head;
+    }
+    while (g_buffers.compare_exchange_weak(head, buf, std::memory_order_release,
+                                           std::memory_order_relaxed) == false);
+
+    m_buffer            = buf;
+    return m_buffer;
+};
+
+// add val to a counter; only the owning thread modifies counters, 
+// therefore atomic read-modify-write operations are not required
+static void add_relaxed(std::atomic<uint64_t>& counter, uint64_t val)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + val, 
+                  std::memory_order_relaxed);
+};
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+static bool is_unary(counter_op op)
+{
+    return op == counter_op::inv || op == counter_op::exp 
+            || op == counter_op::log;
+};
+
+// evaluate operation op for all elements of a1, a2 and return elapsed
+// time in nanoseconds
+static uint64_t eval_group(counter_op op, const std::vector<gsli_double>& a1, 
+                           const std::vector<gsli_double>& a2)
+{
+    using clock         = std::chrono::steady_clock;
+
+    size_t n            = a1.size();
+
+    std::vector<gsli_double> res(n);
+    std::vector<long> a2_int;
+    std::vector<char> res_cmp;
+
+    if (op == counter_op::pow_int)
+    {
+        a2_int.resize(n);
+
+        // exponents are clamped to the range of long; conversion of
+        // infinite or too large values would be undefined; NaN is 
+        // replaced by 0
+        const double max_int    = double(std::numeric_limits<long>::max() / 2);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            double v    = a2[i].get_value();
+
+            if (v != v)
+                v       = 0.0;
+
+            v           = std::min(std::max(v, -max_int), max_int);
+            a2_int[i]   = long(v);
+        };
+    }
+    else if (op == counter_op::cmp)
+    {
+        res_cmp.resize(n);
+    };
+
+    clock::time_point start = clock::now();
+
+    switch (op)
+    {
+        case counter_op::plus:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = a1[i] + a2[i];
+            break;
+        case counter_op::mult:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = a1[i] * a2[i];
+            break;
+        case counter_op::div:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = a1[i] / a2[i];
+            break;
+        case counter_op::pow_abs:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = pow_abs(a1[i], a2[i]);
+            break;
+        case counter_op::pow_int:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = pow_int(a1[i], a2_int[i]);
+            break;
+        case counter_op::inv:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = inv(a1[i]);
+            break;
+        case counter_op::exp:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = exp(a1[i]);
+            break;
+        case counter_op::log:
+            for (size_t i = 0; i < n; ++i)
+                res[i]  = log_abs(a1[i]);
+            break;
+        case counter_op::cmp:
+            for (size_t i = 0; i < n; ++i)
+                res_cmp[i]  = a1[i] < a2[i];
+            break;
+        default:
+            gsli_assert(false, "invalid operation");
+            break;
+    };
+
+    clock::time_point stop  = clock::now();
+
+    uint64_t sum            = 0;
+
+    for (size_t i = 0; i < res.size(); ++i)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &res[i].get_internal_rep(), sizeof(bits));
+        sum                 += bits;
+    };
+
+    for (size_t i = 0; i < res_cmp.size(); ++i)
+        sum                 += uint64_t(res_cmp[i]);
+
+    g_profile_sink          = g_profile_sink + sum;
+
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>
+                        (stop - start).count());
+};
+
+}};
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        data_histogram
+//----------------------------------------------------------------------
+GSLI_INLINE
+uint64_t profile::data_histogram::get_level(int level) const
+{
+    if (std::abs(level) > max_level)
+        return 0;
+
+    return m_level[level + max_level];
+};
+
+GSLI_INLINE
+uint64_t profile::data_histogram::get_fptype(fptype ft) const
+{
+    return m_fptype[int(ft)];
+};
+
+GSLI_INLINE
+profile::data_histogram& 
+profile::data_histogram::operator+=(const data_histogram& other)
+{
+    m_count         += other.m_count;
+
+    for (int i = 0; i < n_level; ++i)
+        m_level[i]  += other.m_level[i];
+
+    for (int i = 0; i < n_exp_0; ++i)
+        m_exp_0[i]  += other.m_exp_0[i];
+
+    for (int i = 0; i < n_exp_k; ++i)
+        m_exp_k[i]  += other.m_exp_k[i];
+
+    for (int i = 0; i < n_fptype; ++i)
+        m_fptype[i] += other.m_fptype[i];
+
+    return *this;
+};
+
+GSLI_INLINE
+profile::data_histogram profile::histogram(const gsli_double* x, size_t n)
+{
+    data_histogram h    = data_histogram();
+    h.m_count           = n;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        gsli_rep rep;
+        x[i].get_gsli_rep(rep);
+
+        fptype ft       = rep.fpclassify();
+        ++h.m_fptype[int(ft)];
+
+        if (ft != fptype::level_0 && ft != fptype::level_k)
+            continue;
+
+        ++h.m_level[rep.level() + data_histogram::max_level];
+
+        int exp         = std::ilogb(rep.index());
+
+        // static members are copied, std::min and std::max would require
+        // their definitions
+        const int max_exp_0 = data_histogram::max_exp_0;
+        const int max_exp_k = data_histogram::max_exp_k;
+
+        if (ft == fptype::level_0)
+        {
+            exp         = std::max(exp, -max_exp_0);
+            exp         = std::min(exp, max_exp_0);
+            ++h.m_exp_0[exp + max_exp_0];
+        }
+        else
+        {
+            exp         = std::max(exp, 0);
+            exp         = std::min(exp, max_exp_k);
+            ++h.m_exp_k[exp];
+        };
+    };
+
+    return h;
+};
+
+GSLI_INLINE
+std::ostream& profile::operator<<(std::ostream& os, const data_histogram& h)
+{
+    static const char* fptype_names[]   = {"level_0", "level_k", "zero", "inf", "nan"};
+
+    const int w_name    = 16;
+    const int w_count   = 12;
+    const int bin_0     = 64;
+
+    os << "values: " << h.m_count << "\n";
+
+    os << "classes:" << "\n";
+
+    for (int i = 0; i < data_histogram::n_fptype; ++i)
+    {
+        if (h.m_fptype[i] != 0)
+        {
+            os << "  " << std::left << std::setw(w_name) << fptype_names[i] 
+               << std::right << std::setw(w_count) << h.m_fptype[i] << "\n";
+        };
+    };
+
+    os << "levels:" << "\n";
+
+    for (int i = 0; i < data_histogram::n_level; ++i)
+    {
+        if (h.m_level[i] != 0)
+        {
+            os << "  " << std::left << std::setw(w_name) << i - data_histogram::max_level
+               << std::right << std::setw(w_count) << h.m_level[i] << "\n";
+        };
+    };
+
+    os << "level 0 index exponents:" << "\n";
+
+    const int n_exp_0   = data_histogram::n_exp_0;
+
+    for (int first = 0; first < n_exp_0; first += bin_0)
+    {
+        int last        = std::min(first + bin_0, n_exp_0);
+        uint64_t count  = 0;
+
+        for (int i = first; i < last; ++i)
+            count       += h.m_exp_0[i];
+
+        if (count == 0)
+            continue;
+
+        std::ostringstream range;
+        range << "[" << first - data_histogram::max_exp_0 << ", " 
+              << last - 1 - data_histogram::max_exp_0 << "]";
+
+        os << "  " << std::left << std::setw(w_name) << range.str()
+           << std::right << std::setw(w_count) << count << "\n";
+    };
+
+    os << "level k index exponents:" << "\n";
+
+    for (int i = 0; i < data_histogram::n_exp_k; ++i)
+    {
+        if (h.m_exp_k[i] != 0)
+        {
+            os << "  " << std::left << std::setw(w_name) << i
+               << std::right << std::setw(w_count) << h.m_exp_k[i] << "\n";
+        };
+    };
+
+    return os;
+};
+
+//----------------------------------------------------------------------
+//                        op_profile
+//----------------------------------------------------------------------
+GSLI_INLINE
+profile::operand_class profile::classify(const gsli_double& x)
+{
+    switch (fpclassify(x))
+    {
+        case fptype::level_0:   return operand_class::level_0;
+        case fptype::level_k:   return operand_class::level_k;
+        default:                return operand_class::special;
+    };
+};
+
+GSLI_INLINE
+const char* profile::operand_class_name(operand_class c)
+{
+    switch (c)
+    {
+        case operand_class::level_0:    return "level_0";
+        case operand_class::level_k:    return "level_k";
+        case operand_class::special:    return "special";
+        case operand_class::none:       return "none";
+        default:                        return "unknown";
+    };
+};
+
+GSLI_INLINE
+uint64_t profile::op_profile::get_count(counter_op op, operand_class c1, 
+                                        operand_class c2) const
+{
+    return m_count[int(op)][int(c1)][int(c2)];
+};
+
+GSLI_INLINE
+uint64_t profile::op_profile::get_time_ns(counter_op op, operand_class c1, 
+                                          operand_class c2) const
+{
+    return m_time_ns[int(op)][int(c1)][int(c2)];
+};
+
+GSLI_INLINE
+double profile::op_profile::get_ns_per_op(counter_op op, operand_class c1, 
+                                          operand_class c2) const
+{
+    uint64_t count  = get_count(op, c1, c2);
+
+    if (count == 0)
+        return 0.0;
+
+    return double(get_time_ns(op, c1, c2)) / double(count);
+};
+
+GSLI_INLINE
+profile::op_profile& profile::op_profile::operator+=(const op_profile& other)
+{
+    for (int i = 0; i < n_op; ++i)
+    for (int j = 0; j < n_class; ++j)
+    for (int k = 0; k < n_class; ++k)
+    {
+        m_count[i][j][k]    += other.m_count[i][j][k];
+        m_time_ns[i][j][k]  += other.m_time_ns[i][j][k];
+    };
+
+    return *this;
+};
+
+GSLI_INLINE
+void profile::sample_op(counter_op op, const gsli_double* x1, const gsli_double* x2, 
+                        size_t n, size_t stride)
+{
+    static const int n_class    = op_profile::n_class;
+
+    gsli_assert(stride > 0, "invalid stride");
+    gsli_assert(int(op) >= 0 && op < counter_op::count, "invalid operation");
+
+    bool unary          = is_unary(op);
+
+    std::vector<gsli_double> args_1[n_class][n_class];
+    std::vector<gsli_double> args_2[n_class][n_class];
+
+    for (size_t i = 0; i < n; i += stride)
+    {
+        int c1          = int(classify(x1[i]));
+        int c2          = unary ? int(operand_class::none) : int(classify(x2[i]));
+
+        args_1[c1][c2].push_back(x1[i]);
+        args_2[c1][c2].push_back(unary ? gsli_double() : x2[i]);
+    };
+
+    thread_buffer* buf  = g_buffer_holder.get();
+
+    for (int c1 = 0; c1 < n_class; ++c1)
+    for (int c2 = 0; c2 < n_class; ++c2)
+    {
+        if (args_1[c1][c2].empty() == true)
+            continue;
+
+        uint64_t time   = eval_group(op, args_1[c1][c2], args_2[c1][c2]);
+
+        add_relaxed(buf->m_count[int(op)][c1][c2], args_1[c1][c2].size());
+        add_relaxed(buf->m_time_ns[int(op)][c1][c2], time);
+    };
+};
+
+GSLI_INLINE
+profile::op_profile profile::get_op_profile()
+{
+    static const int n_op       = op_profile::n_op;
+    static const int n_class    = op_profile::n_class;
+
+    op_profile res      = op_profile();
+
+    for (thread_buffer* buf = g_buffers.load(std::memory_order_acquire); 
+            buf != nullptr; buf = buf->m_next)
+    {
+        for (int i = 0; i < n_op; ++i)
+        for (int j = 0; j < n_class; ++j)
+        for (int k = 0; k < n_class; ++k)
+        {
+            res.m_count[i][j][k]    += buf->m_count[i][j][k].load(std::memory_order_relaxed);
+            res.m_time_ns[i][j][k]  += buf->m_time_ns[i][j][k].load(std::memory_order_relaxed);
+        };
+    };
+
+    return res;
+};
+
+GSLI_INLINE
+void profile::reset_op_profile()
+{
+    for (thread_buffer* buf = g_buffers.load(std::memory_order_acquire); 
+            buf != nullptr; buf = buf->m_next)
+    {
+        buf->clear();
+    };
+};
+
+GSLI_INLINE
+std::ostream& profile::operator<<(std::ostream& os, const op_profile& p)
+{
+    static const int n_class    = op_profile::n_class;
+
+    const int w_name    = 10;
+    const int w_count   = 14;
+
+    std::ios_base::fmtflags flags   = os.flags();
+    std::streamsize prec            = os.precision();
+
+    os << std::left << std::setw(w_name) << "op" << std::setw(w_name) << "class_1" 
+       << std::setw(w_name) << "class_2" << std::right << std::setw(w_count) 
+       << "count" << std::setw(w_count) << "ns/op" << "\n";
+
+    for (int i = 0; i < op_profile::n_op; ++i)
+    for (int j = 0; j < n_class; ++j)
+    for (int k = 0; k < n_class; ++k)
+    {
+        counter_op op       = counter_op(i);
+        operand_class c1    = operand_class(j);
+        operand_class c2    = operand_class(k);
+
+        if (p.get_count(op, c1, c2) == 0)
+            continue;
+
+        os << std::left << std::setw(w_name) << counter_op_name(op) 
+           << std::setw(w_name) << operand_class_name(c1) 
+           << std::setw(w_name) << operand_class_name(c2)
+           << std::right << std::setw(w_count) << p.get_count(op, c1, c2)
+           << std::setw(w_count) << std::fixed << std::setprecision(2) 
+           << p.get_ns_per_op(op, c1, c2) << "\n";
+
+        os.flags(flags);
+        os.precision(prec);
+    };
+
+    return os;
+};
+
+};
\ No newline at end of file
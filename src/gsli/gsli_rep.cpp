@@ -28,6 +28,7 @@ namespace sli
 //----------------------------------------------------------------------
 //                        gsli_rep
 //----------------------------------------------------------------------
+GSLI_INLINE
 gsli_rep::gsli_rep(double signed_index, normalize)
 {
     double abs_a;
@@ -65,6 +66,7 @@ gsli_rep::gsli_rep(double signed_index, normalize)
     gsli_assert(test_rep() == true, "invalid gsli representation");
 };
 
+GSLI_INLINE
 gsli_rep::gsli_rep(int level, double index, bool sign_ind, inexact)
 {
     m_index         = index;
@@ -95,6 +97,7 @@ gsli_rep::gsli_rep(int level, double index, bool sign_ind, inexact)
     gsli_assert(test_rep() == true, "invalid gsli representation");
 };
 
+GSLI_INLINE
 double gsli_rep::get_value() const
 {
     if (this->level() == 0)
@@ -124,19 +127,20 @@ double gsli_rep::get_value() const
     static constexpr double off = config_type::min_index_1;
 
 	for (size_t i = 2; i <= level; i++)
-		res     = ::exp(res - off) * config_type::max_index_1;
+		res     = details::exp_index(res - off) * config_type::max_index_1;
 
     // last level is treated differently in order to avoid overflows
     // for denormal numbers
     if (sign_level == true)
-        res     = ::exp(off - res) * config_type::min_index_0;
+        res     = details::exp_index(off - res) * config_type::min_index_0;
     else
-        res     = ::exp(res - off) * config_type::max_index_0;
+        res     = details::exp_index(res - off) * config_type::max_index_0;
 
     res         = this->sign_index_value() * res;	
     return res;
 };
 
+GSLI_INLINE
 bool gsli_rep::test_rep() const
 {
     if (this->level() == 0)
@@ -187,19 +191,20 @@ bool gsli_rep::test_rep() const
     return true;
 };
 
+GSLI_INLINE
 void gsli_rep::calc_level_index_sign(double& index, int& level)
 {
     int inc         = 0;
 
 	if (index < 1.0)
     {
-        index       = -::log(index * config_type::max_index_0);
+        index       = -details::log_index(index * config_type::max_index_0);
         inc         = -1;
         --level;        
 	}
     else
     {
-        index       = ::log(index * config_type::min_index_0);
+        index       = details::log_index(index * config_type::min_index_0);
         inc         = 1;
         ++level;
     };
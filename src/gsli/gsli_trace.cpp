@@ -0,0 +1,346 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_trace.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_math.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        trace state
+//----------------------------------------------------------------------
+// ring buffer of the calling thread
+struct trace_state
+{
+    std::vector<trace_record>   m_buffer;
+    size_t                      m_pos;
+    uint64_t                    m_total;
+    size_t                      m_period;
+    size_t                      m_countdown;
+    bool                        m_active;
+
+    trace_state();
+};
+
+GSLI_STATIC_VAR thread_local trace_state g_trace_state;
+
+GSLI_INLINE
+trace_state::trace_state()
+    : m_pos(0), m_total(0), m_period(1), m_countdown(1), m_active(false)
+{};
+
+//----------------------------------------------------------------------
+//                        binary format
+//----------------------------------------------------------------------
+static const char   trace_magic[8]      = {'G', 'S', 'L', 'I', 'T', 'R', 'C', '1'};
+static const int    trace_record_size   = 26;
+
+static void store_uint64(unsigned char* ptr, uint64_t val)
+{
+    for (int i = 0; i < 8; ++i)
+        ptr[i]  = (unsigned char)(val >> (8 * i));
+};
+
+static uint64_t load_uint64(const unsigned char* ptr)
+{
+    uint64_t val    = 0;
+
+    for (int i = 0; i < 8; ++i)
+        val         |= uint64_t(ptr[i]) << (8 * i);
+
+    return val;
+};
+
+using details::math_kernel::make_double;
+
+static gsli_double make_gsli(uint64_t bits)
+{
+    return gsli_double(make_double(bits), gsli_double::internal_rep());
+};
+
+//----------------------------------------------------------------------
+//                        recording
+//----------------------------------------------------------------------
+GSLI_INLINE
+bool trace_enabled()
+{
+    #ifdef GSLI_TRACE
+        return true;
+    #else
+        return false;
+    #endif
+};
+
+GSLI_INLINE
+void start_trace(size_t capacity, size_t period)
+{
+    gsli_assert(capacity > 0, "invalid trace capacity");
+    gsli_assert(period > 0, "invalid trace period");
+
+    trace_state& st     = g_trace_state;
+
+    st.m_buffer.assign(capacity, trace_record());
+    st.m_pos            = 0;
+    st.m_total          = 0;
+    st.m_period         = period;
+    st.m_countdown      = period;
+    st.m_active         = true;
+};
+
+GSLI_INLINE
+void stop_trace()
+{
+    g_trace_state.m_active  = false;
+};
+
+GSLI_INLINE
+uint64_t trace_total()
+{
+    return g_trace_state.m_total;
+};
+
+GSLI_INLINE
+std::vector<trace_record> get_trace()
+{
+    const trace_state& st   = g_trace_state;
+
+    size_t capacity     = st.m_buffer.size();
+
+    if (st.m_total <= capacity)
+        return std::vector<trace_record>(st.m_buffer.begin(), st.m_buffer.begin() + st.m_pos);
+
+    // buffer is full; oldest record is at m_pos
+    std::vector<trace_record> res(st.m_buffer.begin() + st.m_pos, st.m_buffer.end());
+    res.insert(res.end(), st.m_buffer.begin(), st.m_buffer.begin() + st.m_pos);
+
+    return res;
+};
+
+GSLI_INLINE
+void details::trace_call(trace_op op, trace_args args, uint64_t arg_1, uint64_t arg_2,
+                         uint64_t result)
+{
+    trace_state& st     = g_trace_state;
+
+    if (st.m_active == false)
+        return;
+
+    if (--st.m_countdown != 0)
+        return;
+
+    st.m_countdown      = st.m_period;
+
+    trace_record& rec   = st.m_buffer[st.m_pos];
+
+    rec.m_arg_1         = arg_1;
+    rec.m_arg_2         = arg_2;
+    rec.m_result        = result;
+    rec.m_op            = op;
+    rec.m_args          = args;
+
+    if (++st.m_pos == st.m_buffer.size())
+        st.m_pos        = 0;
+
+    ++st.m_total;
+};
+
+//----------------------------------------------------------------------
+//                        input-output
+//----------------------------------------------------------------------
+GSLI_INLINE
+void write_trace(std::ostream& os, const std::vector<trace_record>& trace)
+{
+    unsigned char header[16];
+
+    std::memcpy(header, trace_magic, 8);
+    store_uint64(header + 8, trace.size());
+
+    os.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    unsigned char buf[trace_record_size];
+
+    for (const trace_record& rec : trace)
+    {
+        store_uint64(buf, rec.m_arg_1);
+        store_uint64(buf + 8, rec.m_arg_2);
+        store_uint64(buf + 16, rec.m_result);
+        buf[24]     = (unsigned char)rec.m_op;
+        buf[25]     = (unsigned char)rec.m_args;
+
+        os.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+    };
+};
+
+// return true if operation op can be replayed with operands of type args
+static bool trace_valid_record(trace_op op, trace_args args)
+{
+    switch (args)
+    {
+        case trace_args::unary:
+            return op == trace_op::inv || op == trace_op::exp || op == trace_op::log;
+        case trace_args::gsli_long:
+            return op == trace_op::pow_int;
+        case trace_args::gsli_gsli:
+        case trace_args::gsli_real:
+        case trace_args::real_gsli:
+            return op == trace_op::plus || op == trace_op::mult || op == trace_op::div
+                || op == trace_op::pow_abs || op == trace_op::cmp_gt 
+                || op == trace_op::cmp_lt || op == trace_op::cmp_geq 
+                || op == trace_op::cmp_leq;
+        default:
+            return false;
+    };
+};
+
+GSLI_INLINE
+bool read_trace(std::istream& is, std::vector<trace_record>& trace)
+{
+    trace.clear();
+
+    unsigned char header[16];
+    is.read(reinterpret_cast<char*>(header), sizeof(header));
+
+    if (!is || std::memcmp(header, trace_magic, 8) != 0)
+        return false;
+
+    uint64_t count      = load_uint64(header + 8);
+
+    unsigned char buf[trace_record_size];
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        is.read(reinterpret_cast<char*>(buf), sizeof(buf));
+
+        if (!is)
+            return false;
+
+        trace_record rec;
+
+        rec.m_arg_1     = load_uint64(buf);
+        rec.m_arg_2     = load_uint64(buf + 8);
+        rec.m_result    = load_uint64(buf + 16);
+        rec.m_op        = trace_op(buf[24]);
+        rec.m_args      = trace_args(buf[25]);
+
+        // replay requires valid combination of operation and operands
+        if (trace_valid_record(rec.m_op, rec.m_args) == false)
+            return false;
+
+        trace.push_back(rec);
+    };
+
+    return true;
+};
+
+//----------------------------------------------------------------------
+//                        replay
+//----------------------------------------------------------------------
+// evaluate binary operation op
+template<class T1, class T2>
+static uint64_t eval_binary(trace_op op, const T1& x1, const T2& x2)
+{
+    using details::trace_bits;
+
+    switch (op)
+    {
+        case trace_op::plus:        return trace_bits(gsli_double(x1 + x2));
+        case trace_op::mult:        return trace_bits(gsli_double(x1 * x2));
+        case trace_op::div:         return trace_bits(gsli_double(x1 / x2));
+        case trace_op::pow_abs:     return trace_bits(gsli_double(pow_abs(x1, x2)));
+        case trace_op::cmp_gt:      return trace_bits(bool(x1 > x2));
+        case trace_op::cmp_lt:      return trace_bits(bool(x1 < x2));
+        case trace_op::cmp_geq:     return trace_bits(bool(x1 >= x2));
+        case trace_op::cmp_leq:     return trace_bits(bool(x1 <= x2));
+        default:
+            gsli_assert(false, "invalid trace record");
+            return 0;
+    };
+};
+
+GSLI_INLINE
+uint64_t replay(const trace_record& rec)
+{
+    using details::trace_bits;
+
+    switch (rec.m_args)
+    {
+        case trace_args::unary:
+        {
+            gsli_double x   = make_gsli(rec.m_arg_1);
+
+            switch (rec.m_op)
+            {
+                case trace_op::inv:     return trace_bits(inv(x));
+                case trace_op::exp:     return trace_bits(exp(x));
+                case trace_op::log:     return trace_bits(log_abs(x));
+                default:
+                    gsli_assert(false, "invalid trace record");
+                    return 0;
+            };
+        }
+        case trace_args::gsli_long:
+        {
+            gsli_assert(rec.m_op == trace_op::pow_int, "invalid trace record");
+
+            gsli_double x   = make_gsli(rec.m_arg_1);
+            long n          = long(int64_t(rec.m_arg_2));
+
+            return trace_bits(pow_int(x, n));
+        }
+        case trace_args::gsli_gsli:
+            return eval_binary(rec.m_op, make_gsli(rec.m_arg_1), make_gsli(rec.m_arg_2));
+        case trace_args::gsli_real:
+            return eval_binary(rec.m_op, make_gsli(rec.m_arg_1), make_double(rec.m_arg_2));
+        case trace_args::real_gsli:
+            return eval_binary(rec.m_op, make_double(rec.m_arg_1), make_gsli(rec.m_arg_2));
+        default:
+            gsli_assert(false, "invalid trace record");
+            return 0;
+    };
+};
+
+GSLI_INLINE
+const char* trace_op_name(trace_op op)
+{
+    switch (op)
+    {
+        case trace_op::plus:        return "plus";
+        case trace_op::mult:        return "mult";
+        case trace_op::div:         return "div";
+        case trace_op::pow_abs:     return "pow_abs";
+        case trace_op::pow_int:     return "pow_int";
+        case trace_op::inv:         return "inv";
+        case trace_op::exp:         return "exp";
+        case trace_op::log:         return "log";
+        case trace_op::cmp_gt:      return "cmp_gt";
+        case trace_op::cmp_lt:      return "cmp_lt";
+        case trace_op::cmp_geq:     return "cmp_geq";
+        case trace_op::cmp_leq:     return "cmp_leq";
+        default:                    return "unknown";
+    };
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,507 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_vector.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_error.h"
+#include "gsli/details/gsli_batch.h"
+
+#include <cmath>
+#include <limits>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        allocator
+//----------------------------------------------------------------------
+GSLI_INLINE
+void* details::aligned_malloc(size_t size, size_t align)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(size, align);
+#else
+    void* ptr   = nullptr;
+
+    if (posix_memalign(&ptr, align, size) != 0)
+        return nullptr;
+
+    return ptr;
+#endif
+};
+
+GSLI_INLINE
+void details::aligned_free(void* ptr)
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+};
+
+//----------------------------------------------------------------------
+//                        classification
+//----------------------------------------------------------------------
+using vector_config = gsli_double::config_type;
+
+// offset of level 0 in level counts
+static const int vector_level_0     = vector_config::max_level + 1;
+
+// bounds of moderate numbers; see chunk_summary
+static constexpr double vector_max_moderate = vector_config::max_index_0_sqrt;
+static constexpr double vector_min_moderate = 1.0 / vector_max_moderate;
+
+// offset of level of x in level counts; -1 for NaN; zeros have level 0
+static int vector_level_pos(const gsli_double& x)
+{
+    // internal representation of level 0 numbers is the value itself
+    double a    = std::abs(x.get_internal_rep());
+
+    if (a == 0.0 || (a >= vector_config::min_index_0 && a <= vector_config::max_index_0))
+        return vector_level_0;
+
+    if (a != a)
+        return -1;
+
+    gsli_rep rep;
+    x.get_gsli_rep(rep);
+    return rep.level() + vector_level_0;
+};
+
+// return true if x is a moderate number other than zero
+static bool vector_is_moderate(const gsli_double& x)
+{
+    double a    = std::abs(x.get_internal_rep());
+    return a >= vector_min_moderate && a <= vector_max_moderate;
+};
+
+//----------------------------------------------------------------------
+//                        gsli_vector
+//----------------------------------------------------------------------
+GSLI_INLINE
+gsli_vector::gsli_vector()
+{};
+
+GSLI_INLINE
+gsli_vector::gsli_vector(size_t n)
+{
+    resize(n);
+};
+
+GSLI_INLINE
+gsli_vector::gsli_vector(const gsli_double* x, size_t n)
+{
+    assign(x, n);
+};
+
+GSLI_INLINE
+void gsli_vector::set(size_t i, const gsli_double& x)
+{
+    gsli_assert(i < m_data.size(), "index out of range");
+
+    size_t k    = i / fixed_chunk_size;
+
+    count(k, m_data[i], -1);
+    m_data[i]   = x;
+    count(k, x, 1);
+};
+
+GSLI_INLINE
+void gsli_vector::push_back(const gsli_double& x)
+{
+    if (m_data.size() % fixed_chunk_size == 0)
+        m_counts.push_back(chunk_counts());
+
+    m_data.push_back(x);
+    count(m_counts.size() - 1, x, 1);
+};
+
+GSLI_INLINE
+void gsli_vector::resize(size_t n)
+{
+    size_t old_size = m_data.size();
+
+    m_data.resize(n);
+    m_counts.resize((n + fixed_chunk_size - 1) / fixed_chunk_size);
+
+    // only the last chunk of shorter vector and new chunks must be counted
+    size_t first    = std::min(old_size, n) / fixed_chunk_size;
+    recount(first, m_counts.size());
+};
+
+GSLI_INLINE
+void gsli_vector::assign(const gsli_double* x, size_t n)
+{
+    m_data.assign(x, x + n);
+    m_counts.assign((n + fixed_chunk_size - 1) / fixed_chunk_size, chunk_counts());
+
+    recount(0, m_counts.size());
+};
+
+GSLI_INLINE
+void gsli_vector::count(size_t k, const gsli_double& x, int inc)
+{
+    chunk_counts& c = m_counts[k];
+    int pos         = vector_level_pos(x);
+
+    if (pos < 0)
+    {
+        c.m_nan     = uint16_t(c.m_nan + inc);
+        return;
+    };
+
+    c.m_level[pos]  = uint16_t(c.m_level[pos] + inc);
+
+    if (x.get_internal_rep() == 0.0)
+        c.m_zero    = uint16_t(c.m_zero + inc);
+    else if (vector_is_moderate(x) == true)
+        c.m_moderate= uint16_t(c.m_moderate + inc);
+};
+
+GSLI_INLINE
+void gsli_vector::recount(size_t first, size_t last)
+{
+    last            = std::min(last, m_counts.size());
+
+    for (size_t k = first; k < last; ++k)
+    {
+        m_counts[k]             = chunk_counts();
+        const gsli_double* ptr  = m_data.data() + k * fixed_chunk_size;
+        size_t len              = chunk_length(k);
+
+        for (size_t i = 0; i < len; ++i)
+            count(k, ptr[i], 1);
+    };
+};
+
+GSLI_INLINE
+void gsli_vector::recount_level_0(size_t k)
+{
+    const gsli_double* ptr  = m_data.data() + k * fixed_chunk_size;
+    size_t len              = chunk_length(k);
+
+    size_t n_zero, n_moderate;
+    details::count_moderate(ptr, len, &n_zero, &n_moderate);
+
+    chunk_counts& c         = m_counts[k];
+    c                       = chunk_counts();
+    c.m_level[vector_level_0]   = uint16_t(len);
+    c.m_zero                = uint16_t(n_zero);
+    c.m_moderate            = uint16_t(n_moderate);
+};
+
+GSLI_INLINE
+chunk_summary gsli_vector::summary(size_t k) const
+{
+    const chunk_counts& c   = m_counts[k];
+    size_t len              = chunk_length(k);
+
+    chunk_summary res;
+    res.m_min_level     = config_type::max_level + 1;
+    res.m_max_level     = -(config_type::max_level + 1);
+
+    // zeros are counted as level 0 numbers, but have the lowest level
+    // in summaries
+    if (c.m_zero > 0)
+    {
+        res.m_min_level = -(config_type::max_level + 1);
+        res.m_max_level = -(config_type::max_level + 1);
+    };
+
+    for (int pos = 0; pos < n_levels; ++pos)
+    {
+        size_t n_pos    = c.m_level[pos];
+
+        if (pos == vector_level_0)
+            n_pos       -= c.m_zero;
+
+        if (n_pos == 0)
+            continue;
+
+        res.m_min_level = std::min(res.m_min_level, pos - vector_level_0);
+        res.m_max_level = std::max(res.m_max_level, pos - vector_level_0);
+    };
+
+    res.m_all_level_0   = c.m_level[vector_level_0] == len;
+    res.m_all_moderate  = size_t(c.m_moderate) + c.m_zero == len;
+    res.m_has_zero      = c.m_zero > 0;
+    res.m_has_nan       = c.m_nan > 0;
+    res.m_has_special   = c.m_nan > 0 || c.m_level[n_levels - 1] > 0;
+
+    return res;
+};
+
+GSLI_INLINE
+bool gsli_vector::any_nan() const
+{
+    for (const chunk_counts& c : m_counts)
+    {
+        if (c.m_nan > 0)
+            return true;
+    };
+
+    return false;
+};
+
+GSLI_INLINE
+bool gsli_vector::any_special() const
+{
+    for (const chunk_counts& c : m_counts)
+    {
+        if (c.m_nan > 0 || c.m_level[n_levels - 1] > 0)
+            return true;
+    };
+
+    return false;
+};
+
+GSLI_INLINE
+bool gsli_vector::all_level_0() const
+{
+    for (size_t k = 0; k < m_counts.size(); ++k)
+    {
+        if (m_counts[k].m_level[vector_level_0] != chunk_length(k))
+            return false;
+    };
+
+    return true;
+};
+
+GSLI_INLINE
+int gsli_vector::min_level() const
+{
+    int res         = config_type::max_level + 1;
+    bool found      = false;
+
+    for (size_t k = 0; k < m_counts.size(); ++k)
+    {
+        chunk_summary s = summary(k);
+
+        if (s.m_min_level > s.m_max_level)
+            continue;
+
+        res         = std::min(res, s.m_min_level);
+        found       = true;
+    };
+
+    return found == true ? res : 0;
+};
+
+GSLI_INLINE
+int gsli_vector::max_level() const
+{
+    int res         = -(config_type::max_level + 1);
+    bool found      = false;
+
+    for (size_t k = 0; k < m_counts.size(); ++k)
+    {
+        chunk_summary s = summary(k);
+
+        if (s.m_min_level > s.m_max_level)
+            continue;
+
+        res         = std::max(res, s.m_max_level);
+        found       = true;
+    };
+
+    return found == true ? res : 0;
+};
+
+GSLI_INLINE
+gsli_double gsli_vector::max_abs() const
+{
+    if (m_data.empty() == true)
+        return gsli_double();
+
+    // levels are increasing functions of absolute values
+    int top         = -(config_type::max_level + 1);
+    bool found      = false;
+
+    for (size_t k = 0; k < m_counts.size(); ++k)
+    {
+        chunk_summary s = summary(k);
+
+        if (s.m_min_level > s.m_max_level)
+            continue;
+
+        top         = std::max(top, s.m_max_level);
+        found       = true;
+    };
+
+    if (found == false)
+        return gsli_double(std::numeric_limits<double>::quiet_NaN());
+
+    gsli_double res;
+
+    for (size_t k = 0; k < m_counts.size(); ++k)
+    {
+        if (summary(k).m_max_level != top)
+            continue;
+
+        const gsli_double* ptr  = m_data.data() + k * fixed_chunk_size;
+        size_t len              = chunk_length(k);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            if (vector_level_pos(ptr[i]) < 0)
+                continue;
+
+            gsli_double a   = abs(ptr[i]);
+
+            if (a > res)
+                res         = a;
+        };
+    };
+
+    return res;
+};
+
+GSLI_INLINE
+bool gsli_vector::is_moderate_chunk(size_t k, bool allow_zero) const
+{
+    const chunk_counts& c   = m_counts[k];
+    size_t n_moderate       = size_t(c.m_moderate) + (allow_zero == true ? c.m_zero : 0);
+
+    return n_moderate == chunk_length(k);
+};
+
+GSLI_INLINE
+void gsli_vector::eval_binary(const gsli_vector& x, const gsli_vector& y, gsli_vector& res,
+                    bool allow_zero, binary_kernel fast, binary_kernel general)
+{
+    gsli_assert(x.size() == y.size(), "invalid vector size");
+
+    size_t n        = x.size();
+
+    // res can be x or y; all chunks are counted below
+    res.m_data.resize(n);
+    res.m_counts.resize(x.num_chunks());
+
+    for (size_t k = 0; k < x.num_chunks(); ++k)
+    {
+        size_t first    = k * fixed_chunk_size;
+        size_t len      = x.chunk_length(k);
+        bool is_fast    = x.is_moderate_chunk(k, allow_zero) == true
+                        && y.is_moderate_chunk(k, allow_zero) == true;
+
+        if (is_fast == true)
+        {
+            fast(x.data() + first, y.data() + first, res.m_data.data() + first, len);
+            res.recount_level_0(k);
+        }
+        else
+        {
+            general(x.data() + first, y.data() + first, res.m_data.data() + first, len);
+            res.recount(k, k + 1);
+        };
+    };
+};
+
+//----------------------------------------------------------------------
+//                        batch functions
+//----------------------------------------------------------------------
+GSLI_INLINE
+void plus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res)
+{
+    gsli_vector::eval_binary(x, y, res, true, &details::plus_level_0, &plus);
+};
+
+GSLI_INLINE
+void minus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res)
+{
+    gsli_vector::eval_binary(x, y, res, true, &details::minus_level_0, &minus);
+};
+
+GSLI_INLINE
+void mult(const gsli_vector& x, const gsli_vector& y, gsli_vector& res)
+{
+    // signs of products of zeros differ from signs of double products
+    gsli_vector::eval_binary(x, y, res, false, &details::mult_level_0, &mult);
+};
+
+GSLI_INLINE
+gsli_double sum(const gsli_vector& x)
+{
+    // if |acc| <= max_index_0/4, then |acc| + 1024 * max_index_0_sqrt <= 
+    // max_index_0/2; if also acc = 0 or |acc| >= 1/max_index_0_sqrt, then
+    // all partial sums are zeros or multiples of ulp(1/max_index_0_sqrt);
+    // therefore every addition satisfies conditions of result_add_level_0
+    // or adds zeros, and is equal to double addition
+    static constexpr double max_acc = vector_config::max_index_0 / 4.0;
+
+    static_assert(gsli_vector::fixed_chunk_size * vector_max_moderate 
+                    <= vector_config::max_index_0 / 4.0, "chunk is too long");
+
+    gsli_double res;
+
+    for (size_t k = 0; k < x.num_chunks(); ++k)
+    {
+        span<const gsli_double> chunk   = x.chunk(k);
+        const gsli_double* ptr          = chunk.data();
+        size_t len                      = chunk.size();
+
+        double acc      = res.get_internal_rep();
+        double abs_acc  = std::abs(acc);
+        bool acc_ok     = abs_acc == 0.0 
+                        || (abs_acc >= vector_min_moderate && abs_acc <= max_acc);
+
+        if (acc_ok == true && x.summary(k).m_all_moderate == true)
+        {
+            for (size_t i = 0; i < len; ++i)
+                acc     = acc + ptr[i].get_internal_rep();
+
+            res         = gsli_double(acc, gsli_double::float_rep());
+            continue;
+        };
+
+        for (size_t i = 0; i < len; ++i)
+            res         = res + ptr[i];
+    };
+
+    return res;
+};
+
+GSLI_INLINE
+void get_value(const gsli_vector& x, double* res)
+{
+    for (size_t k = 0; k < x.num_chunks(); ++k)
+    {
+        span<const gsli_double> chunk   = x.chunk(k);
+        double* out                     = res + k * gsli_vector::chunk_size();
+
+        if (x.summary(k).m_all_level_0 == false)
+        {
+            get_value(chunk.data(), out, chunk.size());
+            continue;
+        };
+
+        // internal representation of level 0 numbers is the value itself
+        for (size_t i = 0; i < chunk.size(); ++i)
+            out[i]      = chunk.data()[i].get_internal_rep();
+    };
+};
+
+};
\ No newline at end of file
@@ -21,4 +21,50 @@
 #pragma once 
 
 // when this macro is defined, then different checks are enabled
-//#define GSLI_DEBUG
\ No newline at end of file
+//#define GSLI_DEBUG
+
+// when this macro is defined, then level-k operations use faster
+// approximations of exp and log functions; error of indices of level-k
+// numbers can increase to few ulp
+//#define GSLI_FAST_MATH
+
+// when this macro is defined, then every thread counts calls of fast paths
+// and general versions of operations on gsli_double; see gsli_counters.h
+//#define GSLI_COUNTERS
+
+// when this macro is defined, then calls of general versions of operations
+// on gsli_double can be recorded; see gsli_trace.h
+//#define GSLI_TRACE
+
+// when this macro is defined, then the library is header-only: sources
+// of the library are included by gsli/gsli.h and need not be compiled
+// separately, and all functions defined there are inline; this allows a
+// compiler to inline general versions of operations into callers; in this
+// mode gsli/gsli.h must be included before other headers of the library,
+// and C++17 is required
+//#define GSLI_HEADER_ONLY
+
+#if defined(GSLI_HEADER_ONLY) && !defined(GSLI_MAIN_HEADER)
+    #error "gsli/gsli.h must be included first when GSLI_HEADER_ONLY is defined"
+#endif
+
+// force inlining of a function; functions marked by this macro are
+// called on fast paths and must be inlined even in debug builds
+#if defined(_MSC_VER)
+    #define GSLI_FORCE_INLINE   __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+    #define GSLI_FORCE_INLINE   inline __attribute__((always_inline))
+#else
+    #define GSLI_FORCE_INLINE   inline
+#endif
+
+// specifiers of functions and variables defined in sources of the library;
+// in header-only mode functions are inline and variables with static
+// storage duration are inline variables shared by all translation units
+#ifdef GSLI_HEADER_ONLY
+    #define GSLI_INLINE         inline
+    #define GSLI_STATIC_VAR     inline
+#else
+    #define GSLI_INLINE
+    #define GSLI_STATIC_VAR     static
+#endif
\ No newline at end of file
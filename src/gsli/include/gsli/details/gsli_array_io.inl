@@ -0,0 +1,71 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_array_io.h"
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        span
+//----------------------------------------------------------------------
+template<class T>
+inline span<T> span<T>::subspan(size_t offset, size_t count) const
+{
+    if (offset > m_size)
+        offset  = m_size;
+
+    if (count > m_size - offset)
+        count   = m_size - offset;
+
+    return span(m_data + offset, count);
+};
+
+//----------------------------------------------------------------------
+//                        mapped_array
+//----------------------------------------------------------------------
+inline bool mapped_array::is_open() const
+{
+    return m_map != nullptr;
+};
+
+inline const gsli_double* mapped_array::data() const
+{
+    return m_data;
+};
+
+inline size_t mapped_array::size() const
+{
+    return m_size;
+};
+
+inline span<const gsli_double> mapped_array::elements() const
+{
+    return span<const gsli_double>(m_data, m_size);
+};
+
+inline const array_header& mapped_array::header() const
+{
+    return m_header;
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,187 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace sli
+{
+
+class gsli_double;
+class gsli_prob;
+
+namespace details
+{
+
+//----------------------------------------------------------------------
+//                        instruction sets
+//----------------------------------------------------------------------
+// instruction sets, for which batch kernels are compiled; values are
+// ordered; every x86-64 CPU supports sse2
+enum class batch_isa : int
+{
+    sse2    = 0,
+    avx2    = 1,
+    avx512  = 2
+};
+
+// number of elements of batch_isa
+static const int batch_isa_count    = 3;
+
+// name of environment variable, that can be used to override selection
+// of batch kernels; allowed values are "sse2", "avx2" and "avx512";
+// if required instruction set is not supported, then the best supported
+// instruction set is used
+#define GSLI_BATCH_ISA_ENV  "GSLI_BATCH_ISA"
+
+// function attributes used to compile batch kernels for given instruction
+// set; for other compilers than gcc or clang all kernels are compiled for
+// instruction set selected in compiler options; AVX-512 provides fma
+// instructions, and contraction of multiplications and additions must be
+// disabled, otherwise results would depend on the instruction set (clang
+// requires -ffp-contract=off option)
+#if defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+    #define GSLI_TARGET_SSE2    __attribute__((target("sse2")))
+    #define GSLI_TARGET_AVX2    __attribute__((target("avx2")))
+    #define GSLI_TARGET_AVX512  __attribute__((target("avx512f,avx512dq")))
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define GSLI_TARGET_SSE2    __attribute__((target("sse2")))
+    #define GSLI_TARGET_AVX2    __attribute__((target("avx2")))
+    #define GSLI_TARGET_AVX512  __attribute__((target("avx512f,avx512dq"), \
+                                    optimize("fp-contract=off")))
+#else
+    #define GSLI_TARGET_SSE2
+    #define GSLI_TARGET_AVX2
+    #define GSLI_TARGET_AVX512
+#endif
+
+//----------------------------------------------------------------------
+//                        batch kernels
+//----------------------------------------------------------------------
+// table of batch kernels compiled for one instruction set; all kernels
+// evaluate functions for n elements of arrays x (and y) and store results
+// in res, which must have at least n elements; results do not depend on
+// selected instruction set
+struct batch_kernels
+{
+    // math kernels; see exp_kernel and log_kernel
+    void        (*exp_kernel)(const double* x, double* res, size_t n);
+    void        (*log_kernel)(const double* x, double* res, size_t n);
+
+    // conversions between double and gsli_double
+    void        (*convert)(const double* x, gsli_double* res, size_t n);
+    void        (*get_value)(const gsli_double* x, double* res, size_t n);
+
+    // arithmetic
+    void        (*plus)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+    void        (*minus)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+    void        (*mult)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+    void        (*div)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+
+    // arithmetic of level 0 numbers; see plus_level_0
+    void        (*plus_level_0)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+    void        (*minus_level_0)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+    void        (*mult_level_0)(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+
+    // classification; see count_moderate
+    void        (*count_moderate)(const gsli_double* x, size_t n, size_t* n_zero, 
+                    size_t* n_moderate);
+
+    // comparison
+    void        (*less)(const gsli_double* x, const gsli_double* y, 
+                    bool* res, size_t n);
+    void        (*greater)(const gsli_double* x, const gsli_double* y, 
+                    bool* res, size_t n);
+    void        (*leq)(const gsli_double* x, const gsli_double* y, 
+                    bool* res, size_t n);
+    void        (*geq)(const gsli_double* x, const gsli_double* y, 
+                    bool* res, size_t n);
+    void        (*eq)(const gsli_double* x, const gsli_double* y, 
+                    bool* res, size_t n);
+
+    // reductions
+    gsli_double (*sum)(const gsli_double* x, size_t n);
+    gsli_double (*prod)(const gsli_double* x, size_t n);
+    gsli_prob   (*sum_prob)(const gsli_prob* x, size_t n);
+
+    // decoding of compressed blocks; see codec_unpack
+    void        (*codec_unpack)(const unsigned char* exp_src, const unsigned char* mant_src,
+                    int exp_bits, int mant_bits, int exp_base, uint64_t* res, size_t n);
+};
+
+// return the best instruction set supported by the CPU and the operating
+// system; detection is based on cpuid instruction
+batch_isa       detect_batch_isa();
+
+// return instruction set, for which batch kernels are used; this is the
+// instruction set returned by detect_batch_isa, unless different instruction
+// set is required by the GSLI_BATCH_ISA environment variable
+batch_isa       select_batch_isa();
+
+// return name of an instruction set
+const char*     batch_isa_name(batch_isa isa);
+
+// fill table with batch kernels compiled for given instruction set;
+// return false, if this instruction set is not supported by the CPU;
+// then table is not modified
+bool            init_batch_kernels(batch_isa isa, batch_kernels& table);
+
+// initializers of tables for given instruction set; no checks are performed
+void            init_batch_kernels_sse2(batch_kernels& table);
+void            init_batch_kernels_avx2(batch_kernels& table);
+void            init_batch_kernels_avx512(batch_kernels& table);
+
+// evaluate x[i] op y[i] by double arithmetic using selected batch kernels;
+// conditions of result_add_level_0 (result_mult_level_0 for mult) must
+// hold for all x[i], y[i], or, for plus and minus, x[i] or y[i] can be 
+// zero; then results are equal to results of plus, minus and mult
+void            plus_level_0(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+void            minus_level_0(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+void            mult_level_0(const gsli_double* x, const gsli_double* y, 
+                    gsli_double* res, size_t n);
+
+// count zeros and numbers x, such that |x| is in [1/max_index_0_sqrt, 
+// max_index_0_sqrt] among n elements of x using selected batch kernels;
+// results are stored in n_zero and n_moderate
+void            count_moderate(const gsli_double* x, size_t n, size_t* n_zero, 
+                    size_t* n_moderate);
+
+// decode n <= codec_block_size fields of a compressed block using selected
+// batch kernels; exp_src and mant_src are streams of exponent fields of
+// exp_bits bits and mantissa fields of mant_bits + 1 bits (including sign);
+// nonzero exponent field e encodes biased exponent e + exp_base - 1; 
+// result are bit patterns of internal representations
+void            codec_unpack(const unsigned char* exp_src, const unsigned char* mant_src,
+                    int exp_bits, int mant_bits, int exp_base, uint64_t* res, size_t n);
+
+}};
\ No newline at end of file
@@ -0,0 +1,358 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_functions.h"
+#include "gsli/gsli_prob.h"
+#include "gsli/details/gsli_batch.h"
+#include "gsli/details/gsli_math.h"
+
+#include <cstring>
+
+// implementation of batch kernels; this file is included by source files
+// compiling kernels for given instruction set, which must define:
+//      GSLI_BATCH_NAMESPACE    - namespace of kernels
+//      GSLI_BATCH_TARGET       - function attributes selecting instruction set
+// all headers are included before GSLI_BATCH_TARGET is used, therefore
+// inline functions from these headers are compiled for the default
+// instruction set, when they are not inlined into kernels; this file is
+// included once for every instruction set, therefore it is not guarded by
+// #pragma once, and both macros are undefined at the end
+
+#if !defined(GSLI_BATCH_NAMESPACE) || !defined(GSLI_BATCH_TARGET)
+    #error "GSLI_BATCH_NAMESPACE and GSLI_BATCH_TARGET must be defined"
+#endif
+
+namespace sli { namespace details { namespace GSLI_BATCH_NAMESPACE
+{
+
+//----------------------------------------------------------------------
+//                        math kernels
+//----------------------------------------------------------------------
+GSLI_BATCH_TARGET
+static void exp_kernel(const double* x, double* res, size_t n)
+{
+    // first loop does not contain branches and can be vectorized
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = math_kernel::exp_core(x[i]);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (math_kernel::is_exp_core_arg(x[i]) == false)
+            res[i]  = math_kernel::exp_large(x[i]);
+    };
+};
+
+GSLI_BATCH_TARGET
+static void log_kernel(const double* x, double* res, size_t n)
+{
+    // first loop does not contain branches and can be vectorized
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = math_kernel::log_core(x[i]);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (math_kernel::is_log_core_arg(x[i]) == false)
+            res[i]  = math_kernel::log_special(x[i]);
+    };
+};
+
+//----------------------------------------------------------------------
+//                        conversions
+//----------------------------------------------------------------------
+GSLI_BATCH_TARGET
+static void convert(const double* x, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = gsli_double(x[i]);
+};
+
+GSLI_BATCH_TARGET
+static void get_value(const gsli_double* x, double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i].get_value();
+};
+
+//----------------------------------------------------------------------
+//                        arithmetic
+//----------------------------------------------------------------------
+GSLI_BATCH_TARGET
+static void plus(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] + y[i];
+};
+
+GSLI_BATCH_TARGET
+static void minus(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] - y[i];
+};
+
+GSLI_BATCH_TARGET
+static void mult(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] * y[i];
+};
+
+GSLI_BATCH_TARGET
+static void div(const gsli_double* x, const gsli_double* y, gsli_double* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] / y[i];
+};
+
+// arithmetic of level 0 numbers; these loops do not contain branches and
+// can be vectorized
+GSLI_BATCH_TARGET
+static void plus_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                         size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        res[i]  = gsli_double(x[i].get_internal_rep() + y[i].get_internal_rep(), 
+                              gsli_double::float_rep());
+    };
+};
+
+GSLI_BATCH_TARGET
+static void minus_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                          size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        res[i]  = gsli_double(x[i].get_internal_rep() - y[i].get_internal_rep(), 
+                              gsli_double::float_rep());
+    };
+};
+
+GSLI_BATCH_TARGET
+static void mult_level_0(const gsli_double* x, const gsli_double* y, gsli_double* res, 
+                         size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        res[i]  = gsli_double(x[i].get_internal_rep() * y[i].get_internal_rep(), 
+                              gsli_double::float_rep());
+    };
+};
+
+//----------------------------------------------------------------------
+//                        classification
+//----------------------------------------------------------------------
+// bit patterns of nonnegative doubles are ordered as values; this loop
+// does not contain branches and can be vectorized
+GSLI_BATCH_TARGET
+static void count_moderate(const gsli_double* x, size_t n, size_t* n_zero, 
+                           size_t* n_moderate)
+{
+    using config                = gsli_double::config_type;
+    static constexpr double max = config::max_index_0_sqrt;
+    static constexpr double min = 1.0 / max;
+
+    uint64_t min_bits, max_bits;
+    std::memcpy(&min_bits, &min, sizeof(min_bits));
+    std::memcpy(&max_bits, &max, sizeof(max_bits));
+
+    const uint64_t abs_mask     = ~(uint64_t(1) << 63);
+    const uint64_t range        = max_bits - min_bits;
+
+    uint64_t zeros              = 0;
+    uint64_t moderate           = 0;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &x[i].get_internal_rep(), sizeof(bits));
+
+        bits        &= abs_mask;
+        zeros       += uint64_t(bits == 0);
+        moderate    += uint64_t(bits - min_bits <= range);
+    };
+
+    *n_zero         = size_t(zeros);
+    *n_moderate     = size_t(moderate);
+};
+
+//----------------------------------------------------------------------
+//                        comparison
+//----------------------------------------------------------------------
+GSLI_BATCH_TARGET
+static void less(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] < y[i];
+};
+
+GSLI_BATCH_TARGET
+static void greater(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] > y[i];
+};
+
+GSLI_BATCH_TARGET
+static void leq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] <= y[i];
+};
+
+GSLI_BATCH_TARGET
+static void geq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] >= y[i];
+};
+
+GSLI_BATCH_TARGET
+static void eq(const gsli_double* x, const gsli_double* y, bool* res, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        res[i]  = x[i] == y[i];
+};
+
+//----------------------------------------------------------------------
+//                        reductions
+//----------------------------------------------------------------------
+// elements are summed sequentially; results do not depend on instruction
+// set
+GSLI_BATCH_TARGET
+static gsli_double sum(const gsli_double* x, size_t n)
+{
+    gsli_double res;
+
+    for (size_t i = 0; i < n; ++i)
+        res     = res + x[i];
+
+    return res;
+};
+
+GSLI_BATCH_TARGET
+static gsli_double prod(const gsli_double* x, size_t n)
+{
+    gsli_double res(1.0);
+
+    for (size_t i = 0; i < n; ++i)
+        res     = res * x[i];
+
+    return res;
+};
+
+GSLI_BATCH_TARGET
+static gsli_prob sum_prob(const gsli_prob* x, size_t n)
+{
+    gsli_prob res;
+
+    for (size_t i = 0; i < n; ++i)
+        res     = res + x[i];
+
+    return res;
+};
+
+//----------------------------------------------------------------------
+//                        codec
+//----------------------------------------------------------------------
+// field i of a stream of w-bit fields is read by one unaligned 64-bit
+// load; streams must be followed by at least 8 readable bytes
+GSLI_BATCH_TARGET
+static void codec_unpack(const unsigned char* exp_src, const unsigned char* mant_src,
+                int exp_bits, int mant_bits, int exp_base, uint64_t* res, size_t n)
+{
+    const int mant_width    = mant_bits + 1;
+    const int shift         = 52 - mant_bits;
+    const uint64_t exp_mask = (uint64_t(1) << exp_bits) - 1;
+    const uint64_t mant_mask= (uint64_t(1) << mant_width) - 1;
+    const uint64_t frac_mask= (uint64_t(1) << mant_bits) - 1;
+    const uint64_t base     = uint64_t(exp_base - 1);
+
+    const size_t chunk      = 256;
+    uint64_t exps[chunk];
+
+    for (size_t first = 0; first < n; first += chunk)
+    {
+        size_t len          = n - first < chunk ? n - first : chunk;
+        uint64_t* out       = res + first;
+
+        // extraction of fields; loads from unaligned byte addresses are
+        // not vectorized
+        for (size_t i = 0; i < len; ++i)
+        {
+            size_t pos_e    = (first + i) * size_t(exp_bits);
+            size_t pos_m    = (first + i) * size_t(mant_width);
+
+            uint64_t e, m;
+            std::memcpy(&e, exp_src + (pos_e >> 3), sizeof(e));
+            std::memcpy(&m, mant_src + (pos_m >> 3), sizeof(m));
+
+            exps[i]         = (e >> (pos_e & 7)) & exp_mask;
+            out[i]          = (m >> (pos_m & 7)) & mant_mask;
+        };
+
+        // assembly of bit patterns; this loop does not contain branches and
+        // can be vectorized; exponent field 0 encodes signed zero
+        for (size_t i = 0; i < len; ++i)
+        {
+            uint64_t e      = exps[i];
+            uint64_t m      = out[i];
+            uint64_t sign   = (m >> mant_bits) << 63;
+            uint64_t nz     = uint64_t(0) - uint64_t(e != 0);
+            uint64_t body   = ((e + base) << 52) | ((m & frac_mask) << shift);
+
+            out[i]          = sign | (body & nz);
+        };
+    };
+};
+
+//----------------------------------------------------------------------
+//                        table of kernels
+//----------------------------------------------------------------------
+static void init_table(batch_kernels& table)
+{
+    table.exp_kernel    = &exp_kernel;
+    table.log_kernel    = &log_kernel;
+    table.convert       = &convert;
+    table.get_value     = &get_value;
+    table.plus          = &plus;
+    table.minus         = &minus;
+    table.mult          = &mult;
+    table.div           = &div;
+    table.plus_level_0  = &plus_level_0;
+    table.minus_level_0 = &minus_level_0;
+    table.mult_level_0  = &mult_level_0;
+    table.count_moderate= &count_moderate;
+    table.less          = &less;
+    table.greater       = &greater;
+    table.leq           = &leq;
+    table.geq           = &geq;
+    table.eq            = &eq;
+    table.sum           = &sum;
+    table.prod          = &prod;
+    table.sum_prob      = &sum_prob;
+    table.codec_unpack  = &codec_unpack;
+};
+
+}}};
+
+#undef GSLI_BATCH_NAMESPACE
+#undef GSLI_BATCH_TARGET
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_codec.h"
+
+namespace sli
+{
+
+inline size_t compressed_array::size() const
+{
+    return m_size;
+};
+
+inline size_t compressed_array::num_blocks() const
+{
+    return m_offsets.size();
+};
+
+inline size_t compressed_array::block_length(size_t i) const
+{
+    size_t first    = i * codec_block_size;
+    return std::min(codec_block_size, m_size - first);
+};
+
+inline int compressed_array::block_min_level(size_t i) const
+{
+    return int(int8_t(m_data[size_t(m_offsets[i]) + 6]));
+};
+
+inline int compressed_array::block_max_level(size_t i) const
+{
+    return int(int8_t(m_data[size_t(m_offsets[i]) + 7]));
+};
+
+};
\ No newline at end of file
@@ -22,8 +22,11 @@
 
 #include "gsli/config.h"
 #include "gsli/details/gsli_constants_impl.h"
+#include "gsli/details/gsli_batch.h"
 
 #include <limits>
+#include <cmath>
+#include <stdint.h>
 
 namespace sli
 {
@@ -126,6 +129,13 @@ struct config
     // use exponent decode table during decoding level
     static const bool use_decode_table  = true;
 
+    // use relaxed accuracy exp and log functions in level-k operations
+#ifdef GSLI_FAST_MATH
+    static const bool fast_math         = true;
+#else
+    static const bool fast_math         = false;
+#endif
+
     //----------------------------------------------------------
     //                  tests of parameters
     //----------------------------------------------------------
@@ -305,6 +315,35 @@ class global_constants
         // exponent -> level map used during decoding
         int     m_decode_exp[m_exp_map_size];
 
+        // bit patterns of the smallest and the largest encoded absolute
+        // value on given level; used by nextabove, nextbelow, float_distance
+        uint64_t m_band_first[2*config_type::max_level + 2 + 1];
+        uint64_t m_band_last[2*config_type::max_level + 2 + 1];
+
+        // ordinal number of encoded absolute value with bit pattern b on
+        // level k is m_ord_base[k] + m_ord_dir[k] * b; ordinal numbers
+        // are increasing with values, zero has ordinal 0
+        int64_t m_ord_base[2*config_type::max_level + 2 + 1];
+        int64_t m_ord_dir[2*config_type::max_level + 2 + 1];
+
+        // ordinal number of the smallest absolute value on given level
+        int64_t m_ord_first[2*config_type::max_level + 2 + 1];
+
+        // instruction set, for which batch kernels are used
+        details::batch_isa  m_batch_isa;
+
+        // batch kernels compiled for m_batch_isa
+        details::batch_kernels  m_batch_kernels;
+
+    public:
+        // return position of level of encoded absolute value with bit
+        // pattern abs_bits in tables indexed by level
+        int     level_pos(uint64_t abs_bits) const;
+
+        // return ordinal number of encoded absolute value with bit 
+        // pattern abs_bits; abs_bits cannot encode NaN
+        int64_t abs_ordinal(uint64_t abs_bits) const;
+
     private:
         void    initialize();
         void    init_pow2_pplevel(double* data);
@@ -314,12 +353,28 @@ class global_constants
         void    initialize_pow2_pos_decode(double* data);
         void    initialize_pow2_neg_decode(double* data);
         void    initialize_decode_exp(int* data);
+        void    initialize_ordinal();
+        void    initialize_batch();
 
         void    destroy();
 
         friend struct global_constants_initializer;
 };
 
+inline int global_constants::level_pos(uint64_t abs_bits) const
+{
+    static_assert(use_decode_table == true, "level_pos requires decode table");
+
+    int exp_bias    = int(abs_bits >> config_type::precision);
+    return m_decode_exp[exp_bias] + config_type::max_level + 1;
+};
+
+inline int64_t global_constants::abs_ordinal(uint64_t abs_bits) const
+{
+    int pos         = level_pos(abs_bits);
+    return m_ord_base[pos] + m_ord_dir[pos] * int64_t(abs_bits);
+};
+
 extern global_constants g_global_constants;
 
 // initializer of global_constants
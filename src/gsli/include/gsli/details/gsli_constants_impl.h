@@ -23,6 +23,7 @@
 #include "gsli/config.h"
 
 #include <limits>
+#include <cstddef>
 
 namespace sli { namespace details
 {
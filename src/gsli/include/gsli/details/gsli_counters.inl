@@ -0,0 +1,91 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_counters.h"
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        path_counters
+//----------------------------------------------------------------------
+inline uint64_t path_counters::get(counter_op op, counter_path path) const
+{
+    return m_count[int(op)][int(path)];
+};
+
+inline uint64_t path_counters::get_general(counter_op op) const
+{
+    uint64_t res    = 0;
+
+    for (int i = int(counter_path::fast) + 1; i < n_path; ++i)
+        res         += m_count[int(op)][i];
+
+    return res;
+};
+
+//----------------------------------------------------------------------
+//                        counting functions
+//----------------------------------------------------------------------
+inline counter_path details::operand_class(fptype ft)
+{
+    switch (ft)
+    {
+        case fptype::level_0:   return counter_path::level_0;
+        case fptype::level_k:   return counter_path::level_k;
+        default:                return counter_path::special;
+    };
+};
+
+inline counter_path details::operand_class(fptype ft1, fptype ft2)
+{
+    counter_path c1 = operand_class(ft1);
+    counter_path c2 = operand_class(ft2);
+
+    if (c1 == counter_path::special || c2 == counter_path::special)
+        return counter_path::special;
+
+    if (c1 != c2)
+        return counter_path::level_0_k;
+
+    return c1;
+};
+
+inline bool details::count_fast(counter_op op, bool is_fast)
+{
+    if (is_fast == true)
+        ++g_path_counters.m_count[int(op)][int(counter_path::fast)];
+
+    return is_fast;
+};
+
+inline void details::count_general(counter_op op, fptype ft)
+{
+    ++g_path_counters.m_count[int(op)][int(operand_class(ft))];
+};
+
+inline void details::count_general(counter_op op, fptype ft1, fptype ft2)
+{
+    ++g_path_counters.m_count[int(op)][int(operand_class(ft1, ft2))];
+};
+
+};
\ No newline at end of file
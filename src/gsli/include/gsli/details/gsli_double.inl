@@ -36,7 +36,7 @@ inline gsli_double::gsli_double()
 inline gsli_double::gsli_double(double a, float_rep)
     : m_data(a)
 {    
-    gsli_assert(gsli_rep::can_use_float_rep(::abs(a)) == true || a == 0.0,
+    gsli_assert(gsli_rep::can_use_float_rep(std::abs(a)) == true || a == 0.0,
                 "invalid float rep");
 };
 
@@ -114,7 +114,7 @@ inline gsli_double gsli_double::make_infinity(bool sign)
     return gsli_double(encode_data_inf(sign), internal_rep());
 };
 
-__forceinline 
+GSLI_FORCE_INLINE
 void gsli_double::encode_data(double& index, bool sign_index, int signed_level)
 {
     gsli_assert(std::abs(signed_level) == config_type::max_level + 1
@@ -169,20 +169,22 @@ void gsli_double::encode_data(double& index, bool sign_index, int signed_level)
     index           = index * g_global_constants.m_encode_data[pos];
 
     gsli_assert(std::abs(signed_level) == config_type::max_level + 1
-                || ::abs(index) >= config_type::min_value
-                    && ::abs(index) <= config_type::max_value, "invalid encoding");
+                || std::abs(index) >= config_type::min_value
+                    && std::abs(index) <= config_type::max_value, "invalid encoding");
 
     gsli_assert(std::abs(signed_level) == config_type::max_level + 1 
-                || ::abs(index) > config_type::max_index_0
-                || ::abs(index) < config_type::min_index_0, "invalid encoding");
+                || std::abs(index) > config_type::max_index_0
+                || std::abs(index) < config_type::min_index_0, "invalid encoding");
 
     return;
 }
 
-#pragma warning(push)
-#pragma warning(disable : 4127) //conditional expression is constant
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4127) //conditional expression is constant
+#endif
 
-__forceinline
+GSLI_FORCE_INLINE
 void gsli_double::decode_data(const double& data, gsli_rep& rep)
 {
     static const bool use_decode_table  = config_type::use_decode_table;
@@ -263,6 +265,8 @@ void gsli_double::decode_data(const double& data, gsli_rep& rep)
     rep.m_level             = lev;
 };
 
-#pragma warning(pop)
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 };
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+
+#include <string>
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli { namespace details
+{
+
+//----------------------------------------------------------------------
+//                        file mapping
+//----------------------------------------------------------------------
+// thin wrappers of mmap (POSIX) and MapViewOfFile (Windows) used by
+// mapped_array and gsli_mapped_vector
+
+// hints about future accesses of mapped memory
+enum class map_advice : int
+{
+    normal,                 // no special treatment
+    sequential,             // pages are accessed sequentially
+    will_need,              // pages will be accessed soon, read ahead
+    dont_need,              // pages will not be accessed soon
+};
+
+// map whole file to memory; if writable is true, then modifications are
+// written to the file; return null on failure or if file is empty,
+// otherwise size is set to size of the file
+void*           map_file(const std::string& file, bool writable, size_t& size);
+
+// unmap memory mapped by map_file
+void            unmap_file(void* ptr, size_t size);
+
+// give a hint about accesses of [ptr, ptr + size); range is extended to
+// page boundaries; hints are ignored, if not supported
+void            advise_map(const void* ptr, size_t size, map_advice adv);
+
+// write modified pages in [ptr, ptr + size) to the file; return false on
+// failure
+bool            flush_map(void* ptr, size_t size);
+
+// create a file of given size filled with zeros; existing file is
+// truncated; return false on failure
+bool            create_file(const std::string& file, uint64_t size);
+
+}};
\ No newline at end of file
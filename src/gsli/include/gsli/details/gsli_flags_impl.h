@@ -0,0 +1,109 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_flags.h"
+#include "gsli/details/gsli_rep.h"
+
+namespace sli { namespace details
+{
+
+// flags of the calling thread
+extern thread_local unsigned g_range_flags;
+
+// return true if x is zero, infinite or NaN
+inline bool is_special_rep(const gsli_rep& x)
+{
+    return x.is_regular() == false;
+};
+
+// set flags for result res of an operation; has_nan is true if some 
+// operand is NaN, has_special is true if some operand is zero, infinite 
+// or NaN, and exact_zero is true if the exact result is zero; flag_nan
+// is set for NaN results of non-NaN operands, flag_overflow and 
+// flag_underflow only if all operands are finite and nonzero; zero is
+// not an underflow if the exact result is zero
+inline void set_range_flags(const gsli_rep& res, bool has_nan, bool has_special,
+                            bool exact_zero)
+{
+    using config_type   = gsli_rep::config_type;
+
+    int level           = std::abs(res.level());
+
+    if (level == 0)
+        return;
+
+    if (level <= config_type::max_level)
+    {
+        unsigned flags  = flag_level_k;
+
+        if (level == config_type::max_level)
+            flags       |= flag_max_level;
+
+        g_range_flags   |= flags;
+        return;
+    };
+
+    if (res.is_nan() == true)
+    {
+        if (has_nan == false)
+            g_range_flags   |= flag_nan;
+
+        return;
+    };
+
+    if (has_special == true)
+        return;
+
+    if (res.is_zero() == true)
+    {
+        if (exact_zero == false)
+            g_range_flags   |= flag_underflow;
+    }
+    else
+    {
+        g_range_flags   |= flag_overflow;
+    };
+};
+
+// set flags for result res of an unary operation with operand x
+inline void set_range_flags(const gsli_rep& res, const gsli_rep& x, 
+                            bool exact_zero = false)
+{
+    set_range_flags(res, x.is_nan(), is_special_rep(x), exact_zero);
+};
+
+// set flags for result res of a binary operation with operands x1, x2
+inline void set_range_flags(const gsli_rep& res, const gsli_rep& x1, 
+                            const gsli_rep& x2, bool exact_zero = false)
+{
+    set_range_flags(res, x1.is_nan() || x2.is_nan(), 
+                    is_special_rep(x1) || is_special_rep(x2), exact_zero);
+};
+
+// return true if x1 + x2 is exactly zero for regular x1, x2
+inline bool is_exact_cancellation(const gsli_rep& x1, const gsli_rep& x2)
+{
+    return x1.is_regular() == true && x1.level() == x2.level() 
+        && x1.index() == x2.index() && x1.sign_index() != x2.sign_index();
+};
+
+}};
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "gsli/details/gsli_functions_rep.h"
 #include "gsli/gsli_functions.h"
 #include "gsli/gsli_error.h"
+#include "gsli/gsli_counters.h"
 
 #include <algorithm>
 #include <cmath>
@@ -249,49 +250,49 @@ namespace sli
 //----------------------------------------------------------------------
 //                        gsli_double
 //----------------------------------------------------------------------
-inline bool sli::is_zero(const gsli_double& val)
+inline bool is_zero(const gsli_double& val)
 {
     return val.get_internal_rep() == 0.0;
 };
 
-inline bool sli::is_negative(const gsli_double& val)
+inline bool is_negative(const gsli_double& val)
 {
     return val.get_internal_rep() < 0.0;
 };
 
-inline bool sli::is_positive(const gsli_double& val)
+inline bool is_positive(const gsli_double& val)
 {
     return val.get_internal_rep() > 0.0;
 };
 
-inline bool sli::is_signed(const gsli_double& val)
+inline bool is_signed(const gsli_double& val)
 {
     details::double_decoder_const dec(&val.get_internal_rep());
     return dec.get_sign() ? true : false;
 };
 
-inline bool sli::is_nan(const gsli_double& val)
+inline bool is_nan(const gsli_double& val)
 {
     return details::is_nan(val.get_internal_rep());
 };
 
-inline bool sli::is_inf(const gsli_double& val)
+inline bool is_inf(const gsli_double& val)
 {
     return std::abs(val.get_internal_rep()) == std::numeric_limits<double>::infinity();
 };
 
-inline bool sli::is_finite(const gsli_double& val)
+inline bool is_finite(const gsli_double& val)
 {
     return std::abs(val.get_internal_rep()) < std::numeric_limits<double>::infinity();
 };
 
-inline bool sli::is_regular(const gsli_double& val)
+inline bool is_regular(const gsli_double& val)
 {
     return std::abs(val.get_internal_rep()) < std::numeric_limits<double>::infinity()
             && val.get_internal_rep() != 0.0;
 };
 
-inline bool sli::is_int(const gsli_double& val)
+inline bool is_int(const gsli_double& val)
 {
     int v_int   = (int)val.get_internal_rep();
     double v_d  = (double)v_int;
@@ -299,53 +300,53 @@ inline bool sli::is_int(const gsli_double& val)
     return v_d == val.get_internal_rep();
 };
 
-inline fptype sli::fpclassify(const gsli_double& v)
+inline fptype fpclassify(const gsli_double& v)
 {
     gsli_rep rep;
     v.get_gsli_rep(rep);
     return rep.fpclassify();
 }
 
-inline gsli_double sli::operator-(const gsli_double& s)
+inline gsli_double operator-(const gsli_double& s)
 {
 	return gsli_double(-s.get_internal_rep(), gsli_double::internal_rep());
 }
 
-inline gsli_double sli::abs(const gsli_double& s)
+inline gsli_double abs(const gsli_double& s)
 {
-	return gsli_double(::abs(s.get_internal_rep()), gsli_double::internal_rep());
+	return gsli_double(std::abs(s.get_internal_rep()), gsli_double::internal_rep());
 }
 
-inline gsli_double sli::inv(const gsli_double& v)
+inline gsli_double inv(const gsli_double& v)
 {
-    if (details::result_inv_level_0(v.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(inv, details::result_inv_level_0(v.get_internal_rep())) == true)
         return gsli_double(1.0/v.get_internal_rep(), gsli_double::float_rep());
     else
         return details::inv_general(v);
 };
 
-inline gsli_double sli::exp(const gsli_double& v)
+inline gsli_double exp(const gsli_double& v)
 {
-    if (details::result_exp_level_0(v.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(exp, details::result_exp_level_0(v.get_internal_rep())) == true)
         return gsli_double(std::exp(v.get_internal_rep()), gsli_double::float_rep());
     else
         return details::exp_general(v);
 };
 
-inline gsli_double sli::log_abs(const gsli_double& v)
+inline gsli_double log_abs(const gsli_double& v)
 {
-    if (details::result_log_level_0(v.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(log, details::result_log_level_0(v.get_internal_rep())) == true)
         return gsli_double(std::log(std::abs(v.get_internal_rep())), gsli_double::float_rep());
     else
         return details::log_general(v);
 };
 
-inline bool sli::operator==(const gsli_double& x1, const gsli_double& x2)
+inline bool operator==(const gsli_double& x1, const gsli_double& x2)
 {
     return x1.get_internal_rep() == x2.get_internal_rep();
 };
 
-inline bool sli::operator==(const gsli_double& x1, double x2)
+inline bool operator==(const gsli_double& x1, double x2)
 {
     if (details::is_level_0(x2) == true)
         return x1.get_internal_rep() == x2;
@@ -353,7 +354,7 @@ inline bool sli::operator==(const gsli_double& x1, double x2)
         return x1.get_internal_rep() == gsli_double(x2).get_internal_rep();
 };
 
-inline bool sli::operator==(double x1, const gsli_double& x2)
+inline bool operator==(double x1, const gsli_double& x2)
 {
     if (details::is_level_0(x1) == true)
         return x1 == x2.get_internal_rep();
@@ -361,12 +362,12 @@ inline bool sli::operator==(double x1, const gsli_double& x2)
         return gsli_double(x1).get_internal_rep() == x2.get_internal_rep();
 };
 
-inline bool sli::operator!=(const gsli_double& x1, const gsli_double& x2)
+inline bool operator!=(const gsli_double& x1, const gsli_double& x2)
 {
     return x1.get_internal_rep() != x2.get_internal_rep();
 };
 
-inline bool sli::operator!=(const gsli_double& x1, double x2)
+inline bool operator!=(const gsli_double& x1, double x2)
 {
     if (details::is_level_0(x2) == true)
         return x1.get_internal_rep() != x2;
@@ -374,7 +375,7 @@ inline bool sli::operator!=(const gsli_double& x1, double x2)
         return x1.get_internal_rep() != gsli_double(x2).get_internal_rep();
 };
 
-inline bool sli::operator!=(double x1, const gsli_double& x2)
+inline bool operator!=(double x1, const gsli_double& x2)
 {
     if (details::is_level_0(x1) == true)
         return x1 != x2.get_internal_rep();
@@ -382,9 +383,9 @@ inline bool sli::operator!=(double x1, const gsli_double& x2)
         return gsli_double(x1).get_internal_rep() != x2.get_internal_rep();
 };
 
-inline bool sli::operator>(const gsli_double& x1, const gsli_double& x2)
+inline bool operator>(const gsli_double& x1, const gsli_double& x2)
 {
-    bool res    = details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep());
+    bool res    = GSLI_COUNT_FAST(cmp, details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep()));
 
     if (res) 
         return x1.get_internal_rep() > x2.get_internal_rep();
@@ -392,25 +393,25 @@ inline bool sli::operator>(const gsli_double& x1, const gsli_double& x2)
         return details::cmp_gt_general(x1, x2);
 };
 
-inline bool sli::operator>(const gsli_double& x1, double x2)
+inline bool operator>(const gsli_double& x1, double x2)
 {
-    if (details::is_level_0(x2) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x2)) == true)
         return x1.get_internal_rep() > x2;
     else
         return details::cmp_gt_general(x1, x2);
 };
 
-inline bool sli::operator>(double x1, const gsli_double& x2)
+inline bool operator>(double x1, const gsli_double& x2)
 {
-    if (details::is_level_0(x1) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x1)) == true)
         return x1 > x2.get_internal_rep();
     else
         return details::cmp_gt_general(x1, x2);
 };
 
-inline bool sli::operator<(const gsli_double& x1, const gsli_double& x2)
+inline bool operator<(const gsli_double& x1, const gsli_double& x2)
 {
-    bool res    = details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep());
+    bool res    = GSLI_COUNT_FAST(cmp, details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep()));
 
     if (res) 
         return x1.get_internal_rep() < x2.get_internal_rep();
@@ -418,25 +419,25 @@ inline bool sli::operator<(const gsli_double& x1, const gsli_double& x2)
         return details::cmp_lt_general(x1, x2);
 };
 
-inline bool sli::operator<(const gsli_double& x1, double x2)
+inline bool operator<(const gsli_double& x1, double x2)
 {
-    if (details::is_level_0(x2) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x2)) == true)
         return x1.get_internal_rep() < x2;
     else
         return details::cmp_lt_general(x1, x2);
 };
 
-inline bool sli::operator<(double x1, const gsli_double& x2)
+inline bool operator<(double x1, const gsli_double& x2)
 {
-    if (details::is_level_0(x1) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x1)) == true)
         return x1 < x2.get_internal_rep();
     else
         return details::cmp_lt_general(x1, x2);
 };
 
-inline bool sli::operator>=(const gsli_double& x1, const gsli_double& x2)
+inline bool operator>=(const gsli_double& x1, const gsli_double& x2)
 {
-    bool res    = details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep());
+    bool res    = GSLI_COUNT_FAST(cmp, details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep()));
 
     if (res) 
         return x1.get_internal_rep() >= x2.get_internal_rep();
@@ -444,25 +445,25 @@ inline bool sli::operator>=(const gsli_double& x1, const gsli_double& x2)
         return details::cmp_geq_general(x1, x2);
 };
 
-inline bool sli::operator>=(const gsli_double& x1, double x2)
+inline bool operator>=(const gsli_double& x1, double x2)
 {
-    if (details::is_level_0(x2) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x2)) == true)
         return x1.get_internal_rep() >= x2;
     else
         return details::cmp_geq_general(x1, x2);
 };
 
-inline bool sli::operator>=(double x1, const gsli_double& x2)
+inline bool operator>=(double x1, const gsli_double& x2)
 {
-    if (details::is_level_0(x1) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x1)) == true)
         return x1 >= x2.get_internal_rep();
     else
         return details::cmp_geq_general(x1, x2);
 };
 
-inline bool sli::operator<=(const gsli_double& x1, const gsli_double& x2)
+inline bool operator<=(const gsli_double& x1, const gsli_double& x2)
 {
-    bool res    = details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep());
+    bool res    = GSLI_COUNT_FAST(cmp, details::can_cmp_level0(x1.get_internal_rep(), x2.get_internal_rep()));
 
     if (res) 
         return x1.get_internal_rep() <= x2.get_internal_rep();
@@ -470,123 +471,123 @@ inline bool sli::operator<=(const gsli_double& x1, const gsli_double& x2)
         return details::cmp_leq_general(x1, x2);
 };
 
-inline bool sli::operator<=(const gsli_double& x1, double x2)
+inline bool operator<=(const gsli_double& x1, double x2)
 {
-    if (details::is_level_0(x2) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x2)) == true)
         return x1.get_internal_rep() <= x2;
     else
         return details::cmp_leq_general(x1, x2);
 };
 
-inline bool sli::operator<=(double x1, const gsli_double& x2)
+inline bool operator<=(double x1, const gsli_double& x2)
 {
-    if (details::is_level_0(x1) == true)
+    if (GSLI_COUNT_FAST(cmp, details::is_level_0(x1)) == true)
         return x1 <= x2.get_internal_rep();
     else
         return details::cmp_leq_general(x1, x2);
 };
 
-inline gsli_double sli::operator+(const gsli_double& x1, const gsli_double& x2)
+inline gsli_double operator+(const gsli_double& x1, const gsli_double& x2)
 {
-    if (details::result_add_level_0(x1.get_internal_rep(), x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1.get_internal_rep(), x2.get_internal_rep())) == true)
         return gsli_double(x1.get_internal_rep() + x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::plus_general(x1, x2);
 };
 
-inline gsli_double sli::operator+(const gsli_double& x1, double x2)
+inline gsli_double operator+(const gsli_double& x1, double x2)
 {
-    if (details::result_add_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1.get_internal_rep(), x2)) == true)
         return gsli_double(x1.get_internal_rep() + x2, gsli_double::float_rep());
     else
         return details::plus_general(x1, x2);
 }
 
-inline gsli_double sli::operator+(double x1, const gsli_double& x2)
+inline gsli_double operator+(double x1, const gsli_double& x2)
 {
-    if (details::result_add_level_0(x1, x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1, x2.get_internal_rep())) == true)
         return gsli_double(x1 + x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::plus_general(x1, x2);
 };
 
 //
-inline gsli_double sli::operator-(const gsli_double& x1, double x2)
+inline gsli_double operator-(const gsli_double& x1, double x2)
 {
-    if (details::result_add_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1.get_internal_rep(), x2)) == true)
         return gsli_double(x1.get_internal_rep() - x2, gsli_double::float_rep());
     else
         return details::plus_general(x1, -x2);
 };
 
-inline gsli_double sli::operator-(double x1, const gsli_double& x2)
+inline gsli_double operator-(double x1, const gsli_double& x2)
 {
-    if (details::result_add_level_0(x1, x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1, x2.get_internal_rep())) == true)
         return gsli_double(x1 - x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::plus_general(x1, -x2);
 };
 
-inline gsli_double sli::operator-(const gsli_double& x1, const gsli_double& x2)
+inline gsli_double operator-(const gsli_double& x1, const gsli_double& x2)
 {
-    if (details::result_add_level_0(x1.get_internal_rep(), x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(plus, details::result_add_level_0(x1.get_internal_rep(), x2.get_internal_rep())) == true)
         return gsli_double(x1.get_internal_rep() - x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::plus_general(x1, -x2);
 };
 
-inline gsli_double sli::operator*(const gsli_double& x1, const gsli_double& x2)
+inline gsli_double operator*(const gsli_double& x1, const gsli_double& x2)
 {
-    if (details::result_mult_level_0(x1.get_internal_rep(), x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(mult, details::result_mult_level_0(x1.get_internal_rep(), x2.get_internal_rep())) == true)
         return gsli_double(x1.get_internal_rep() * x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::mult_general(x1, x2);
 };
 
-inline gsli_double sli::operator*(const gsli_double& x1, double x2)
+inline gsli_double operator*(const gsli_double& x1, double x2)
 {
-    if (details::result_mult_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(mult, details::result_mult_level_0(x1.get_internal_rep(), x2)) == true)
         return gsli_double(x1.get_internal_rep() * x2, gsli_double::float_rep());
     else
         return details::mult_general(x1, x2);
 };
 
-inline gsli_double sli::operator*(double x1, const gsli_double& x2)
+inline gsli_double operator*(double x1, const gsli_double& x2)
 {
-    if (details::result_mult_level_0(x1, x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(mult, details::result_mult_level_0(x1, x2.get_internal_rep())) == true)
         return gsli_double(x1 * x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::mult_general(x1, x2);
 };
 
-inline gsli_double sli::operator/(const gsli_double& x1, const gsli_double& x2)
+inline gsli_double operator/(const gsli_double& x1, const gsli_double& x2)
 {
-    if (details::result_div_level_0(x1.get_internal_rep(), x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(div, details::result_div_level_0(x1.get_internal_rep(), x2.get_internal_rep())) == true)
         return gsli_double(x1.get_internal_rep() / x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::div_general(x1, x2);
 };
 
-inline gsli_double sli::operator/(double x1, const gsli_double& x2)
+inline gsli_double operator/(double x1, const gsli_double& x2)
 {
-    if (details::result_div_level_0(x1, x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(div, details::result_div_level_0(x1, x2.get_internal_rep())) == true)
         return gsli_double(x1 / x2.get_internal_rep(), gsli_double::float_rep());
     else
         return details::div_general(x1, x2);
 };
 
-inline gsli_double sli::operator/(const gsli_double& x1, double x2)
+inline gsli_double operator/(const gsli_double& x1, double x2)
 {
-    if (details::result_div_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(div, details::result_div_level_0(x1.get_internal_rep(), x2)) == true)
         return gsli_double(x1.get_internal_rep() / x2, gsli_double::float_rep());
     else
         return details::div_general(x1, x2);
 };
 
 //
-inline gsli_double sli::pow_abs(const gsli_double& x1, const gsli_double& x2)
+inline gsli_double pow_abs(const gsli_double& x1, const gsli_double& x2)
 {
-    if (details::result_pow_abs_level_0(x1.get_internal_rep(), x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(pow_abs, details::result_pow_abs_level_0(x1.get_internal_rep(), x2.get_internal_rep())) == true)
     {
         return gsli_double(std::pow(std::abs(x1.get_internal_rep()), x2.get_internal_rep()), 
                            gsli_double::float_rep());
@@ -597,9 +598,9 @@ inline gsli_double sli::pow_abs(const gsli_double& x1, const gsli_double& x2)
     }
 };
 
-inline gsli_double sli::pow_abs(double x1, const gsli_double& x2)
+inline gsli_double pow_abs(double x1, const gsli_double& x2)
 {
-    if (details::result_pow_abs_level_0(x1, x2.get_internal_rep()) == true)
+    if (GSLI_COUNT_FAST(pow_abs, details::result_pow_abs_level_0(x1, x2.get_internal_rep())) == true)
     {
         return gsli_double(std::pow(std::abs(x1), x2.get_internal_rep()), 
                            gsli_double::float_rep());
@@ -610,9 +611,9 @@ inline gsli_double sli::pow_abs(double x1, const gsli_double& x2)
     }
 };
 
-inline gsli_double sli::pow_abs(const gsli_double& x1, double x2)
+inline gsli_double pow_abs(const gsli_double& x1, double x2)
 {
-    if (details::result_pow_abs_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(pow_abs, details::result_pow_abs_level_0(x1.get_internal_rep(), x2)) == true)
     {
         return gsli_double(std::pow(std::abs(x1.get_internal_rep()), x2), 
                            gsli_double::float_rep());
@@ -624,9 +625,9 @@ inline gsli_double sli::pow_abs(const gsli_double& x1, double x2)
 };
 
 //
-inline gsli_double sli::pow_int(const gsli_double& x1, long x2)
+inline gsli_double pow_int(const gsli_double& x1, long x2)
 {
-    if (details::result_pow_int_level_0(x1.get_internal_rep(), x2) == true)
+    if (GSLI_COUNT_FAST(pow_int, details::result_pow_int_level_0(x1.get_internal_rep(), x2)) == true)
     {
         return gsli_double(std::pow(x1.get_internal_rep(), x2), gsli_double::float_rep());
     }
@@ -691,12 +692,12 @@ inline gsli_double& gsli_double::operator/=(double s)
 //                        gsli_rep
 //----------------------------------------------------------------------
 
-inline gsli_rep sli::abs(const gsli_rep& v)
+inline gsli_rep abs(const gsli_rep& v)
 {
     return gsli_rep(v.level(), v.index(), false);
 };
 
-inline gsli_rep sli::uminus(const gsli_rep& v)
+inline gsli_rep uminus(const gsli_rep& v)
 {
     return gsli_rep(v.level(), v.index(), !v.sign_index());
 };
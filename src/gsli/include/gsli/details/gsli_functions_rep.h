@@ -42,6 +42,9 @@ gsli_rep    plus(const gsli_rep& v1, const gsli_rep& v2);
 gsli_rep    mult(const gsli_rep& v1, const gsli_rep& v2);
 gsli_rep    div(const gsli_rep& v1, const gsli_rep& v2);
 
+// sum of nonnegative numbers (or NaN)
+gsli_rep    plus_nonneg(const gsli_rep& v1, const gsli_rep& v2);
+
 // power function |x|^y
 gsli_rep    pow_abs(const gsli_rep& v1, const gsli_rep& v2);
 
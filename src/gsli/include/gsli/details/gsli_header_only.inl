@@ -0,0 +1,56 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+// sources of the library included in header-only mode; see GSLI_HEADER_ONLY
+// in config.h
+
+#ifndef GSLI_HEADER_ONLY
+    #error "this file can be included only when GSLI_HEADER_ONLY is defined"
+#endif
+
+#include "../../../gsli_error.cpp"
+#include "../../../gsli_constants.cpp"
+#include "../../../gsli_rep.cpp"
+#include "../../../gsli_double.cpp"
+#include "../../../gsli_flags.cpp"
+#include "../../../gsli_counters.cpp"
+#include "../../../gsli_trace.cpp"
+#include "../../../gsli_compare.cpp"
+#include "../../../gsli_plus_minus.cpp"
+#include "../../../gsli_mult_div.cpp"
+#include "../../../gsli_exp_log_pow.cpp"
+#include "../../../gsli_functions_basic.cpp"
+#include "../../../gsli_functions.cpp"
+#include "../../../gsli_error_functions.cpp"
+#include "../../../gsli_interval.cpp"
+#include "../../../gsli_prob.cpp"
+#include "../../../gsli_batch.cpp"
+#include "../../../gsli_batch_sse2.cpp"
+#include "../../../gsli_batch_avx2.cpp"
+#include "../../../gsli_batch_avx512.cpp"
+#include "../../../gsli_profile.cpp"
+#include "../../../gsli_chars.cpp"
+#include "../../../gsli_file_map.cpp"
+#include "../../../gsli_array_io.cpp"
+#include "../../../gsli_codec.cpp"
+#include "../../../gsli_mapped_vector.cpp"
+#include "../../../gsli_vector.cpp"
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+
+#pragma once
+
+#include "gsli/gsli_interval.h"
+#include "gsli/gsli_error.h"
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        gsli_interval
+//----------------------------------------------------------------------
+inline gsli_interval::gsli_interval()
+{};
+
+inline gsli_interval::gsli_interval(const gsli_double& x)
+    :m_lower(x), m_upper(x)
+{};
+
+inline gsli_interval::gsli_interval(double x)
+    :m_lower(x), m_upper(m_lower)
+{};
+
+inline gsli_interval::gsli_interval(const gsli_double& lower, const gsli_double& upper)
+    :m_lower(lower), m_upper(upper)
+{
+    gsli_assert(sli::is_nan(lower) == true || sli::is_nan(upper) == true
+                || lower <= upper, "invalid interval");
+};
+
+inline gsli_interval gsli_interval::make_entire()
+{
+    return gsli_interval(gsli_double::make_infinity(true), 
+                         gsli_double::make_infinity(false));
+};
+
+inline gsli_interval gsli_interval::make_nan()
+{
+    return gsli_interval(gsli_double::make_nan());
+};
+
+inline const gsli_double& gsli_interval::lower() const
+{
+    return m_lower;
+};
+
+inline const gsli_double& gsli_interval::upper() const
+{
+    return m_upper;
+};
+
+//----------------------------------------------------------------------
+//                        interval classification
+//----------------------------------------------------------------------
+inline bool is_nan(const gsli_interval& x)
+{
+    return is_nan(x.lower()) || is_nan(x.upper());
+};
+
+inline bool contains(const gsli_interval& x, const gsli_double& v)
+{
+    return x.lower() <= v && v <= x.upper();
+};
+
+inline gsli_interval operator-(const gsli_interval& x)
+{
+    return gsli_interval(-x.upper(), -x.lower());
+};
+
+};
\ No newline at end of file
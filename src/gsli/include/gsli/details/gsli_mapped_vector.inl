@@ -0,0 +1,246 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_mapped_vector.h"
+#include "gsli/gsli_error.h"
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        chunk iterator
+//----------------------------------------------------------------------
+template<class T>
+inline span<T> chunk_iterator<T>::operator*() const
+{
+    size_t len  = std::min(m_chunk, m_size - m_pos);
+    return span<T>(m_data + m_pos, len);
+};
+
+template<class T>
+inline chunk_iterator<T>& chunk_iterator<T>::operator++()
+{
+    m_pos       = std::min(m_size, m_pos + m_chunk);
+    return *this;
+};
+
+template<class T>
+inline bool chunk_iterator<T>::operator==(const chunk_iterator& other) const
+{
+    return m_data == other.m_data && m_pos == other.m_pos;
+};
+
+template<class T>
+inline bool chunk_iterator<T>::operator!=(const chunk_iterator& other) const
+{
+    return !(*this == other);
+};
+
+template<class T>
+inline chunk_iterator<T> chunk_range<T>::begin() const
+{
+    return chunk_iterator<T>(m_data, m_size, m_chunk, 0);
+};
+
+template<class T>
+inline chunk_iterator<T> chunk_range<T>::end() const
+{
+    return chunk_iterator<T>(m_data, m_size, m_chunk, m_size);
+};
+
+//----------------------------------------------------------------------
+//                        gsli_mapped_vector
+//----------------------------------------------------------------------
+inline bool gsli_mapped_vector::is_open() const
+{
+    return m_map != nullptr;
+};
+
+inline bool gsli_mapped_vector::is_writable() const
+{
+    return m_writable;
+};
+
+inline size_t gsli_mapped_vector::size() const
+{
+    return m_size;
+};
+
+inline const gsli_double* gsli_mapped_vector::data() const
+{
+    return m_data;
+};
+
+inline gsli_double* gsli_mapped_vector::data()
+{
+    gsli_assert(m_writable == true || m_map == nullptr, "mapping is not writable");
+    return m_data;
+};
+
+inline const gsli_double& gsli_mapped_vector::operator[](size_t i) const
+{
+    return m_data[i];
+};
+
+inline gsli_double& gsli_mapped_vector::operator[](size_t i)
+{
+    gsli_assert(m_writable == true, "mapping is not writable");
+    return m_data[i];
+};
+
+inline size_t gsli_mapped_vector::chunk_size() const
+{
+    return m_chunk;
+};
+
+inline size_t gsli_mapped_vector::num_chunks() const
+{
+    return (m_size + m_chunk - 1) / m_chunk;
+};
+
+inline span<const gsli_double> gsli_mapped_vector::chunk(size_t i) const
+{
+    size_t first    = std::min(m_size, i * m_chunk);
+    return span<const gsli_double>(m_data + first, std::min(m_chunk, m_size - first));
+};
+
+inline span<gsli_double> gsli_mapped_vector::chunk(size_t i)
+{
+    gsli_assert(m_writable == true, "mapping is not writable");
+
+    size_t first    = std::min(m_size, i * m_chunk);
+    return span<gsli_double>(m_data + first, std::min(m_chunk, m_size - first));
+};
+
+inline chunk_range<const gsli_double> gsli_mapped_vector::chunks() const
+{
+    return chunk_range<const gsli_double>(m_data, m_size, m_chunk);
+};
+
+inline chunk_range<gsli_double> gsli_mapped_vector::chunks()
+{
+    gsli_assert(m_writable == true, "mapping is not writable");
+    return chunk_range<gsli_double>(m_data, m_size, m_chunk);
+};
+
+//----------------------------------------------------------------------
+//                        chunk driver
+//----------------------------------------------------------------------
+namespace details
+{
+
+// request reading of chunks of an input vector before all chunks are
+// processed
+inline void stream_start(const gsli_mapped_vector& x, const stream_options& opts)
+{
+    x.advise(0, x.num_chunks(), map_advice::sequential);
+    x.advise(0, opts.m_read_ahead + 1, map_advice::will_need);
+};
+
+// request reading of next chunks of an input vector before chunk i is
+// processed
+inline void stream_before(const gsli_mapped_vector& x, size_t i, const stream_options& opts)
+{
+    if (opts.m_read_ahead > 0)
+        x.advise(i + opts.m_read_ahead, 1, map_advice::will_need);
+};
+
+// release pages of chunk i of an input vector after it is processed
+inline void stream_after(const gsli_mapped_vector& x, size_t i, const stream_options& opts)
+{
+    if (opts.m_release == true && x.is_writable() == false)
+        x.advise(i, 1, map_advice::dont_need);
+};
+
+}
+
+template<class Func>
+void for_each_chunk(const gsli_mapped_vector& x, Func f, const stream_options& opts)
+{
+    details::stream_start(x, opts);
+
+    details::run_chunks(x.num_chunks(), opts.m_threads, [&](size_t i)
+    {
+        details::stream_before(x, i, opts);
+        f(i, x.chunk(i));
+        details::stream_after(x, i, opts);
+    });
+};
+
+template<class Kernel>
+void transform_chunks(const gsli_mapped_vector& x, gsli_mapped_vector& res, Kernel kernel,
+                      const stream_options& opts)
+{
+    gsli_assert(x.size() == res.size() && x.chunk_size() == res.chunk_size(), 
+                "invalid vector size");
+
+    for_each_chunk(x, [&](size_t i, span<const gsli_double> chunk)
+    {
+        kernel(chunk.data(), res.chunk(i).data(), chunk.size());
+    }, opts);
+};
+
+template<class Kernel>
+void transform_chunks(const gsli_mapped_vector& x, const gsli_mapped_vector& y,
+                      gsli_mapped_vector& res, Kernel kernel, const stream_options& opts)
+{
+    gsli_assert(x.size() == res.size() && x.chunk_size() == res.chunk_size(), 
+                "invalid vector size");
+    gsli_assert(y.size() == res.size() && y.chunk_size() == res.chunk_size(), 
+                "invalid vector size");
+
+    details::stream_start(x, opts);
+    details::stream_start(y, opts);
+
+    details::run_chunks(x.num_chunks(), opts.m_threads, [&](size_t i)
+    {
+        details::stream_before(x, i, opts);
+        details::stream_before(y, i, opts);
+
+        span<const gsli_double> chunk   = x.chunk(i);
+        kernel(chunk.data(), y.chunk(i).data(), res.chunk(i).data(), chunk.size());
+
+        details::stream_after(x, i, opts);
+        details::stream_after(y, i, opts);
+    });
+};
+
+template<class Vector, class Kernel, class Combine>
+gsli_double reduce_chunks(const Vector& x, Kernel kernel, Combine combine,
+                          const gsli_double& init, const stream_options& opts)
+{
+    std::vector<gsli_double> partial(x.num_chunks());
+
+    for_each_chunk(x, [&](size_t i, span<const gsli_double> chunk)
+    {
+        partial[i]      = kernel(chunk.data(), chunk.size());
+    }, opts);
+
+    gsli_double res     = init;
+
+    for (const gsli_double& val : partial)
+        res             = combine(res, val);
+
+    return res;
+};
+
+};
\ No newline at end of file
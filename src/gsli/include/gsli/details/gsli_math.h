@@ -0,0 +1,96 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/details/gsli_constants.h"
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli { namespace details
+{
+
+//----------------------------------------------------------------------
+//                        elementary functions
+//----------------------------------------------------------------------
+// exponential and logarithm functions used to compute indices of level-k
+// numbers; these functions are implemented using only basic arithmetic
+// operations (range reduction and polynomial approximation), therefore
+// they can be inlined, loops calling these functions can be vectorized
+// by a compiler, and results do not depend on the standard library;
+// results are bitwise reproducible as long as a compiler does not
+// contract multiplications and additions into fma instructions
+//
+// error bound (checked by test_gsli) is 1 ulp for arguments giving
+// normal results; results in denormal range are rounded twice
+
+// exponential function exp(x); return +Inf if x > 709.78..., 0 if
+// x < -745.13..., NaN for NaN argument
+double          exp_kernel(double x);
+
+// natural logarithm function log(x); return -Inf if x = 0, NaN if x < 0
+// or x is NaN, +Inf if x = +Inf
+double          log_kernel(double x);
+
+// evaluate exp_kernel and log_kernel for n elements of array x; results
+// are stored in res, which must have at least n elements; results are
+// the same as results of scalar versions; main loops can be vectorized;
+// implementation compiled for SSE2, AVX2 or AVX-512 is selected at startup
+// (see gsli_batch.h)
+void            exp_kernel(const double* x, double* res, size_t n);
+void            log_kernel(const double* x, double* res, size_t n);
+
+//----------------------------------------------------------------------
+//                        relaxed accuracy versions
+//----------------------------------------------------------------------
+// versions of exp_kernel and log_kernel with shorter polynomials and
+// without divisions; range reduction uses small tables of 2^(j/64) and
+// log(c_i); special values are handled as in exp_kernel and log_kernel
+//
+// error bound (checked by test_gsli) of exp_kernel_fast is 2 ulp;
+// error bound of log_kernel_fast is 2 ulp of max(1, |log(x)|), i.e. the
+// absolute error is small, but the relative error can be large when
+// x is close to 1; this is sufficient for indices of level-k numbers,
+// which are always shifted by min_index_1 = 1
+double          exp_kernel_fast(double x);
+double          log_kernel_fast(double x);
+
+//----------------------------------------------------------------------
+//                        level-k kernels
+//----------------------------------------------------------------------
+// functions used to compute indices of level-k numbers; when fast_math
+// is enabled in config, then exp_kernel_fast and log_kernel_fast are
+// called, otherwise exp_kernel and log_kernel
+
+// exponential function exp(x)
+double          exp_index(double x);
+
+// natural logarithm log(x)
+double          log_index(double x);
+
+// return log(1 + w), where -1 <= w <= 1; when fast_math is enabled, then
+// for small |w| the logarithm is replaced by a short series
+double          log1p_index(double w);
+
+}};
+
+#include "gsli/details/gsli_math.inl"
\ No newline at end of file
@@ -0,0 +1,610 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/details/gsli_math.h"
+
+#include <cstring>
+#include <limits>
+
+namespace sli { namespace details
+{
+
+//----------------------------------------------------------------------
+//                        helper functions
+//----------------------------------------------------------------------
+namespace math_kernel
+{
+
+// return bit pattern of a double value
+inline uint64_t get_bits(double val)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+};
+
+// return double value with given bit pattern
+inline double make_double(uint64_t bits)
+{
+    double val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+};
+
+// return 2^k, where -1022 <= k <= 1023
+inline double pow2(int64_t k)
+{
+    return make_double(uint64_t(k + 1023) << 52);
+};
+
+//----------------------------------------------------------------------
+//                        exp and log kernels
+//----------------------------------------------------------------------
+// range reductions, coefficients and the ln(2) split used by exp_reduced
+// and log_core below are taken from fdlibm (e_exp.c and e_log.c, 
+// http://www.netlib.org/fdlibm/), which is distributed under the 
+// following notice:
+//
+// ====================================================
+// Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+//
+// Developed at SunSoft, a Sun Microsystems, Inc. business.
+// Permission to use, copy, modify, and distribute this
+// software is freely granted, provided that this notice 
+// is preserved.
+// ====================================================
+//
+// the code was rewritten without branches on the argument; special 
+// arguments are handled by separate functions
+
+// ln(2) split into high part with 32 trailing zero bits and low part;
+// k * ln2_hi is exact for |k| < 2^20
+static constexpr double ln2_hi      = 6.93147180369123816490e-01;
+static constexpr double ln2_lo      = 1.90821492927058770002e-10;
+static constexpr double inv_ln2     = 1.44269504088896338700e+00;
+
+// adding and subtracting this value rounds to integer (for |x| < 2^51)
+static constexpr double round_shift = 6755399441055744.0;
+
+// coefficients of minimax approximation of r*(exp(r)+1)/(exp(r)-1) on
+// [-ln(2)/2, ln(2)/2]
+static constexpr double exp_p1      = 1.66666666666666019037e-01;
+static constexpr double exp_p2      = -2.77777777770155933842e-03;
+static constexpr double exp_p3      = 6.61375632143793436117e-05;
+static constexpr double exp_p4      = -1.65339022054652515390e-06;
+static constexpr double exp_p5      = 4.13813679705723846039e-08;
+
+// arguments of exp, for which result overflows or underflows
+static constexpr double exp_max     = 7.09782712893383973096e+02;
+static constexpr double exp_min     = -7.45133219101941108420e+02;
+
+// for |x| < exp_fast exp can be scaled by single normal power of 2
+static constexpr double exp_fast    = 708.0;
+
+// coefficients of minimax approximation of (log(1+f) - 2s)/s, where
+// s = f/(2+f), as a polynomial in s^2 on [0, 0.1716]
+static constexpr double log_lg1     = 6.666666666666735130e-01;
+static constexpr double log_lg2     = 3.999999999940941908e-01;
+static constexpr double log_lg3     = 2.857142874366239149e-01;
+static constexpr double log_lg4     = 2.222219843214978396e-01;
+static constexpr double log_lg5     = 1.818357216161805012e-01;
+static constexpr double log_lg6     = 1.531383769920937332e-01;
+static constexpr double log_lg7     = 1.479819860511658591e-01;
+
+// exp(x) = 2^k * exp(r), |r| <= ln(2)/2; return exp(r), k and x/ln(2)
+// rounded to integer k, shifted by round_shift
+inline double exp_reduced(double x, double& k, double& shifted)
+{
+    shifted         = x * inv_ln2 + round_shift;
+    k               = shifted - round_shift;
+
+    double hi       = x - k * ln2_hi;
+    double lo       = k * ln2_lo;
+    double r        = hi - lo;
+
+    // exp(r) = 1 + r + r*c/(2-c), c = r - r^2 * P(r^2)
+    double z        = r * r;
+    double c        = r - z * (exp_p1 + z * (exp_p2 + z * (exp_p3
+                                    + z * (exp_p4 + z * exp_p5))));
+
+    return 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+};
+
+// exponential function for |x| < exp_fast; for other arguments result
+// is unspecified; this function does not contain branches and does not
+// convert between floating point and integer types
+inline double exp_core(double x)
+{
+    double k, shifted;
+    double y        = exp_reduced(x, k, shifted);
+
+    // lowest bits of shifted store k
+    double scale    = make_double((get_bits(shifted) + 1023) << 52);
+    return y * scale;
+};
+
+// exp for arguments |x| >= exp_fast or NaN
+inline double exp_large(double x)
+{
+    if (x > exp_max)
+        return std::numeric_limits<double>::infinity();
+
+    if (x < exp_min)
+        return 0.0;
+
+    if (x != x)
+        return x;
+
+    double k, shifted;
+    double y        = exp_reduced(x, k, shifted);
+
+    // scale in two steps; 2^k may not be a normal number
+    int64_t k1      = int64_t(k) / 2;
+    int64_t k2      = int64_t(k) - k1;
+
+    return (y * pow2(k1)) * pow2(k2);
+};
+
+// natural logarithm for positive normal x; for other arguments result
+// is unspecified; this function does not contain branches and does not
+// convert between floating point and integer types
+inline double log_core(double x)
+{
+    static const uint64_t frac_mask = (uint64_t(1) << 52) - 1;
+    static const uint64_t exp_mag   = uint64_t(0x4330000000000000);
+    static const double two_52      = 4503599627370496.0;
+
+    uint64_t bits   = get_bits(x);
+    uint64_t frac   = bits & frac_mask;
+
+    // normalize x to 2^k * (1+f), where sqrt(2)/2 <= 1+f < sqrt(2);
+    // i is nonzero iff fraction is not less than fraction of sqrt(2)
+    uint64_t i      = ((frac >> 32) + 0x95f64) & 0x100000;
+    double m        = make_double(frac | (uint64_t(i ^ 0x3ff00000) << 32));
+
+    // k + 1023 is a small integer, that can be converted to double by
+    // placing it in fraction bits of 2^52
+    uint64_t k_bias = (bits >> 52) + (i >> 20);
+    double dk       = (make_double(k_bias | exp_mag) - two_52) - 1023.0;
+
+    double f        = m - 1.0;
+
+    // log(1+f) = f - hfsq + s*(hfsq+R), s = f/(2+f)
+    double hfsq     = 0.5 * f * f;
+    double s        = f / (2.0 + f);
+    double z        = s * s;
+    double w        = z * z;
+    double t1       = w * (log_lg2 + w * (log_lg4 + w * log_lg6));
+    double t2       = z * (log_lg1 + w * (log_lg3 + w * (log_lg5 + w * log_lg7)));
+    double R        = t2 + t1;
+
+    return dk * ln2_hi - ((hfsq - (s * (hfsq + R) + dk * ln2_lo)) - f);
+};
+
+// log for arguments, that are not positive normal numbers
+inline double log_special(double x)
+{
+    static const double min_normal  = std::numeric_limits<double>::min();
+    static const double scale_54    = 18014398509481984.0;
+
+    if (x == 0.0)
+        return -std::numeric_limits<double>::infinity();
+
+    if (x != x || x < 0.0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    // denormal numbers; log(x) = log(x * 2^54) - 54 * log(2)
+    if (x < min_normal)
+        return log_core(x * scale_54) - (54.0 * ln2_hi + 54.0 * ln2_lo);
+
+    // x = +Inf
+    return x;
+};
+
+// return true if exp_core can be used
+inline bool is_exp_core_arg(double x)
+{
+    // NaN fails this test
+    return x < exp_fast && x > -exp_fast;
+};
+
+// return true if log_core can be used
+inline bool is_log_core_arg(double x)
+{
+    static const double min_normal  = std::numeric_limits<double>::min();
+    static const double max_normal  = std::numeric_limits<double>::max();
+
+    // NaN fails this test
+    return x >= min_normal && x <= max_normal;
+};
+
+//----------------------------------------------------------------------
+//                        relaxed accuracy kernels
+//----------------------------------------------------------------------
+// number of subintervals used in range reduction of exp_kernel_fast
+static const int exp_table_bits    = 6;
+static const int exp_table_size    = 1 << exp_table_bits;
+
+// 64/ln(2), and ln(2)/64 split into high and low parts
+static constexpr double inv_ln2_64  = 9.23324826168936567683e+01;
+static constexpr double ln2_64_hi   = ln2_hi / 64.0;
+static constexpr double ln2_64_lo   = ln2_lo / 64.0;
+
+// coefficients of Taylor polynomial of exp(r) - 1 on [-ln(2)/128, ln(2)/128]
+static constexpr double exp_f2      = 1.0 / 2.0;
+static constexpr double exp_f3      = 1.0 / 6.0;
+static constexpr double exp_f4      = 1.0 / 24.0;
+static constexpr double exp_f5      = 1.0 / 120.0;
+
+// number of subintervals used in range reduction of log_kernel_fast
+static const int log_table_bits    = 7;
+
+// coefficients of Taylor polynomial of log(1+r) on [-1/256, 1/256]
+static constexpr double log_f2      = -1.0 / 2.0;
+static constexpr double log_f3      = 1.0 / 3.0;
+static constexpr double log_f4      = -1.0 / 4.0;
+static constexpr double log_f5      = 1.0 / 5.0;
+static constexpr double log_f6      = -1.0 / 6.0;
+
+// 2^(j/64), j = 0, ..., 63, correctly rounded
+inline const double* exp_table()
+{
+    static constexpr double table[exp_table_size] =
+    {
+        1.00000000000000000000e+00, 1.01088928605170047526e+00,
+        1.02189714865411662714e+00, 1.03302487902122841490e+00,
+        1.04427378242741375480e+00, 1.05564517836055715705e+00,
+        1.06714040067682369717e+00, 1.07876079775711986031e+00,
+        1.09050773266525768967e+00, 1.10238258330784089090e+00,
+        1.11438674259589243221e+00, 1.12652161860824184814e+00,
+        1.13878863475669156458e+00, 1.15118922995298267331e+00,
+        1.16372485877757747552e+00, 1.17639699165028122074e+00,
+        1.18920711500272102690e+00, 1.20215673145270307565e+00,
+        1.21524735998046895524e+00, 1.22848053610687002468e+00,
+        1.24185781207348400201e+00, 1.25538075702469109629e+00,
+        1.26905095719173321989e+00, 1.28287001607877826359e+00,
+        1.29683955465100964055e+00, 1.31096121152476441374e+00,
+        1.32523664315974132322e+00, 1.33966752405330291609e+00,
+        1.35425554693689265129e+00, 1.36900242297459051599e+00,
+        1.38390988196383202258e+00, 1.39897967253831123635e+00,
+        1.41421356237309514547e+00, 1.42961333839197002327e+00,
+        1.44518080697704665027e+00, 1.46091779418064704466e+00,
+        1.47682614593949934623e+00, 1.49290772829126483501e+00,
+        1.50916442759342284141e+00, 1.52559815074453841710e+00,
+        1.54221082540794074411e+00, 1.55900440023783692922e+00,
+        1.57598084510788649659e+00, 1.59314215134226699888e+00,
+        1.61049033194925428347e+00, 1.62802742185734783398e+00,
+        1.64575547815396494578e+00, 1.66367658032673637614e+00,
+        1.68179283050742900407e+00, 1.70010635371852347753e+00,
+        1.71861929812247793414e+00, 1.73733383527370621735e+00,
+        1.75625216037329945351e+00, 1.77537649252652118825e+00,
+        1.79470907500310716820e+00, 1.81425217550039885595e+00,
+        1.83400808640934243066e+00, 1.85397912508338547077e+00,
+        1.87416763411029996256e+00, 1.89457598158696560731e+00,
+        1.91520656139714740007e+00, 1.93606179349229434727e+00,
+        1.95714412417540017941e+00, 1.97845602638795092787e+00
+    };
+
+    return table;
+};
+
+// {1/c_i, log(c_i)}, i = 0, ..., 127, correctly rounded, where c_i is
+// the midpoint of i-th subinterval of [0.70703125, 1.4140625); in binary
+// representation each subinterval has 2^45 elements
+inline const double (*log_table())[2]
+{
+    static constexpr double table[1 << log_table_bits][2] =
+    {
+        {1.41046831955922868929e+00, -3.43921790774657010203e-01},
+        {1.40273972602739727122e+00, -3.38427271457016287659e-01},
+        {1.39509536784741139392e+00, -3.32962776984937536273e-01},
+        {1.38753387533875338633e+00, -3.27527980998980616789e-01},
+        {1.38005390835579522246e+00, -3.22122562432072656602e-01},
+        {1.37265415549597857847e+00, -3.16746205395692259632e-01},
+        {1.36533333333333328774e+00, -3.11398599069096948533e-01},
+        {1.35809018567639250286e+00, -3.06079437591497027782e-01},
+        {1.35092348284960417359e+00, -3.00788419957081443190e-01},
+        {1.34383202099737530943e+00, -2.95525249912806819985e-01},
+        {1.33681462140992168841e+00, -2.90289635858861805318e-01},
+        {1.32987012987012986898e+00, -2.85081290751723559485e-01},
+        {1.32299741602067189028e+00, -2.79899932009725960214e-01},
+        {1.31619537275064257820e+00, -2.74745281421061471328e-01},
+        {1.30946291560102312523e+00, -2.69617065054142013292e-01},
+        {1.30279898218829526257e+00, -2.64515013170246560126e-01},
+        {1.29620253164556964443e+00, -2.59438860138385907206e-01},
+        {1.28967254408060449933e+00, -2.54388344352317385955e-01},
+        {1.28320802005012524205e+00, -2.49363208149644327571e-01},
+        {1.27680798004987527960e+00, -2.44363197732938602913e-01},
+        {1.27047146401985111552e+00, -2.39388063092824815437e-01},
+        {1.26419753086419750510e+00, -2.34437557932968637653e-01},
+        {1.25798525798525795416e+00, -2.29511439596912808492e-01},
+        {1.25183374083129583809e+00, -2.24609468996706029831e-01},
+        {1.24574209245742095753e+00, -2.19731410543273164571e-01},
+        {1.23970944309927366689e+00, -2.14877032078475027621e-01},
+        {1.23373493975903625319e+00, -2.10046104808809475095e-01},
+        {1.22781774580335723002e+00, -2.05238403240706329678e-01},
+        {1.22195704057279241894e+00, -2.00453705117370040156e-01},
+        {1.21615201900237535071e+00, -1.95691791357126360085e-01},
+        {1.21040189125295505335e+00, -1.90952445993229802390e-01},
+        {1.20470588235294107093e+00, -1.86235456115090958207e-01},
+        {1.19906323185011709498e+00, -1.81540611810883240063e-01},
+        {1.19347319347319347216e+00, -1.76867706111490802234e-01},
+        {1.18793503480278417328e+00, -1.72216534935760001712e-01},
+        {1.18244803695150113576e+00, -1.67586897037017928946e-01},
+        {1.17701149425287354688e+00, -1.62978593950823702485e-01},
+        {1.17162471395881007119e+00, -1.58391429943917638745e-01},
+        {1.16628701594533024100e+00, -1.53825211964336433512e-01},
+        {1.16099773242630388559e+00, -1.49279749592661797886e-01},
+        {1.15575620767494346985e+00, -1.44754854994372156307e-01},
+        {1.15056179775280909006e+00, -1.40250342873267569432e-01},
+        {1.14541387024608498635e+00, -1.35766030425938960535e-01},
+        {1.14031180400890863602e+00, -1.31301737297253501291e-01},
+        {1.13525498891352549791e+00, -1.26857285536829428318e-01},
+        {1.13024282560706401668e+00, -1.22432499556473770030e-01},
+        {1.12527472527472527375e+00, -1.18027206088557365393e-01},
+        {1.12035010940919033118e+00, -1.13641234145303082759e-01},
+        {1.11546840958605675276e+00, -1.09274414978962633449e-01},
+        {1.11062906724511933909e+00, -1.04926582042859262156e-01},
+        {1.10583153347732188188e+00, -1.00597570953273707239e-01},
+        {1.10107526881720430012e+00, -9.62872194521514762622e-02},
+        {1.09635974304068528618e+00, -9.19953673706104674279e-02},
+        {1.09168443496801703674e+00, -8.77218565932284255471e-02},
+        {1.08704883227176218874e+00, -8.34665310230900403532e-02},
+        {1.08245243128964063750e+00, -7.92292365475748133763e-02},
+        {1.07789473684210523885e+00, -7.50098210048665697824e-02},
+        {1.07337526205450739525e+00, -7.08081341511665740551e-02},
+        {1.06889352818371596854e+00, -6.66240276285925553390e-02},
+        {1.06444906444906450815e+00, -6.24573549337466074616e-02},
+        {1.06004140786749490033e+00, -5.83079713869350951816e-02},
+        {1.05567010309278352942e+00, -5.41757341020245863916e-02},
+        {1.05133470225872693860e+00, -5.00605019569179965355e-02},
+        {1.04703476482617596766e+00, -4.59621355646357560021e-02},
+        {1.04276985743380845584e+00, -4.18804972449872067730e-02},
+        {1.03853955375253548254e+00, -3.78154509968176774648e-02},
+        {1.03434343434343434254e+00, -3.37668624708174838767e-02},
+        {1.03018108651911477480e+00, -2.97345989428790570541e-02},
+        {1.02605210420841674868e+00, -2.57185292879891190532e-02},
+        {1.02195608782435121142e+00, -2.17185239546429861845e-02},
+        {1.01789264413518876218e+00, -1.77344549397685791181e-02},
+        {1.01386138613861387370e+00, -1.37661957641479586190e-02},
+        {1.00986193293885606614e+00, -9.81362144832462202082e-03},
+        {1.00589390962671898500e+00, -5.87660848898504187265e-03},
+        {1.00195694716242655886e+00, -1.95503483580335059994e-03},
+        {9.96108949416342426275e-01, 3.89864041565732288852e-03},
+        {9.88416988416988440136e-01, 1.16506172199752743718e-02},
+        {9.80842911877394585396e-01, 1.93429628431309348635e-02},
+        {9.73384030418250945083e-01, 2.69765876982020758046e-02},
+        {9.66037735849056611315e-01, 3.45523815066597350665e-02},
+        {9.58801498127340834365e-01, 4.20712139206870575081e-02},
+        {9.51672862453531553939e-01, 4.95339351222766274829e-02},
+        {9.44649446494464917201e-01, 5.69413764001384242741e-02},
+        {9.37728937728937728124e-01, 6.42943507053972546084e-02},
+        {9.30909090909090908283e-01, 7.15936531870088183060e-02},
+        {9.24187725631768985934e-01, 7.88400617077760212936e-02},
+        {9.17562724014336916767e-01, 8.60343373418031576172e-02},
+        {9.11032028469750843058e-01, 9.31772248541832964763e-02},
+        {9.04593639575971719680e-01, 1.00269453163675151264e-01},
+        {8.98245614035087736049e-01, 1.07311735789088050219e-01},
+        {8.91986062717770034070e-01, 1.14304771280058628524e-01},
+        {8.85813148788927362531e-01, 1.21249243632869679876e-01},
+        {8.79725085910652904175e-01, 1.28145822691930033610e-01},
+        {8.73720136518771339773e-01, 1.34995164537504819258e-01},
+        {8.67796610169491500208e-01, 1.41797911860257336292e-01},
+        {8.61952861952861915107e-01, 1.48554694323137143064e-01},
+        {8.56187290969899650328e-01, 1.55266128911123957312e-01},
+        {8.50498338870431913605e-01, 1.61932820269313243466e-01},
+        {8.44884488448844894748e-01, 1.68555361029806671791e-01},
+        {8.39344262295081966485e-01, 1.75134332127849151606e-01},
+        {8.33876221498371372753e-01, 1.81670303107634684148e-01},
+        {8.28478964401294537545e-01, 1.88163832418182991324e-01},
+        {8.23151125401929251169e-01, 1.94615467699671668145e-01},
+        {8.17891373801916898856e-01, 2.01025746060590732034e-01},
+        {8.12698412698412697708e-01, 2.07395194346070593783e-01},
+        {8.07570977917981047689e-01, 2.13724329397718126877e-01},
+        {8.02507836990595579962e-01, 2.20013658305282105987e-01},
+        {7.97507788161993746989e-01, 2.26263678650453381458e-01},
+        {7.92569659442724505638e-01, 2.32474878743094054423e-01},
+        {7.87692307692307691624e-01, 2.38647737850175012397e-01},
+        {7.82874617737003064555e-01, 2.44782726417690915666e-01},
+        {7.78115501519756835869e-01, 2.50880306285809429045e-01},
+        {7.73413897280966766701e-01, 2.56940930897500419139e-01},
+        {7.68768768768768762101e-01, 2.62965045500881344775e-01},
+        {7.64179104477611947921e-01, 2.68953087345503938366e-01},
+        {7.59643916913946615210e-01, 2.74905485872799226765e-01},
+        {7.55162241887905594240e-01, 2.80822662900887809467e-01},
+        {7.50733137829912022809e-01, 2.86705032803954318332e-01},
+        {7.46355685131195323301e-01, 2.92553002686377461306e-01},
+        {7.42028985507246385822e-01, 2.98366972551797282609e-01},
+        {7.37752161383285254281e-01, 3.04147335467296719980e-01},
+        {7.33524355300859576268e-01, 3.09894477722864714053e-01},
+        {7.29344729344729381104e-01, 3.15608778986303351033e-01},
+        {7.25212464589235161760e-01, 3.21290612453734303333e-01},
+        {7.21126760563380320157e-01, 3.26940344995853338084e-01},
+        {7.17086834733893563332e-01, 3.32558337300076611864e-01},
+        {7.13091922005571032805e-01, 3.38144944008716419326e-01},
+        {7.09141274238227148352e-01, 3.43700513853318456725e-01}
+    };
+
+    return table;
+};
+
+// exponential function for |x| < exp_fast; for other arguments result
+// is unspecified; exp(x) = 2^e * 2^(j/64) * exp(r), |r| <= ln(2)/128
+inline double exp_core_fast(double x)
+{
+    double shifted  = x * inv_ln2_64 + round_shift;
+    double k        = shifted - round_shift;
+    double r        = (x - k * ln2_64_hi) - k * ln2_64_lo;
+
+    // lowest bits of shifted store k = 64 * e + j
+    uint64_t bits   = get_bits(shifted);
+    uint64_t j      = bits & (exp_table_size - 1);
+    uint64_t e      = (bits - j) << (52 - exp_table_bits);
+
+    double scale    = make_double(get_bits(exp_table()[j]) + e);
+
+    double z        = r * r;
+    double p        = r + z * (exp_f2 + r * (exp_f3 + r * (exp_f4 + r * exp_f5)));
+
+    return scale + scale * p;
+};
+
+// natural logarithm for positive normal x; for other arguments result
+// is unspecified; log(x) = k * log(2) + log(c_i) + log(1 + r), where
+// r = (z - c_i) / c_i, |r| <= 1/256, and z - c_i is exact
+inline double log_core_fast(double x)
+{
+    static const uint64_t offset    = uint64_t(0x3fe6a00000000000);
+    static const uint64_t exp_mask  = uint64_t(0xfff) << 52;
+    static const uint64_t exp_mag   = uint64_t(0x4330000000000000);
+    static const uint64_t bias      = uint64_t(1023) << 52;
+    static const int shift          = 52 - log_table_bits;
+    static const double two_52      = 4503599627370496.0;
+
+    // x = 2^k * z, where offset <= z < 2 * offset
+    uint64_t bits   = get_bits(x);
+    uint64_t tmp    = bits - offset;
+    uint64_t i      = (tmp >> shift) & ((1 << log_table_bits) - 1);
+    uint64_t z_bits = bits - (tmp & exp_mask);
+
+    // k + 1023 is nonnegative; see log_core
+    uint64_t k_bias = (tmp + bias) >> 52;
+    double dk       = (make_double(k_bias | exp_mag) - two_52) - 1023.0;
+
+    // c_i has the same exponent as z and 45 trailing zero bits
+    double z        = make_double(z_bits);
+    double c        = make_double(((z_bits >> shift) << shift) + (uint64_t(1) << (shift - 1)));
+
+    const double* t = log_table()[i];
+    double r        = (z - c) * t[0];
+
+    double r2       = r * r;
+    double p        = r2 * (log_f2 + r * (log_f3 + r * (log_f4 + r * (log_f5 + r * log_f6))));
+
+    double hi       = dk * ln2_hi + t[1];
+    double lo       = dk * ln2_lo + r;
+
+    return hi + (lo + p);
+};
+
+// log_special for log_kernel_fast
+inline double log_special_fast(double x)
+{
+    static const double min_normal  = std::numeric_limits<double>::min();
+    static const double scale_54    = 18014398509481984.0;
+
+    if (x > 0.0 && x < min_normal)
+        return log_core_fast(x * scale_54) - (54.0 * ln2_hi + 54.0 * ln2_lo);
+
+    return log_special(x);
+};
+
+};
+
+//----------------------------------------------------------------------
+//                        elementary functions
+//----------------------------------------------------------------------
+inline double exp_kernel(double x)
+{
+    if (math_kernel::is_exp_core_arg(x) == true)
+        return math_kernel::exp_core(x);
+    else
+        return math_kernel::exp_large(x);
+};
+
+inline double log_kernel(double x)
+{
+    if (math_kernel::is_log_core_arg(x) == true)
+        return math_kernel::log_core(x);
+    else
+        return math_kernel::log_special(x);
+};
+
+inline double exp_kernel_fast(double x)
+{
+    if (math_kernel::is_exp_core_arg(x) == true)
+        return math_kernel::exp_core_fast(x);
+    else
+        return math_kernel::exp_large(x);
+};
+
+inline double log_kernel_fast(double x)
+{
+    if (math_kernel::is_log_core_arg(x) == true)
+        return math_kernel::log_core_fast(x);
+    else
+        return math_kernel::log_special_fast(x);
+};
+
+//----------------------------------------------------------------------
+//                        level-k kernels
+//----------------------------------------------------------------------
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4127) //conditional expression is constant
+#endif
+
+inline double exp_index(double x)
+{
+    using config_type   = config<double, GSLI_MAX_LEVEL_DOUBLE>;
+
+    if (config_type::fast_math == true)
+        return exp_kernel_fast(x);
+    else
+        return exp_kernel(x);
+};
+
+inline double log_index(double x)
+{
+    using config_type   = config<double, GSLI_MAX_LEVEL_DOUBLE>;
+
+    if (config_type::fast_math == true)
+        return log_kernel_fast(x);
+    else
+        return log_kernel(x);
+};
+
+inline double log1p_index(double w)
+{
+    using config_type   = config<double, GSLI_MAX_LEVEL_DOUBLE>;
+
+    // for |w| < 2^-18 error of w - w^2/2 is bounded by |w|^3/3 < 2^-55
+    static constexpr double small_w = 1.0 / 262144.0;
+
+    if (config_type::fast_math == true)
+    {
+        if (w < small_w && w > -small_w)
+            return w - 0.5 * w * w;
+
+        return log_kernel_fast(1.0 + w);
+    }
+    else
+    {
+        return log_kernel(1.0 + w);
+    };
+};
+
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+}};
\ No newline at end of file
@@ -0,0 +1,319 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_prob.h"
+#include "gsli/gsli_error.h"
+
+namespace sli { namespace details
+{
+
+//----------------------------------------------------------------------
+//                        utils
+//----------------------------------------------------------------------
+
+// if nonnegative x, y passes this test, then x + y must be level 0 number
+inline bool result_add_prob_level_0(const double& x, const double& y)
+{
+    using config    = gsli_double::config_type;
+
+    static constexpr double min = config::min_index_0;
+    static constexpr double max = config::max_index_0/2.0;
+
+    // x + y >= max(x, y) and cancellation is not possible, therefore it
+    // is enough to require, that x and y are level 0 numbers and
+    // x + y <= 2.0 * max(x, y) <= max_index_0
+
+    bool res1       = min <= x;
+    bool res2       = min <= y;
+    bool res3       = x <= max;
+    bool res4       = y <= max;
+
+    return res1 && res2 && res3 && res4;
+}
+
+// if nonnegative x, y passes this test, then x * y and x / y must be
+// level 0 numbers
+inline bool result_mult_prob_level_0(const double& x, const double& y)
+{
+    using config    = gsli_double::config_type;
+
+    static constexpr double max = config::max_index_0_sqrt;
+    static constexpr double min = 1.0 / max;
+
+    bool res1       = min <= x;
+    bool res2       = min <= y;
+    bool res3       = x <= max;
+    bool res4       = y <= max;
+
+    return res1 && res2 && res3 && res4;
+}
+
+// if nonnegative x, y passes this test; then comparison can be done based
+// on internal representation
+inline bool can_cmp_prob_level0(const double& x, const double& y)
+{
+    using config    = gsli_double::config_type;
+
+    return config::min_index_0 <= x && config::min_index_0 <= y;
+}
+
+gsli_prob   plus_prob_general(const gsli_prob& x1, const gsli_prob& x2);
+gsli_prob   mult_prob_general(const gsli_prob& x1, const gsli_prob& x2);
+gsli_prob   div_prob_general(const gsli_prob& x1, const gsli_prob& x2);
+
+// return ordinal number of a nonnegative number x, that is not NaN;
+// ordinal numbers of consecutive representations differ by one
+int64_t     prob_ordinal(const gsli_prob& x);
+
+}};
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        gsli_prob
+//----------------------------------------------------------------------
+inline gsli_prob::gsli_prob()
+    : m_data(0.0)
+{};
+
+inline gsli_prob::gsli_prob(double a)
+    : m_data(a == 0.0 ? 0.0 : gsli_double(a).get_internal_rep())
+{
+    gsli_assert(!(a < 0.0), "negative gsli_prob");
+};
+
+inline gsli_prob::gsli_prob(const gsli_double& x)
+    : m_data(is_zero(x) == true ? 0.0 : x.get_internal_rep())
+{
+    gsli_assert(is_negative(x) == false, "negative gsli_prob");
+};
+
+inline gsli_prob::gsli_prob(double a, internal_rep)
+    : m_data(a)
+{};
+
+inline gsli_prob gsli_prob::make_zero()
+{
+    return gsli_prob(0.0, internal_rep());
+};
+
+inline gsli_prob gsli_prob::make_one()
+{
+    return gsli_prob(1.0, internal_rep());
+};
+
+inline gsli_prob gsli_prob::make_nan()
+{
+    return gsli_prob(gsli_double::make_nan().get_internal_rep(), internal_rep());
+};
+
+inline gsli_prob gsli_prob::make_infinity()
+{
+    return gsli_prob(gsli_double::make_infinity(false).get_internal_rep(),
+                     internal_rep());
+};
+
+inline double gsli_prob::get_value() const
+{
+    return get_gsli_double().get_value();
+};
+
+inline gsli_double gsli_prob::get_gsli_double() const
+{
+    return gsli_double(m_data, gsli_double::internal_rep());
+};
+
+inline const double& gsli_prob::get_internal_rep() const
+{
+    return m_data;
+};
+
+inline gsli_prob& gsli_prob::operator+=(const gsli_prob& s)
+{
+    *this = *this + s;
+    return *this;
+};
+
+inline gsli_prob& gsli_prob::operator*=(const gsli_prob& s)
+{
+    *this = *this * s;
+    return *this;
+};
+
+inline gsli_prob& gsli_prob::operator/=(const gsli_prob& s)
+{
+    *this = *this / s;
+    return *this;
+};
+
+//----------------------------------------------------------------------
+//                        value classification
+//----------------------------------------------------------------------
+inline bool is_finite(const gsli_prob& v)
+{
+    return v.get_internal_rep() < std::numeric_limits<double>::infinity();
+};
+
+inline bool is_zero(const gsli_prob& v)
+{
+    return v.get_internal_rep() == 0.0;
+};
+
+inline bool is_nan(const gsli_prob& v)
+{
+    return details::is_nan(v.get_internal_rep());
+};
+
+inline bool is_inf(const gsli_prob& v)
+{
+    return v.get_internal_rep() == std::numeric_limits<double>::infinity();
+};
+
+//----------------------------------------------------------------------
+//                     unary functions
+//----------------------------------------------------------------------
+inline gsli_prob inv(const gsli_prob& v)
+{
+    if (details::is_level_0(v.get_internal_rep()) == true)
+        return gsli_prob(1.0/v.get_internal_rep(), gsli_prob::internal_rep());
+    else
+        return gsli_prob(inv(v.get_gsli_double()));
+};
+
+inline gsli_double log(const gsli_prob& v)
+{
+    return log_abs(v.get_gsli_double());
+};
+
+inline gsli_prob exp_prob(const gsli_double& x)
+{
+    return gsli_prob(exp(x).get_internal_rep(), gsli_prob::internal_rep());
+};
+
+//----------------------------------------------------------------------
+//                     arithmetic functions
+//----------------------------------------------------------------------
+inline gsli_prob operator+(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::result_add_prob_level_0(v1, v2) == true)
+        return gsli_prob(v1 + v2, gsli_prob::internal_rep());
+    else
+        return details::plus_prob_general(x1, x2);
+};
+
+inline gsli_prob operator*(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::result_mult_prob_level_0(v1, v2) == true)
+        return gsli_prob(v1 * v2, gsli_prob::internal_rep());
+    else
+        return details::mult_prob_general(x1, x2);
+};
+
+inline gsli_prob operator/(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::result_mult_prob_level_0(v1, v2) == true)
+        return gsli_prob(v1 / v2, gsli_prob::internal_rep());
+    else
+        return details::div_prob_general(x1, x2);
+};
+
+//----------------------------------------------------------------------
+//                     comparison functions
+//----------------------------------------------------------------------
+inline bool operator==(const gsli_prob& x1, const gsli_prob& x2)
+{
+    // encoding is a bijection
+    return x1.get_internal_rep() == x2.get_internal_rep();
+};
+
+inline bool operator!=(const gsli_prob& x1, const gsli_prob& x2)
+{
+    return x1.get_internal_rep() != x2.get_internal_rep();
+};
+
+inline bool operator>(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::can_cmp_prob_level0(v1, v2) == true)
+        return v1 > v2;
+
+    if (is_nan(x1) == true || is_nan(x2) == true)
+        return false;
+
+    return details::prob_ordinal(x1) > details::prob_ordinal(x2);
+};
+
+inline bool operator<(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::can_cmp_prob_level0(v1, v2) == true)
+        return v1 < v2;
+
+    if (is_nan(x1) == true || is_nan(x2) == true)
+        return false;
+
+    return details::prob_ordinal(x1) < details::prob_ordinal(x2);
+};
+
+inline bool operator>=(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::can_cmp_prob_level0(v1, v2) == true)
+        return v1 >= v2;
+
+    if (is_nan(x1) == true || is_nan(x2) == true)
+        return false;
+
+    return details::prob_ordinal(x1) >= details::prob_ordinal(x2);
+};
+
+inline bool operator<=(const gsli_prob& x1, const gsli_prob& x2)
+{
+    const double& v1    = x1.get_internal_rep();
+    const double& v2    = x2.get_internal_rep();
+
+    if (details::can_cmp_prob_level0(v1, v2) == true)
+        return v1 <= v2;
+
+    if (is_nan(x1) == true || is_nan(x2) == true)
+        return false;
+
+    return details::prob_ordinal(x1) <= details::prob_ordinal(x2);
+};
+
+};
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #include "gsli/config.h"
 #include "gsli/details/gsli_constants.h"
+#include "gsli/details/gsli_math.h"
 
 #include <stdint.h>
 
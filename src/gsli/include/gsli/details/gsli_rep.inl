@@ -77,19 +77,19 @@ inline size_t double_decoder_const::get_sign() const
     return m_rep->sign; 
 };
 
-inline bool details::is_nan(double val)
+inline bool is_nan(double val)
 {
     // do not use std::isnan; this function is very slow;
     // following implementation works for IEEE-754 machines
     return val != val;
 };
 
-inline bool details::is_inf_plus(double val)
+inline bool is_inf_plus(double val)
 {
     return val == std::numeric_limits<double>::infinity();
 };
 
-inline void details::get_sign_abs(const double& a, double& abs_a, bool& sign)
+inline void get_sign_abs(const double& a, double& abs_a, bool& sign)
 {
     // std::signbit is very slow; 
     // simple comparison a < 0.0 is slightly faster, but will not
@@ -100,7 +100,7 @@ inline void details::get_sign_abs(const double& a, double& abs_a, bool& sign)
     abs_a   = std::abs(a);
 }
 
-inline double details::signed_value(bool sign_index, double val)
+inline double signed_value(bool sign_index, double val)
 {
     // avoid branch predictions
     return g_global_constants.m_double_sign_arr[sign_index] * val;
@@ -219,7 +219,7 @@ inline void gsli_rep::calc_level_index(double& index, int& level, int inc)
 {
 	while (index > config_type::max_index_1)
 	{
-		index       = ::log(index * config_type::max_index_1_inv);
+		index       = details::log_index(index * config_type::max_index_1_inv);
         index       += config_type::min_index_1;
         level       += inc;
 	}
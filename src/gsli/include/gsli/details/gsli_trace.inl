@@ -0,0 +1,89 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_trace.h"
+
+#include <cstring>
+
+namespace sli
+{
+
+inline uint64_t details::trace_bits(const gsli_double& x)
+{
+    return trace_bits(x.get_internal_rep());
+};
+
+inline uint64_t details::trace_bits(double x)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+};
+
+inline uint64_t details::trace_bits(long x)
+{
+    return uint64_t(int64_t(x));
+};
+
+inline uint64_t details::trace_bits(bool x)
+{
+    return x == true ? 1 : 0;
+};
+
+inline trace_args details::trace_kind(const gsli_double&, const gsli_double&)
+{
+    return trace_args::gsli_gsli;
+};
+
+inline trace_args details::trace_kind(const gsli_double&, double)
+{
+    return trace_args::gsli_real;
+};
+
+inline trace_args details::trace_kind(double, const gsli_double&)
+{
+    return trace_args::real_gsli;
+};
+
+inline trace_args details::trace_kind(const gsli_double&, long)
+{
+    return trace_args::gsli_long;
+};
+
+template<class T1, class T2, class Result>
+inline Result details::trace_result(trace_op op, const T1& x1, const T2& x2, 
+                                    const Result& res)
+{
+    trace_call(op, trace_kind(x1, x2), trace_bits(x1), trace_bits(x2), 
+               trace_bits(res));
+    return res;
+};
+
+template<class Result>
+inline Result details::trace_result(trace_op op, const gsli_double& x, 
+                                    const Result& res)
+{
+    trace_call(op, trace_args::unary, trace_bits(x), 0, trace_bits(res));
+    return res;
+};
+
+};
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/gsli_vector.h"
+#include "gsli/gsli_error.h"
+
+#include <new>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        allocator
+//----------------------------------------------------------------------
+template<class T>
+inline T* details::cache_aligned_allocator<T>::allocate(size_t n)
+{
+    if (n > size_t(-1) / sizeof(T))
+        throw std::bad_alloc();
+
+    void* ptr   = aligned_malloc(n * sizeof(T), alignment);
+
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    return static_cast<T*>(ptr);
+};
+
+template<class T>
+inline void details::cache_aligned_allocator<T>::deallocate(T* ptr, size_t)
+{
+    aligned_free(ptr);
+};
+
+//----------------------------------------------------------------------
+//                        gsli_vector
+//----------------------------------------------------------------------
+inline size_t gsli_vector::size() const
+{
+    return m_data.size();
+};
+
+inline bool gsli_vector::empty() const
+{
+    return m_data.empty();
+};
+
+inline const gsli_double* gsli_vector::data() const
+{
+    return m_data.data();
+};
+
+inline const gsli_double& gsli_vector::operator[](size_t i) const
+{
+    return m_data[i];
+};
+
+inline gsli_vector::const_iterator gsli_vector::begin() const
+{
+    return m_data.data();
+};
+
+inline gsli_vector::const_iterator gsli_vector::end() const
+{
+    return m_data.data() + m_data.size();
+};
+
+inline size_t gsli_vector::chunk_size()
+{
+    return fixed_chunk_size;
+};
+
+inline size_t gsli_vector::num_chunks() const
+{
+    return m_counts.size();
+};
+
+inline size_t gsli_vector::chunk_length(size_t k) const
+{
+    // fixed_chunk_size is not defined out of class; it cannot be bound
+    // to a reference
+    const size_t chunk  = fixed_chunk_size;
+    return std::min(chunk, m_data.size() - k * chunk);
+};
+
+inline span<const gsli_double> gsli_vector::chunk(size_t k) const
+{
+    const size_t chunk  = fixed_chunk_size;
+    size_t first        = std::min(m_data.size(), k * chunk);
+
+    return span<const gsli_double>(m_data.data() + first, 
+                                   std::min(chunk, m_data.size() - first));
+};
+
+inline chunk_range<const gsli_double> gsli_vector::chunks() const
+{
+    return chunk_range<const gsli_double>(m_data.data(), m_data.size(), fixed_chunk_size);
+};
+
+template<class Func>
+void gsli_vector::update(size_t first, size_t len, Func f)
+{
+    gsli_assert(first <= m_data.size() && len <= m_data.size() - first, 
+                "invalid range");
+
+    if (len == 0)
+        return;
+
+    f(m_data.data() + first, len);
+
+    recount(first / fixed_chunk_size, 
+            (first + len + fixed_chunk_size - 1) / fixed_chunk_size);
+};
+
+//----------------------------------------------------------------------
+//                        batch functions
+//----------------------------------------------------------------------
+template<class Func>
+void for_each_chunk(const gsli_vector& x, Func f, const stream_options& opts)
+{
+    // elements are stored in memory, read ahead hints are not used
+    details::run_chunks(x.num_chunks(), opts.m_threads, [&](size_t i)
+    {
+        f(i, x.chunk(i));
+    });
+};
+
+};
\ No newline at end of file
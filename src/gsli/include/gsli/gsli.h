@@ -22,6 +22,24 @@
 
 // include all required headers from gsli library
 
+// marks that this header is included; see GSLI_HEADER_ONLY
+#define GSLI_MAIN_HEADER
+
 #include "gsli/config.h"
 #include "gsli/gsli_double.h"
 #include "gsli/gsli_functions.h"
+#include "gsli/gsli_interval.h"
+#include "gsli/gsli_prob.h"
+#include "gsli/gsli_counters.h"
+#include "gsli/gsli_flags.h"
+#include "gsli/gsli_profile.h"
+#include "gsli/gsli_trace.h"
+#include "gsli/gsli_chars.h"
+#include "gsli/gsli_array_io.h"
+#include "gsli/gsli_codec.h"
+#include "gsli/gsli_mapped_vector.h"
+#include "gsli/gsli_vector.h"
+
+#ifdef GSLI_HEADER_ONLY
+    #include "gsli/details/gsli_header_only.inl"
+#endif
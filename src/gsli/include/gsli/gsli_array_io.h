@@ -0,0 +1,208 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <cstddef>
+#include <type_traits>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        binary array format
+//----------------------------------------------------------------------
+// arrays of gsli_double are stored as a header of array_header_size
+// bytes followed by internal representations of elements (raw doubles);
+// header fields are stored in little endian order:
+//
+//     offset  size    field
+//     0       8       magic "GSLIARR1"
+//     8       4       format version (1)
+//     12      4       header size (64)
+//     16      4       config::max_level
+//     20      4       config::max_index_exp_0
+//     24      4       config::max_index_exp_1
+//     28      4       config::precision
+//     32      4       byte order of elements: 0 little endian, 1 big endian
+//     36      4       config::min_index_exp_1
+//     40      8       number of elements
+//     48      8       offset of elements from the beginning of the file
+//     56      4       encoding of elements, see array_encoding
+//     60      4       reserved (0)
+//
+// elements are stored in the byte order of the writer; arrays can be
+// read only if config parameters and byte order are the same as in the
+// reader; this library writes elements at offset 64, therefore mapped
+// elements are aligned to 64 bytes; readers accept any offset not smaller
+// than 64, that is a multiple of alignof(double); compressed arrays (see
+// gsli_codec.h) use the same header with different encoding
+
+// size of the header in bytes
+static const size_t array_header_size   = 64;
+
+// encoding of elements following the header
+enum class array_encoding : uint32_t
+{
+    raw         = 0,        // internal representations of elements
+    block_codec = 1,        // blocks compressed by compressed_array
+};
+
+// header of a binary array file
+struct array_header
+{
+    uint32_t    m_version;
+    int         m_max_level;
+    int         m_max_index_exp_0;
+    int         m_max_index_exp_1;
+    int         m_min_index_exp_1;
+    int         m_precision;
+    bool        m_big_endian;
+    uint64_t    m_size;
+    uint64_t    m_data_offset;
+    array_encoding  m_encoding;
+
+    // header of an array with n elements created by this library
+    static array_header make(uint64_t n, array_encoding enc = array_encoding::raw);
+};
+
+// result of reading or mapping an array
+enum class array_status : int
+{
+    ok          = 0,
+    io_error,               // file cannot be opened or read
+    bad_magic,              // not a gsli array file
+    bad_version,            // unsupported version, header size or data offset
+    bad_config,             // config parameters differ from config of gsli_double
+    bad_byte_order,         // elements stored in different byte order
+    bad_encoding,           // elements stored in unsupported encoding
+    truncated,              // file is shorter than declared number of elements
+};
+
+// return name of a status
+const char*         array_status_name(array_status st);
+
+// encode header to array_header_size bytes
+void                write_array_header(const array_header& h, unsigned char* buf);
+
+// decode header and check, that elements can be used by this library
+array_status        read_array_header(const unsigned char* buf, array_header& h);
+
+// decode header of an array with raw encoding stored in a buffer of size
+// bytes and check, that the buffer contains all elements
+array_status        check_array_buffer(const unsigned char* buf, size_t size, 
+                        array_header& h);
+
+// write n elements of array x to binary stream os
+void                write_array(std::ostream& os, const gsli_double* x, size_t n);
+
+// read array from binary stream is; on failure x is not modified
+array_status        read_array(std::istream& is, std::vector<gsli_double>& x);
+
+// write and read array files
+array_status        write_array_file(const std::string& file, const gsli_double* x, 
+                        size_t n);
+array_status        read_array_file(const std::string& file, std::vector<gsli_double>& x);
+
+//----------------------------------------------------------------------
+//                        span
+//----------------------------------------------------------------------
+// view of a contiguous array of elements of type T (as std::span)
+template<class T>
+class span
+{
+    public:
+        using element_type  = T;
+        using value_type    = typename std::remove_cv<T>::type;
+        using iterator      = T*;
+
+    public:
+        span()                          : m_data(nullptr), m_size(0) {};
+        span(T* data, size_t size)      : m_data(data), m_size(size) {};
+
+        T*          data() const        { return m_data; };
+        size_t      size() const        { return m_size; };
+        bool        empty() const       { return m_size == 0; };
+        iterator    begin() const       { return m_data; };
+        iterator    end() const         { return m_data + m_size; };
+        T&          operator[](size_t i) const  { return m_data[i]; };
+
+        // return elements [offset, offset + count); count is reduced if
+        // the span is shorter
+        span        subspan(size_t offset, size_t count) const;
+
+    private:
+        T*          m_data;
+        size_t      m_size;
+};
+
+//----------------------------------------------------------------------
+//                        mapped_array
+//----------------------------------------------------------------------
+// read-only view of a binary array file mapped to memory; elements are
+// not copied, pages are loaded on first access
+class mapped_array
+{
+    public:
+        mapped_array();
+        ~mapped_array();
+
+        mapped_array(mapped_array&& other);
+        mapped_array&   operator=(mapped_array&& other);
+
+        mapped_array(const mapped_array&) = delete;
+        mapped_array&   operator=(const mapped_array&) = delete;
+
+        // map a file and validate its header; previously mapped file is
+        // closed; on failure the view is empty
+        array_status    open(const std::string& file);
+
+        // unmap file
+        void            close();
+
+        // return true if a file is mapped
+        bool            is_open() const;
+
+        // mapped elements
+        const gsli_double*          data() const;
+        size_t                      size() const;
+        span<const gsli_double>     elements() const;
+
+        // header of mapped file
+        const array_header&         header() const;
+
+    private:
+        void*           m_map;
+        size_t          m_map_size;
+        array_header    m_header;
+        const gsli_double*  m_data;
+        size_t          m_size;
+};
+
+};
+
+#include "gsli/details/gsli_array_io.inl"
\ No newline at end of file
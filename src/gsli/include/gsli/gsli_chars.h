@@ -0,0 +1,133 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+
+#include <system_error>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        text conversions
+//----------------------------------------------------------------------
+// conversions between gsli_double and text, which do not use streams,
+// do not depend on locale and never allocate memory; text has the same
+// form as text written by operator<<: level 0 numbers are written as
+// doubles, level k numbers as {k, index}, infinities as Inf or -Inf and
+// NaN as NaN
+
+// format of doubles; meaning is the same as meaning of std::chars_format
+enum class chars_format : int
+{
+    general     = 0,    // fixed or scientific, whichever is shorter
+    scientific,         // d.ddde+dd
+    fixed,              // ddd.ddd
+    hex,                // h.hhhp+d, without 0x prefix
+};
+
+// maximum length of text written by to_chars without precision argument
+static const int chars_max_length   = 32;
+
+// result of to_chars; ptr points one past the last written character
+// and ec is std::errc() on success; if the buffer is too small, then
+// ptr is equal to last, ec is std::errc::value_too_large and content of
+// the buffer is unspecified; written text is not null terminated
+struct to_chars_result
+{
+    char*       ptr;
+    std::errc   ec;
+};
+
+// write x to the buffer [first, last) in the shortest form, that is
+// read back exactly by operator>>; at most chars_max_length characters
+// are written
+to_chars_result     to_chars(char* first, char* last, const gsli_double& x);
+
+// write x in the shortest form using given format of doubles; text in
+// hex format cannot be read by operator>>
+to_chars_result     to_chars(char* first, char* last, const gsli_double& x,
+                        chars_format fmt);
+
+// write x using given format and precision of doubles; precision has
+// the same meaning as for std::to_chars
+to_chars_result     to_chars(char* first, char* last, const gsli_double& x,
+                        chars_format fmt, int precision);
+
+// result of from_chars; ptr points to the first character not matching
+// the pattern; on failure ptr is equal to first and ec is
+// std::errc::invalid_argument or ptr points past the pattern and ec is
+// std::errc::result_out_of_range; x is not modified on failure
+struct from_chars_result
+{
+    const char* ptr;
+    std::errc   ec;
+};
+
+// parse text in [first, last); leading whitespaces are not skipped;
+// accepted forms are:
+//     - decimal doubles, e.g. -1.5e+300, with optional exponent;
+//     - nested exponents, e.g. 2.5e1e30 = 2.5 * 10^(1 * 10^30), where
+//       exponents may have a sign and a fractional part, and may be
+//       nested at most 8 times;
+//     - Inf, -Inf, Infinity, NaN (case insensitive);
+//     - level k numbers {k, index} as written by to_chars; levels outside
+//       [-max_level, max_level] are invalid;
+// decimal numbers in the range of doubles are correctly rounded; other
+// numbers are computed with error of few ulp of the index; the result
+// is out of range if a nonzero number is rounded to zero or infinity
+from_chars_result   from_chars(const char* first, const char* last, gsli_double& x);
+
+// parse text using given format of doubles; nested exponents are
+// accepted only in general format
+from_chars_result   from_chars(const char* first, const char* last, gsli_double& x,
+                        chars_format fmt);
+
+//----------------------------------------------------------------------
+//                        decimal towers
+//----------------------------------------------------------------------
+// level 0 numbers and special values are written as by to_chars with
+// given precision in general format; other numbers are written as
+// decimal towers in the nested exponent notation accepted by from_chars,
+// i.e. m e E, where m has at most digits significant digits and E is an
+// integer, or 1 e T, where T is a tower, e.g.
+//     2.5e400         = 2.5 * 10^400
+//     1e-3.16228e30   = 10^(-3.16228 * 10^30)
+//     1e1e1e1.25e17   = 10^10^10^(1.25 * 10^17)
+// m has less significant digits than requested if the exponent E has
+// more than 15 - digits digits; towers are computed directly from
+// the level and the index without evaluating logarithms of gsli_double
+
+// maximum length of text written by to_chars_tower
+static const int chars_tower_max_length = 64;
+
+// write x as a decimal tower with digits in [1, 17] significant digits
+to_chars_result     to_chars_tower(char* first, char* last, const gsli_double& x,
+                        int digits);
+
+// write n elements of the array x as decimal towers separated by the
+// character sep; no separator is written after the last element
+to_chars_result     to_chars_tower(char* first, char* last, const gsli_double* x,
+                        size_t n, int digits, char sep);
+
+};
\ No newline at end of file
@@ -0,0 +1,122 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_array_io.h"
+
+#include <algorithm>
+#include <iosfwd>
+#include <vector>
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        block codec
+//----------------------------------------------------------------------
+// lossless compression of arrays of gsli_double; elements are split into
+// blocks of codec_block_size elements, which are compressed independently;
+// level 0 elements and zeros of a block are stored in two bit streams: 
+// exponents relative to the smallest exponent in the block and mantissas
+// with sign, without trailing bits, that are zero in all elements; other
+// elements (levels other than 0, infinities, NaN) are outliers stored 
+// separately as raw internal representations; a block is stored as:
+//
+//     offset  size    field
+//     0       2       smallest biased exponent of nonzero level 0 elements
+//     2       1       width of exponent fields in bits (0-11)
+//     3       1       width of mantissa fields in bits without sign (0-52)
+//     4       2       number of outliers
+//     6       1       minimum level of elements
+//     7       1       maximum level of elements
+//     8               level bitmap: bit i is set if element i is stored in
+//                     bit streams (present only if there are outliers)
+//                     exponent fields; 0 encodes zero
+//                     mantissa fields
+//                     outliers
+//
+// bit streams are padded to full bytes; compressed arrays are stored in
+// files as header (see array_header) with block_codec encoding, followed
+// by size of compressed blocks and offsets of all blocks; size of data is
+// significantly reduced if exponents of most elements are close and 
+// mantissas have fewer significant bits (e.g. values converted from float)
+
+// number of elements in a block
+static const size_t codec_block_size    = 256;
+
+// array of gsli_double compressed by the block codec
+class compressed_array
+{
+    public:
+        // construct empty array
+        compressed_array();
+
+        // compress n elements of array x; previous content is removed
+        void            assign(const gsli_double* x, size_t n);
+
+        // number of elements
+        size_t          size() const;
+
+        // number of blocks
+        size_t          num_blocks() const;
+
+        // size of compressed data in bytes including offsets of blocks
+        size_t          compressed_size() const;
+
+        // decode block i to res, which must have at least codec_block_size
+        // elements; return number of decoded elements
+        size_t          decode_block(size_t i, gsli_double* res) const;
+
+        // decode all elements to res, which must have at least size()
+        // elements
+        void            decode(gsli_double* res) const;
+
+        // decode element i; requires decoding of one block
+        gsli_double     get(size_t i) const;
+
+        // minimum and maximum level of elements in block i; zeros have
+        // level 0, infinities and NaN have level +-(max_level + 1)
+        int             block_min_level(size_t i) const;
+        int             block_max_level(size_t i) const;
+
+        // write compressed array to binary stream os
+        void            write(std::ostream& os) const;
+
+        // read compressed array from binary stream is; on failure this
+        // array is not modified
+        array_status    read(std::istream& is);
+
+    private:
+        size_t          block_length(size_t i) const;
+
+    private:
+        size_t                      m_size;
+        std::vector<uint64_t>       m_offsets;
+        std::vector<unsigned char>  m_data;
+};
+
+};
+
+#include "gsli/details/gsli_codec.inl"
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/details/gsli_constants.h"
+
+#include <iosfwd>
+#include <stdint.h>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        path counters
+//----------------------------------------------------------------------
+// when GSLI_COUNTERS is defined in config.h, then every thread counts,
+// how many times operations on gsli_double took the fast path (level 0
+// arithmetic in gsli_functions.inl) and how many times the general
+// version was called; calls of general versions are further classified
+// according to classes of operands, which determine the evaluation
+// function used (e.g. eval_plus::eval_sli_float for level 0 and level k
+// operands); when GSLI_COUNTERS is not defined, then counters are not
+// updated and all counts are zero
+
+// counted operations; subtraction is counted as addition, all comparisons
+// (except of == and !=) are counted as cmp
+enum class counter_op : int
+{
+    plus    = 0,
+    mult,
+    div,
+    pow_abs,
+    pow_int,
+    inv,
+    exp,
+    log,
+    cmp,
+    count
+};
+
+// paths taken by operations
+enum class counter_path : int
+{
+    fast    = 0,    // level 0 arithmetic in gsli_functions.inl
+    level_0,        // general version; all operands are level 0 numbers
+    level_0_k,      // general version; level 0 and level k operands
+    level_k,        // general version; all operands are level k numbers
+    special,        // general version; zero, infinite or NaN operand
+    count
+};
+
+// snapshot of counters
+struct path_counters
+{
+    static const int n_op   = int(counter_op::count);
+    static const int n_path = int(counter_path::count);
+
+    uint64_t    m_count[n_op][n_path];
+
+    // return number of calls of operation op, that took given path
+    uint64_t    get(counter_op op, counter_path path) const;
+
+    // return number of calls of general version of operation op
+    uint64_t    get_general(counter_op op) const;
+
+    // add counts from other snapshot (e.g. taken in other thread)
+    path_counters&  operator+=(const path_counters& other);
+};
+
+// return true if counters are enabled
+bool                path_counters_enabled();
+
+// return snapshot of counters of the calling thread
+path_counters       get_path_counters();
+
+// set counters of the calling thread to zero
+void                reset_path_counters();
+
+// return name of an operation or a path
+const char*         counter_op_name(counter_op op);
+const char*         counter_path_name(counter_path path);
+
+// print table of counters; for every operation with nonzero counts one
+// line is printed with counts of all paths and percentage of fast path
+// hits
+std::ostream&       operator<<(std::ostream& os, const path_counters& counters);
+
+namespace details
+{
+
+// counters of the calling thread
+extern thread_local path_counters g_path_counters;
+
+// return class of operands, i.e. one of level_0, level_0_k, level_k or 
+// special paths
+counter_path        operand_class(fptype ft);
+counter_path        operand_class(fptype ft1, fptype ft2);
+
+// increase counter of fast path of operation op, if is_fast is true;
+// return is_fast
+bool                count_fast(counter_op op, bool is_fast);
+
+// increase counter of general version of operation op called with
+// operands of given classes
+void                count_general(counter_op op, fptype ft);
+void                count_general(counter_op op, fptype ft1, fptype ft2);
+
+};
+
+};
+
+// macros used to update counters; expand to nothing (or to the tested
+// condition) when counters are disabled
+#ifdef GSLI_COUNTERS
+    #define GSLI_COUNT_FAST(op, cond)                                       \
+        sli::details::count_fast(sli::counter_op::op, (cond))
+    #define GSLI_COUNT_GENERAL(op, rep_1, rep_2)                            \
+        sli::details::count_general(sli::counter_op::op,                    \
+                                    (rep_1).fpclassify(), (rep_2).fpclassify())
+    #define GSLI_COUNT_GENERAL_1(op, rep)                                   \
+        sli::details::count_general(sli::counter_op::op, (rep).fpclassify())
+#else
+    #define GSLI_COUNT_FAST(op, cond)               (cond)
+    #define GSLI_COUNT_GENERAL(op, rep_1, rep_2)
+    #define GSLI_COUNT_GENERAL_1(op, rep)
+#endif
+
+#include "gsli/details/gsli_counters.inl"
\ No newline at end of file
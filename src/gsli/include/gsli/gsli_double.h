@@ -60,6 +60,9 @@ class gsli_double
         // internal encoding tag
         struct internal_rep{};
 
+        // mantissa and binary exponent tag
+        struct mant_exp{};
+
     private:
         // data storing magnitude of index, level and sign flags; 
         // also exact double representation if level is zero
@@ -85,6 +88,12 @@ class gsli_double
         // construct from representation object
         explicit gsli_double(const gsli_rep& rep);
 
+        // construct value mant * 2^exp, where mant is any double; level 
+        // and index are computed from exponent and leading bits of mant,
+        // no intermediate value can overflow; zeros, infinities and NaN
+        // are returned unchanged; the result is exact if it has level 0
+        gsli_double(double mant, int64_t exp, mant_exp);
+
         // construct zero number
         static gsli_double  make_zero();
 
@@ -149,6 +158,11 @@ class gsli_double
         // representation
         void                build_gsli(double abs_a, bool is_neg);
 
+        // build sli representation of a number x, such that log(|x|/MAX_0) 
+        // = log_off if sign_level = 1, or -log(|x|*MAX_0) = log_off if 
+        // sign_level = -1; requires log_off >= 0
+        void                build_gsli_log(double log_off, int sign_level, bool is_neg);
+
         // encode gsli representation into double type; 
         // require MIN_1 < index <= MAX_1; 1 <= |level| <= MAX_LEVEL; 
         // or this is a representation of non finite numbers
@@ -0,0 +1,67 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        range flags
+//----------------------------------------------------------------------
+// sticky flags, analogous to IEEE exception flags, set by operations on
+// gsli_double, whose results are not level 0 numbers; flags are stored
+// separately for every thread and are cleared only by clear_flags;
+// flags are set only by general versions of operations, fast paths on
+// level 0 numbers never set flags
+enum range_flag : unsigned
+{
+    // result is a level k number, i.e. computation left level 0
+    flag_level_k    = 1,
+
+    // result is a level k number with maximum level
+    flag_max_level  = 2,
+
+    // operands are finite and nonzero, result is saturated to +-Inf
+    flag_overflow   = 4,
+
+    // operands are finite and nonzero, exact result is nonzero, but 
+    // result is saturated to +-0
+    flag_underflow  = 8,
+
+    // operands are not NaN, result is NaN
+    flag_nan        = 16,
+
+    // all flags
+    flag_all        = 31
+};
+
+// return flags of the calling thread selected by mask
+unsigned            test_flags(unsigned mask = flag_all);
+
+// clear flags of the calling thread selected by mask
+void                clear_flags(unsigned mask = flag_all);
+
+// set flags of the calling thread selected by mask
+void                raise_flags(unsigned mask);
+
+};
\ No newline at end of file
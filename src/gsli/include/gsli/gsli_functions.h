@@ -82,6 +82,16 @@ gsli_double         exp(const gsli_double& s);
 // logarithm of absolute value functions, log|x|
 gsli_double         log_abs(const gsli_double& s);
 
+// return x * 2^exp; no intermediate value can overflow; results of level
+// 0 arguments are exact, if the result has level 0
+gsli_double         ldexp(const gsli_double& x, int64_t exp);
+
+// decompose x into mantissa m and binary exponent exp, such that x = m *
+// 2^exp and 0.5 <= |m| < 1, and return m; if x is zero, infinite or NaN,
+// then x is returned and exp is 0; if exponent of x is not representable
+// by int64_t, then exp is INT64_MAX or INT64_MIN and |m| = 0.5
+double              frexp(const gsli_double& x, int64_t& exp);
+
 //----------------------------------------------------------------------
 //                     arithmetic functions
 //----------------------------------------------------------------------
@@ -190,6 +200,60 @@ gsli_double         nextbelow(const gsli_double& x);
 // the result is always a signed integer value stored in double type
 double              float_distance(const gsli_double& x, const gsli_double& y);
 
+// return the number, which is n representations above x (if n > 0) or
+// -n representations below x (if n < 0); equivalent to calling nextabove
+// or nextbelow |n| times, but cost does not depend on n
+gsli_double         float_advance(const gsli_double& x, int64_t n);
+
+// batch versions of nextabove, nextbelow and float_distance; evaluate
+// functions for n elements of arrays x (and y); results are stored in
+// res, which must have at least n elements
+void                nextabove(const gsli_double* x, gsli_double* res, size_t n);
+void                nextbelow(const gsli_double* x, gsli_double* res, size_t n);
+void                float_distance(const gsli_double* x, const gsli_double* y, 
+                        double* res, size_t n);
+
+//----------------------------------------------------------------------
+//                     batch functions
+//----------------------------------------------------------------------
+// evaluate functions for n elements of arrays x (and y); results are
+// stored in res, which must have at least n elements; implementation
+// compiled for the best instruction set supported by the CPU is selected
+// at startup (see details/gsli_batch.h); results do not depend on the
+// selected implementation
+
+// conversion from double to gsli_double and from gsli_double to double
+void                convert(const double* x, gsli_double* res, size_t n);
+void                get_value(const gsli_double* x, double* res, size_t n);
+
+// elementwise arithmetic operations
+void                plus(const gsli_double* x, const gsli_double* y, 
+                        gsli_double* res, size_t n);
+void                minus(const gsli_double* x, const gsli_double* y, 
+                        gsli_double* res, size_t n);
+void                mult(const gsli_double* x, const gsli_double* y, 
+                        gsli_double* res, size_t n);
+void                div(const gsli_double* x, const gsli_double* y, 
+                        gsli_double* res, size_t n);
+
+// elementwise comparisons x[i] < y[i], x[i] > y[i], x[i] <= y[i], 
+// x[i] >= y[i] and x[i] == y[i]
+void                less(const gsli_double* x, const gsli_double* y, 
+                        bool* res, size_t n);
+void                greater(const gsli_double* x, const gsli_double* y, 
+                        bool* res, size_t n);
+void                leq(const gsli_double* x, const gsli_double* y, 
+                        bool* res, size_t n);
+void                geq(const gsli_double* x, const gsli_double* y, 
+                        bool* res, size_t n);
+void                eq(const gsli_double* x, const gsli_double* y, 
+                        bool* res, size_t n);
+
+// return sum and product of n elements of array x; elements are added
+// (multiplied) sequentially
+gsli_double         sum(const gsli_double* x, size_t n);
+gsli_double         prod(const gsli_double* x, size_t n);
+
 //----------------------------------------------------------------------
 //                     input-output
 //----------------------------------------------------------------------
@@ -0,0 +1,166 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+
+#pragma once 
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_functions.h"
+
+#include <iosfwd>
+
+namespace sli
+{
+
+// closed interval [lower, upper] of gsli_double numbers; results of 
+// operations are rounded outward; bounds are moved outward by cheap 
+// nextbelow/nextabove steps on the encoding; an interval with NaN bound
+// is invalid, invalid intervals are propagated
+//
+// results of arithmetic operations on level 0 numbers are guaranteed
+// enclosures of exact results; outward rounding of other results (level
+// k numbers and functions exp, log, pow) is heuristic: error bounds of 
+// these kernels are not proven, margins are based on errors observed in
+// tests; then the result is very likely, but not guaranteed, to contain
+// the exact result
+class gsli_interval
+{
+    public:
+        // number of representations, by which correctly rounded results
+        // (i.e. results of arithmetic operations on level 0) are moved
+        // outward
+        static const int    ulp_exact       = 1;
+
+        // number of representations, by which results of functions on
+        // level 0 (exp, log, pow), are moved outward; results are
+        // computed by std library, whose error is usually below 1 ulp,
+        // but this is not guaranteed
+        static const int    ulp_func_0      = 2;
+
+        // number of representations, by which other results are moved
+        // outward; this is not a proven error bound, but a heuristic 
+        // margin, much larger than errors of level k operations observed
+        // by test_gsli
+        static const int    ulp_general     = 5000;
+
+    private:
+        gsli_double         m_lower;
+        gsli_double         m_upper;
+
+    public:
+        // initialize to [0, 0]
+        gsli_interval();
+
+        // construct interval [x, x]
+        gsli_interval(const gsli_double& x);
+
+        // construct interval [x, x]
+        explicit gsli_interval(double x);
+
+        // construct interval [lower, upper]; require lower <= upper
+        gsli_interval(const gsli_double& lower, const gsli_double& upper);
+
+        // construct [-Inf, Inf]
+        static gsli_interval    make_entire();
+
+        // construct invalid interval [NaN, NaN]
+        static gsli_interval    make_nan();
+
+    public:
+        // return lower bound
+        const gsli_double&  lower() const;
+
+        // return upper bound
+        const gsli_double&  upper() const;
+};
+
+//----------------------------------------------------------------------
+//                        interval classification
+//----------------------------------------------------------------------
+// return true if x is invalid (i.e. has NaN bound)
+bool                is_nan(const gsli_interval& x);
+
+// return true if lower <= v <= upper
+bool                contains(const gsli_interval& x, const gsli_double& v);
+
+// return number of distinct representations between bounds of x
+double              ulp_width(const gsli_interval& x);
+
+//----------------------------------------------------------------------
+//                     unary functions
+//----------------------------------------------------------------------
+// unary minus; exact
+gsli_interval       operator-(const gsli_interval& x);
+
+// absolute value; exact
+gsli_interval       abs(const gsli_interval& x);
+
+// inverse function; return [-Inf, Inf] if x contains zero
+gsli_interval       inv(const gsli_interval& x);
+
+// exponential function, exp(x)
+gsli_interval       exp(const gsli_interval& x);
+
+// logarithm of absolute value function, log|x|
+gsli_interval       log_abs(const gsli_interval& x);
+
+//----------------------------------------------------------------------
+//                     arithmetic functions
+//----------------------------------------------------------------------
+// in multiplication 0 * Inf is 0; division by interval containing zero
+// returns [-Inf, Inf]
+gsli_interval       operator+(const gsli_interval& x, const gsli_interval& y);
+gsli_interval       operator-(const gsli_interval& x, const gsli_interval& y);
+gsli_interval       operator*(const gsli_interval& x, const gsli_interval& y);
+gsli_interval       operator/(const gsli_interval& x, const gsli_interval& y);
+
+// power function |x|^y; special cases as in pow_abs for gsli_double
+gsli_interval       pow_abs(const gsli_interval& x, const gsli_interval& y);
+
+// power function x^y, where y is integer; return [-Inf, Inf] if y < 0
+// is odd and x contains zero in interior
+gsli_interval       pow_int(const gsli_interval& x, long y);
+
+//----------------------------------------------------------------------
+//                     batch functions
+//----------------------------------------------------------------------
+// evaluate function for n elements of arrays x (and y); results are 
+// stored in res, which must have at least n elements
+void                plus(const gsli_interval* x, const gsli_interval* y, 
+                        gsli_interval* res, size_t n);
+void                minus(const gsli_interval* x, const gsli_interval* y, 
+                        gsli_interval* res, size_t n);
+void                mult(const gsli_interval* x, const gsli_interval* y, 
+                        gsli_interval* res, size_t n);
+void                div(const gsli_interval* x, const gsli_interval* y, 
+                        gsli_interval* res, size_t n);
+void                exp(const gsli_interval* x, gsli_interval* res, size_t n);
+void                log_abs(const gsli_interval* x, gsli_interval* res, size_t n);
+
+//----------------------------------------------------------------------
+//                     input-output
+//----------------------------------------------------------------------
+// write to output stream as [lower, upper]
+std::ostream&       operator<<(std::ostream& os, const gsli_interval& x);
+
+};
+
+#include "gsli/details/gsli_interval.inl"
\ No newline at end of file
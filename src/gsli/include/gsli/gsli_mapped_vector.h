@@ -0,0 +1,233 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_array_io.h"
+#include "gsli/details/gsli_file_map.h"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        chunk iterator
+//----------------------------------------------------------------------
+// iterator over consecutive chunks of an array; dereferencing returns
+// span of elements of a chunk; the last chunk can be shorter
+template<class T>
+class chunk_iterator
+{
+    public:
+        chunk_iterator()                : m_data(nullptr), m_size(0), m_chunk(1), m_pos(0) {};
+        chunk_iterator(T* data, size_t size, size_t chunk, size_t pos)
+            : m_data(data), m_size(size), m_chunk(chunk), m_pos(pos) {};
+
+        // elements of current chunk
+        span<T>             operator*() const;
+
+        // index of current chunk
+        size_t              index() const   { return m_pos / m_chunk; };
+
+        chunk_iterator&     operator++();
+        bool                operator==(const chunk_iterator& other) const;
+        bool                operator!=(const chunk_iterator& other) const;
+
+    private:
+        T*          m_data;
+        size_t      m_size;
+        size_t      m_chunk;
+        size_t      m_pos;
+};
+
+// range of chunks usable in range-based for loops
+template<class T>
+class chunk_range
+{
+    public:
+        chunk_range(T* data, size_t size, size_t chunk)
+            : m_data(data), m_size(size), m_chunk(chunk) {};
+
+        chunk_iterator<T>   begin() const;
+        chunk_iterator<T>   end() const;
+
+    private:
+        T*          m_data;
+        size_t      m_size;
+        size_t      m_chunk;
+};
+
+//----------------------------------------------------------------------
+//                        gsli_mapped_vector
+//----------------------------------------------------------------------
+// vector of gsli_double stored in a binary array file (see gsli_array_io.h)
+// and mapped to memory; files can be larger than physical memory, pages
+// are loaded on access and evicted by the system; elements are processed
+// in chunks of chunk_size() elements, see for_each_chunk
+class gsli_mapped_vector
+{
+    public:
+        using value_type    = gsli_double;
+        using map_advice    = details::map_advice;
+
+        // default number of elements in a chunk (8 MB)
+        static const size_t default_chunk_size  = size_t(1) << 20;
+
+    public:
+        // construct empty vector
+        gsli_mapped_vector();
+        ~gsli_mapped_vector();
+
+        gsli_mapped_vector(gsli_mapped_vector&& other);
+        gsli_mapped_vector& operator=(gsli_mapped_vector&& other);
+
+        gsli_mapped_vector(const gsli_mapped_vector&) = delete;
+        gsli_mapped_vector& operator=(const gsli_mapped_vector&) = delete;
+
+        // map existing file; if writable is true, then modifications are
+        // written to the file; previously mapped file is closed; on failure
+        // the vector is empty
+        array_status        open(const std::string& file, bool writable = false);
+
+        // create file storing n zeros and map it for writing
+        array_status        create(const std::string& file, size_t n);
+
+        // unmap file; modified pages are written by the system
+        void                close();
+
+        // write modified pages to the file; return false on failure
+        bool                flush();
+
+        bool                is_open() const;
+        bool                is_writable() const;
+
+        // number of elements
+        size_t              size() const;
+
+        // mapped elements; mutable access requires writable mapping
+        const gsli_double*  data() const;
+        gsli_double*        data();
+
+        const gsli_double&  operator[](size_t i) const;
+        gsli_double&        operator[](size_t i);
+
+        //------------------------------------------------------
+        //              chunks
+        //------------------------------------------------------
+        // set number of elements in a chunk; n > 0
+        void                set_chunk_size(size_t n);
+        size_t              chunk_size() const;
+
+        // number of chunks
+        size_t              num_chunks() const;
+
+        // elements of chunk i
+        span<const gsli_double> chunk(size_t i) const;
+        span<gsli_double>   chunk(size_t i);
+
+        // ranges of all chunks
+        chunk_range<const gsli_double>  chunks() const;
+        chunk_range<gsli_double>        chunks();
+
+        // give a hint about accesses of chunks [first, first + n)
+        void                advise(size_t first, size_t n, map_advice adv) const;
+
+    private:
+        void*               m_map;
+        size_t              m_map_size;
+        gsli_double*        m_data;
+        size_t              m_size;
+        size_t              m_chunk;
+        bool                m_writable;
+};
+
+//----------------------------------------------------------------------
+//                        chunk driver
+//----------------------------------------------------------------------
+// options of for_each_chunk
+struct stream_options
+{
+    // number of threads; 0: number of hardware threads
+    int         m_threads;
+
+    // number of chunks read ahead of the chunk being processed
+    size_t      m_read_ahead;
+
+    // if true, then pages of processed chunks of input vectors are 
+    // released, which reduces memory pressure when file is larger than
+    // memory
+    bool        m_release;
+
+    stream_options()    : m_threads(0), m_read_ahead(2), m_release(true) {};
+};
+
+// call f(i, chunk) for every chunk i of x, where chunk is span<const 
+// gsli_double>; chunks are distributed dynamically among threads, thus
+// f must be thread safe; read ahead of next chunks is requested before
+// chunk is processed, therefore reading from disk overlaps computations;
+// if f throws, remaining chunks are skipped and the first exception is
+// rethrown after all threads finish
+template<class Func>
+void                for_each_chunk(const gsli_mapped_vector& x, Func f, 
+                        const stream_options& opts = stream_options());
+
+// res = kernel(x) evaluated chunk by chunk by kernel(x_ptr, res_ptr, n);
+// e.g. kernel can be a batch function; res must be writable and have the
+// same size as x
+template<class Kernel>
+void                transform_chunks(const gsli_mapped_vector& x, gsli_mapped_vector& res, 
+                        Kernel kernel, const stream_options& opts = stream_options());
+
+// res = kernel(x, y) evaluated chunk by chunk by kernel(x_ptr, y_ptr, res_ptr, n)
+template<class Kernel>
+void                transform_chunks(const gsli_mapped_vector& x, const gsli_mapped_vector& y,
+                        gsli_mapped_vector& res, Kernel kernel, 
+                        const stream_options& opts = stream_options());
+
+// reduce x chunk by chunk; result of chunk i is kernel(x_ptr, n) and
+// results of chunks are combined in order of chunks by combine(acc, val),
+// starting from init; result does not depend on number of threads; Vector
+// is gsli_mapped_vector or gsli_vector
+template<class Vector, class Kernel, class Combine>
+gsli_double         reduce_chunks(const Vector& x, Kernel kernel, 
+                        Combine combine, const gsli_double& init,
+                        const stream_options& opts = stream_options());
+
+namespace details
+{
+
+// call f(i) for i = 0, ..., n - 1 using n_threads threads (0: number of
+// hardware threads); indices are assigned dynamically in increasing order;
+// if f throws, no further indices are assigned, all threads are joined
+// and the first exception is rethrown in the calling thread
+void                run_chunks(size_t n, int n_threads, const std::function<void (size_t)>& f);
+
+}
+
+};
+
+#include "gsli/details/gsli_mapped_vector.inl"
\ No newline at end of file
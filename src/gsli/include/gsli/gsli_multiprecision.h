@@ -0,0 +1,118 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+
+#include <boost/multiprecision/number.hpp>
+
+#include <type_traits>
+#include <stdint.h>
+
+// conversions from boost::multiprecision numbers to gsli_double; this
+// header is not included by gsli/gsli.h, since it requires boost headers;
+// integer types (e.g. cpp_int) and binary floating point types (e.g.
+// cpp_bin_float) are supported; level and index are computed from the bit
+// length and leading bits of the argument, thus numbers, that are too large
+// for double, are converted without overflow
+
+namespace sli
+{
+
+// convert integer or floating point multiprecision number to gsli_double;
+// leading 53 bits of x are rounded to nearest, therefore results of level
+// 0 are correctly rounded
+template<class Backend, boost::multiprecision::expression_template_option ET>
+gsli_double         to_gsli_double(const boost::multiprecision::number<Backend, ET>& x);
+
+namespace details
+{
+
+template<class Number>
+gsli_double mp_to_gsli_double(const Number& x, std::integral_constant<int, 
+                    boost::multiprecision::number_kind_integer>)
+{
+    if (x == 0)
+        return gsli_double();
+
+    // msb and lsb are found by ADL
+    bool is_neg         = x < 0;
+    Number abs_x        = is_neg ? Number(-x) : x;
+
+    // number of bits below leading 64 bits
+    int64_t shift       = int64_t(msb(abs_x)) - 63;
+
+    if (shift <= 0)
+    {
+        // conversion from uint64_t is rounded to nearest
+        double val      = double(abs_x.template convert_to<uint64_t>());
+        return gsli_double(is_neg ? -val : val);
+    };
+
+    uint64_t lead       = Number(abs_x >> unsigned(shift)).template convert_to<uint64_t>();
+
+    // nonzero bits below leading bits are accumulated in the lowest bit, 
+    // which is below the rounding bit of double; then rounding of lead is
+    // equal to rounding of x
+    if (int64_t(lsb(abs_x)) < shift)
+        lead            |= 1;
+
+    double mant         = double(lead);
+    return gsli_double(is_neg ? -mant : mant, shift, gsli_double::mant_exp());
+};
+
+template<class Number>
+gsli_double mp_to_gsli_double(const Number& x, std::integral_constant<int, 
+                    boost::multiprecision::number_kind_floating_point>)
+{
+    if (boost::multiprecision::isnan(x) == true)
+        return gsli_double::make_nan();
+
+    if (boost::multiprecision::isinf(x) == true)
+        return gsli_double::make_infinity(x < 0);
+
+    if (x == 0)
+        return gsli_double(boost::multiprecision::signbit(x) ? -0.0 : 0.0);
+
+    // x = m * 2^exp, 0.5 <= |m| < 1; m is converted with rounding to 
+    // nearest
+    long long exp;
+    Number m            = boost::multiprecision::frexp(x, &exp);
+    double mant         = m.template convert_to<double>();
+
+    return gsli_double(mant, int64_t(exp), gsli_double::mant_exp());
+};
+
+}
+
+template<class Backend, boost::multiprecision::expression_template_option ET>
+inline gsli_double to_gsli_double(const boost::multiprecision::number<Backend, ET>& x)
+{
+    using number_type   = boost::multiprecision::number<Backend, ET>;
+    using category      = boost::multiprecision::number_category<number_type>;
+
+    // number_category is derived from mpl::int_ or from std::integral_constant
+    // depending on boost version
+    return details::mp_to_gsli_double(x, std::integral_constant<int, category::value>());
+};
+
+};
\ No newline at end of file
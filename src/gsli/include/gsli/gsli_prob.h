@@ -0,0 +1,172 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_functions.h"
+
+#include <iosfwd>
+#include <stdint.h>
+
+namespace sli
+{
+
+// nonnegative number in generalized symmetric level-index representation,
+// intended for probabilities and likelihoods; encoding is the same as
+// encoding of gsli_double, but only values with positive index sign are
+// allowed; therefore conversions between gsli_prob and gsli_double are
+// free, addition cannot hit cancellation paths and comparisons do not
+// depend on signs
+class gsli_prob
+{
+    public:
+        // config storing representation parameters
+        using config_type   = gsli_double::config_type;
+
+        // internal encoding tag
+        struct internal_rep{};
+
+    private:
+        // encoding of a nonnegative gsli_double number
+        double              m_data;
+
+    public:
+        //------------------------------------------------------
+        //                  constructors
+        //------------------------------------------------------
+        // initialize to 0.0
+        gsli_prob();
+
+        // conversion from a floating point number; require a >= 0 or
+        // a is NaN; -0 is converted to 0; conversion is explicit in
+        // order to avoid ambiguities with gsli_double functions
+        explicit gsli_prob(double a);
+
+        // conversion from gsli_double; require x >= 0 or x is NaN;
+        // -0 is converted to 0
+        explicit gsli_prob(const gsli_double& x);
+
+        // constructor from internal representation; no checks are
+        // performed
+        gsli_prob(double a, internal_rep);
+
+        // construct zero number
+        static gsli_prob    make_zero();
+
+        // construct one
+        static gsli_prob    make_one();
+
+        // construct NaN number
+        static gsli_prob    make_nan();
+
+        // construct +infinity
+        static gsli_prob    make_infinity();
+
+    public:
+        // convert this value to double
+        double              get_value() const;
+
+        // convert this value to gsli_double
+        gsli_double         get_gsli_double() const;
+
+        // return internal representation
+        const double&       get_internal_rep() const;
+
+    public:
+        //------------------------------------------------------
+        //          arithmetic assignment operators
+        //------------------------------------------------------
+        gsli_prob&          operator+=(const gsli_prob& s);
+        gsli_prob&          operator*=(const gsli_prob& s);
+        gsli_prob&          operator/=(const gsli_prob& s);
+};
+
+//----------------------------------------------------------------------
+//                        value classification
+//----------------------------------------------------------------------
+// return true if value is finite (i.e. neither NaN, nor an infinity)
+bool                is_finite(const gsli_prob& v);
+
+// return true if this value represents 0
+bool                is_zero(const gsli_prob& v);
+
+// return true if this value represents NaN
+bool                is_nan(const gsli_prob& v);
+
+// return true if this value represents +Inf
+bool                is_inf(const gsli_prob& v);
+
+//----------------------------------------------------------------------
+//                     unary functions
+//----------------------------------------------------------------------
+// inverse function
+gsli_prob           inv(const gsli_prob& p);
+
+// logarithm function; log(0) = -Inf
+gsli_double         log(const gsli_prob& p);
+
+// exponential function, exp(x), of a number x of any sign
+gsli_prob           exp_prob(const gsli_double& x);
+
+//----------------------------------------------------------------------
+//                     arithmetic functions
+//----------------------------------------------------------------------
+// sum of nonnegative numbers; cancellation is not possible
+gsli_prob           operator+(const gsli_prob& x1, const gsli_prob& x2);
+
+// multiplication and division
+gsli_prob           operator*(const gsli_prob& x1, const gsli_prob& x2);
+gsli_prob           operator/(const gsli_prob& x1, const gsli_prob& x2);
+
+// power function x^y
+gsli_prob           pow(const gsli_prob& x, const gsli_double& y);
+
+// power function x^y, where y is integer
+gsli_prob           pow_int(const gsli_prob& x, long y);
+
+//----------------------------------------------------------------------
+//                     comparison functions
+//----------------------------------------------------------------------
+// comparisons are based on ordinal numbers of encodings, sign of
+// index and level need not be examined
+bool                operator==(const gsli_prob& x1, const gsli_prob& x2);
+bool                operator!=(const gsli_prob& x1, const gsli_prob& x2);
+bool                operator>(const gsli_prob& x1, const gsli_prob& x2);
+bool                operator<(const gsli_prob& x1, const gsli_prob& x2);
+bool                operator>=(const gsli_prob& x1, const gsli_prob& x2);
+bool                operator<=(const gsli_prob& x1, const gsli_prob& x2);
+
+//----------------------------------------------------------------------
+//                     batch functions
+//----------------------------------------------------------------------
+// return sum of n elements of array x
+gsli_prob           sum(const gsli_prob* x, size_t n);
+
+//----------------------------------------------------------------------
+//                     input-output
+//----------------------------------------------------------------------
+// write to output stream
+std::ostream&       operator<<(std::ostream& os, const gsli_prob& x);
+
+};
+
+#include "gsli/details/gsli_prob.inl"
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_counters.h"
+
+#include <iosfwd>
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli { namespace profile
+{
+
+//----------------------------------------------------------------------
+//                        data histograms
+//----------------------------------------------------------------------
+// histograms of levels, binary exponents of indices and value classes
+// of an array of gsli_double numbers
+struct data_histogram
+{
+    using config_type       = gsli_double::config_type;
+
+    static const int max_level  = config_type::max_level;
+    static const int max_exp_0  = config_type::max_index_exp_0;
+    static const int max_exp_k  = config_type::max_index_exp_1;
+
+    static const int n_level    = 2 * max_level + 1;
+    static const int n_exp_0    = 2 * max_exp_0 + 1;
+    static const int n_exp_k    = max_exp_k + 1;
+    static const int n_fptype   = 5;
+
+    // number of values
+    uint64_t    m_count;
+
+    // number of regular values with level -max_level + i
+    uint64_t    m_level[n_level];
+
+    // number of level 0 values with index exponent -max_exp_0 + i
+    uint64_t    m_exp_0[n_exp_0];
+
+    // number of level k values with index exponent i
+    uint64_t    m_exp_k[n_exp_k];
+
+    // number of values of given class (indexed by fptype)
+    uint64_t    m_fptype[n_fptype];
+
+    // return number of regular values with given level
+    uint64_t    get_level(int level) const;
+
+    // return number of values of given class
+    uint64_t    get_fptype(fptype ft) const;
+
+    // add counts from other histogram
+    data_histogram& operator+=(const data_histogram& other);
+};
+
+// compute histograms of n elements of array x
+data_histogram      histogram(const gsli_double* x, size_t n);
+
+// print histograms; only nonzero bins are printed, level 0 exponents
+// are grouped in bins of width 64
+std::ostream&       operator<<(std::ostream& os, const data_histogram& h);
+
+//----------------------------------------------------------------------
+//                        operation profiles
+//----------------------------------------------------------------------
+// class of an operand
+enum class operand_class : int
+{
+    level_0 = 0,    // level 0 number
+    level_k,        // level k number
+    special,        // zero, infinity or NaN
+    none,           // second operand of an unary function
+    count
+};
+
+// return class of x
+operand_class       classify(const gsli_double& x);
+
+// return name of an operand class
+const char*         operand_class_name(operand_class c);
+
+// counts and evaluation times of operations for every pair of operand
+// classes
+struct op_profile
+{
+    static const int n_op       = int(counter_op::count);
+    static const int n_class    = int(operand_class::count);
+
+    uint64_t    m_count[n_op][n_class][n_class];
+    uint64_t    m_time_ns[n_op][n_class][n_class];
+
+    // return number of recorded operations
+    uint64_t    get_count(counter_op op, operand_class c1, operand_class c2) const;
+
+    // return total evaluation time of recorded operations in nanoseconds
+    uint64_t    get_time_ns(counter_op op, operand_class c1, operand_class c2) const;
+
+    // return average evaluation time in nanoseconds or 0 if there are no
+    // recorded operations
+    double      get_ns_per_op(counter_op op, operand_class c1, operand_class c2) const;
+
+    // add counts and times from other profile
+    op_profile& operator+=(const op_profile& other);
+};
+
+// evaluate operation op for every stride-th pair of operands x1[i], x2[i],
+// i < n, and record counts and evaluation times for every pair of classes
+// of operands in the profile of the calling thread; operands are grouped
+// by classes before evaluation, and every group is timed as a whole;
+// for unary operations (inv, exp, log) x2 is not used and can be null,
+// and the second class is operand_class::none; for pow_int the second
+// operand is x2[i] clamped to [-LONG_MAX/2, LONG_MAX/2] and converted to
+// long, NaN is replaced by 0; cmp evaluates operator<
+//
+// recording is lock-free; every thread writes to its own buffer
+void                sample_op(counter_op op, const gsli_double* x1, 
+                        const gsli_double* x2, size_t n, size_t stride = 1);
+
+// return sum of profiles recorded by all threads (including threads,
+// that already finished)
+op_profile          get_op_profile();
+
+// clear profiles of all threads; profiles should not be recorded
+// concurrently, otherwise some counts may not be cleared
+void                reset_op_profile();
+
+// print profile; for every operation and pair of classes with nonzero
+// count one line with count and average time is printed
+std::ostream&       operator<<(std::ostream& os, const op_profile& p);
+
+}};
\ No newline at end of file
@@ -0,0 +1,163 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+
+#include <iosfwd>
+#include <vector>
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli
+{
+
+//----------------------------------------------------------------------
+//                        operation traces
+//----------------------------------------------------------------------
+// when GSLI_TRACE is defined in config.h, then calls of general versions
+// of operations on gsli_double (i.e. calls, that did not take the fast
+// path) can be recorded together with bit patterns of operands and of
+// the result; every thread records to its own ring buffer, recording is
+// started by start_trace; recorded traces can be saved to a binary file
+// and re-executed later with replay
+
+// traced operation; subtraction is recorded as addition of negated
+// operand
+enum class trace_op : uint8_t
+{
+    plus    = 0,
+    mult,
+    div,
+    pow_abs,
+    pow_int,
+    inv,
+    exp,
+    log,
+    cmp_gt,
+    cmp_lt,
+    cmp_geq,
+    cmp_leq,
+    count
+};
+
+// types of operands
+enum class trace_args : uint8_t
+{
+    unary   = 0,    // gsli_double; second operand is not used
+    gsli_gsli,      // gsli_double, gsli_double
+    gsli_real,      // gsli_double, double
+    real_gsli,      // double, gsli_double
+    gsli_long,      // gsli_double, long
+    count
+};
+
+// single recorded call; operands and result are stored as bit patterns
+// of internal representation of gsli_double, of double or of long; 
+// result of a comparison is stored as 0 or 1
+struct trace_record
+{
+    uint64_t    m_arg_1;
+    uint64_t    m_arg_2;
+    uint64_t    m_result;
+    trace_op    m_op;
+    trace_args  m_args;
+};
+
+// return true if tracing is enabled
+bool                trace_enabled();
+
+// start recording in the calling thread to a ring buffer with capacity
+// records; every period-th call of a general version is recorded;
+// previously recorded calls are removed
+void                start_trace(size_t capacity, size_t period = 1);
+
+// stop recording in the calling thread; recorded calls are not removed
+void                stop_trace();
+
+// return number of calls recorded by the calling thread since the last
+// start_trace, including calls overwritten in the ring buffer
+uint64_t            trace_total();
+
+// return calls stored in the ring buffer of the calling thread, oldest
+// first
+std::vector<trace_record>   get_trace();
+
+// write trace to a binary stream; records are stored as 26 bytes in
+// little endian order after a header with magic number and record count
+void                write_trace(std::ostream& os, const std::vector<trace_record>& trace);
+
+// read trace written by write_trace; return false if stream does not
+// contain a valid trace
+bool                read_trace(std::istream& is, std::vector<trace_record>& trace);
+
+// evaluate recorded call and return bit pattern of the result
+uint64_t            replay(const trace_record& rec);
+
+// return name of a traced operation
+const char*         trace_op_name(trace_op op);
+
+namespace details
+{
+
+// record call if tracing is active in the calling thread
+void                trace_call(trace_op op, trace_args args, uint64_t arg_1, 
+                        uint64_t arg_2, uint64_t result);
+
+// bit patterns of operands
+uint64_t            trace_bits(const gsli_double& x);
+uint64_t            trace_bits(double x);
+uint64_t            trace_bits(long x);
+uint64_t            trace_bits(bool x);
+
+// types of operands
+trace_args          trace_kind(const gsli_double& x1, const gsli_double& x2);
+trace_args          trace_kind(const gsli_double& x1, double x2);
+trace_args          trace_kind(double x1, const gsli_double& x2);
+trace_args          trace_kind(const gsli_double& x1, long x2);
+
+// record call of a binary operation and return res
+template<class T1, class T2, class Result>
+Result              trace_result(trace_op op, const T1& x1, const T2& x2, 
+                        const Result& res);
+
+// record call of an unary operation and return res
+template<class Result>
+Result              trace_result(trace_op op, const gsli_double& x, const Result& res);
+
+};
+
+};
+
+// macros used to record calls; expand to the result when tracing is
+// disabled
+#ifdef GSLI_TRACE
+    #define GSLI_TRACE_RESULT(op, x1, x2, res)                              \
+        sli::details::trace_result(sli::trace_op::op, x1, x2, res)
+    #define GSLI_TRACE_RESULT_1(op, x, res)                                 \
+        sli::details::trace_result(sli::trace_op::op, x, res)
+#else
+    #define GSLI_TRACE_RESULT(op, x1, x2, res)      (res)
+    #define GSLI_TRACE_RESULT_1(op, x, res)         (res)
+#endif
+
+#include "gsli/details/gsli_trace.inl"
\ No newline at end of file
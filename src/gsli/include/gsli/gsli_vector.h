@@ -0,0 +1,290 @@
+/*
+*  This file is a part of GSLI library.
+*
+*  Copyright (c) Pawe Kowal 2017 - 2021
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program; if not, write to the Free Software
+*  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#pragma once
+
+#include "gsli/config.h"
+#include "gsli/gsli_double.h"
+#include "gsli/gsli_array_io.h"
+#include "gsli/gsli_mapped_vector.h"
+
+#include <algorithm>
+#include <vector>
+#include <stdint.h>
+#include <cstddef>
+
+namespace sli
+{
+
+namespace details
+{
+
+// allocate size bytes aligned to align bytes (a power of 2); return null
+// on failure
+void*               aligned_malloc(size_t size, size_t align);
+
+// free memory allocated by aligned_malloc
+void                aligned_free(void* ptr);
+
+// allocator of memory aligned to cache lines
+template<class T>
+class cache_aligned_allocator
+{
+    public:
+        using value_type    = T;
+
+        static const size_t alignment   = 64;
+
+    public:
+        cache_aligned_allocator() {};
+
+        template<class U>
+        cache_aligned_allocator(const cache_aligned_allocator<U>&) {};
+
+        T*      allocate(size_t n);
+        void    deallocate(T* ptr, size_t n);
+
+        template<class U>
+        bool    operator==(const cache_aligned_allocator<U>&) const { return true; };
+
+        template<class U>
+        bool    operator!=(const cache_aligned_allocator<U>&) const { return false; };
+};
+
+}
+
+//----------------------------------------------------------------------
+//                        chunk summary
+//----------------------------------------------------------------------
+// summary of elements in a chunk of gsli_vector; zeros have level 
+// -(max_level + 1) as in gsli_rep, infinities have level max_level + 1
+struct chunk_summary
+{
+    // minimum and maximum level of elements other than NaN; if all 
+    // elements are NaN, then min_level > max_level
+    int         m_min_level;
+    int         m_max_level;
+
+    // all elements are zeros or level 0 numbers
+    bool        m_all_level_0;
+
+    // all elements are zeros or |x| is in [1/max_index_0_sqrt, 
+    // max_index_0_sqrt]; then sums, differences and products of these 
+    // elements are level 0 numbers, and are computed by double arithmetic
+    bool        m_all_moderate;
+
+    // at least one element is zero; products of zeros are not evaluated
+    // by double arithmetic, since signs of zeros may differ
+    bool        m_has_zero;
+
+    // at least one element is an infinity or NaN
+    bool        m_has_special;
+
+    // at least one element is NaN
+    bool        m_has_nan;
+};
+
+//----------------------------------------------------------------------
+//                        gsli_vector
+//----------------------------------------------------------------------
+// contiguous vector of gsli_double split into chunks of fixed_chunk_size
+// elements; for every chunk numbers of elements on every level are
+// stored and updated on every write, which allows batch functions to use
+// double arithmetic for chunks of level 0 numbers, and queries about all
+// elements to inspect only summaries of chunks; elements and summaries 
+// are aligned to cache lines
+class gsli_vector
+{
+    public:
+        using value_type        = gsli_double;
+        using const_iterator    = const gsli_double*;
+
+        // number of elements in a chunk
+        static const size_t fixed_chunk_size    = 1024;
+
+    private:
+        using config_type       = gsli_double::config_type;
+
+        static const int n_levels       = 2 * config_type::max_level + 3;
+
+        // numbers of elements in a chunk by level (NaN are not counted); 
+        // levels are stored with offset max_level + 1; m_moderate does not
+        // count zeros
+        struct alignas(32) chunk_counts
+        {
+            uint16_t    m_level[n_levels];
+            uint16_t    m_moderate;
+            uint16_t    m_zero;
+            uint16_t    m_nan;
+        };
+
+        using data_vector       = std::vector<gsli_double, 
+                                    details::cache_aligned_allocator<gsli_double>>;
+        using count_vector      = std::vector<chunk_counts, 
+                                    details::cache_aligned_allocator<chunk_counts>>;
+
+    public:
+        // construct empty vector
+        gsli_vector();
+
+        // construct vector of n zeros
+        explicit gsli_vector(size_t n);
+
+        // copy n elements of x
+        gsli_vector(const gsli_double* x, size_t n);
+
+        //------------------------------------------------------
+        //              access
+        //------------------------------------------------------
+        size_t              size() const;
+        bool                empty() const;
+
+        // elements; mutable access is provided only by functions, that
+        // update summaries
+        const gsli_double*  data() const;
+        const gsli_double&  operator[](size_t i) const;
+        const_iterator      begin() const;
+        const_iterator      end() const;
+
+        //------------------------------------------------------
+        //              modification
+        //------------------------------------------------------
+        // set element i to x
+        void                set(size_t i, const gsli_double& x);
+
+        // append an element
+        void                push_back(const gsli_double& x);
+
+        // change size; new elements are zeros
+        void                resize(size_t n);
+
+        // replace elements by n elements of x
+        void                assign(const gsli_double* x, size_t n);
+
+        // call f(ptr, len) for elements [first, first + len) and update
+        // summaries of modified chunks; f receives gsli_double*, therefore
+        // any batch function can be used
+        template<class Func>
+        void                update(size_t first, size_t len, Func f);
+
+        //------------------------------------------------------
+        //              chunks
+        //------------------------------------------------------
+        static size_t       chunk_size();
+        size_t              num_chunks() const;
+
+        // elements of chunk k
+        span<const gsli_double> chunk(size_t k) const;
+
+        // range of all chunks
+        chunk_range<const gsli_double>  chunks() const;
+
+        // summary of chunk k
+        chunk_summary       summary(size_t k) const;
+
+        //------------------------------------------------------
+        //              queries
+        //------------------------------------------------------
+        // these functions inspect only summaries of chunks
+
+        // return true if any element is NaN
+        bool                any_nan() const;
+
+        // return true if any element is infinite or NaN
+        bool                any_special() const;
+
+        // return true if all elements are zeros or level 0 numbers
+        bool                all_level_0() const;
+
+        // minimum and maximum level of elements other than NaN; zeros 
+        // have level -(max_level + 1); return 0 for empty vector
+        int                 min_level() const;
+        int                 max_level() const;
+
+        // return the largest absolute value of elements ignoring NaN; 
+        // only chunks containing elements of the highest level are 
+        // inspected; return zero for empty vector and NaN if all elements
+        // are NaN
+        gsli_double         max_abs() const;
+
+    private:
+        // add (inc = 1) or remove (inc = -1) element x from counts of chunk k
+        void                count(size_t k, const gsli_double& x, int inc);
+
+        // recompute counts of chunks [first, last)
+        void                recount(size_t first, size_t last);
+
+        // recompute counts of chunk k, when all elements are zeros or level
+        // 0 numbers
+        void                recount_level_0(size_t k);
+
+        size_t              chunk_length(size_t k) const;
+
+        // return true if all elements of chunk k are moderate numbers or
+        // zeros (if allow_zero is true)
+        bool                is_moderate_chunk(size_t k, bool allow_zero) const;
+
+        using binary_kernel = void (*)(const gsli_double* x, const gsli_double* y, 
+                                gsli_double* res, size_t n);
+
+        // evaluate res = op(x, y) by fast kernel for chunks, where x and y
+        // are moderate, and by general kernel otherwise
+        static void         eval_binary(const gsli_vector& x, const gsli_vector& y, 
+                                gsli_vector& res, bool allow_zero, binary_kernel fast, 
+                                binary_kernel general);
+
+        friend void         plus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+        friend void         minus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+        friend void         mult(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+
+    private:
+        data_vector         m_data;
+        count_vector        m_counts;
+};
+
+//----------------------------------------------------------------------
+//                        batch functions
+//----------------------------------------------------------------------
+// res = x op y elementwise; x and y must have the same size; res is
+// resized; chunks, where both x and y are moderate (see chunk_summary),
+// are evaluated by double arithmetic; results are equal to results of
+// the batch functions for arrays
+void                plus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+void                minus(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+void                mult(const gsli_vector& x, const gsli_vector& y, gsli_vector& res);
+
+// sum of all elements computed sequentially as sum(x.data(), x.size()); 
+// moderate chunks are summed using double arithmetic while the sum 
+// remains moderate
+gsli_double         sum(const gsli_vector& x);
+
+// convert all elements to double and store in res, which must have at
+// least x.size() elements; level 0 chunks are copied
+void                get_value(const gsli_vector& x, double* res);
+
+// call f(i, chunk) for every chunk i of x using many threads; see 
+// for_each_chunk for gsli_mapped_vector; reduce_chunks can also be used
+template<class Func>
+void                for_each_chunk(const gsli_vector& x, Func f, 
+                        const stream_options& opts = stream_options());
+
+};
+
+#include "gsli/details/gsli_vector.inl"
\ No newline at end of file
@@ -23,27 +23,36 @@
 #include "test_gsli_perf.h"
 
 #include <iostream>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
 //#include <vld.h>
 
 int main(int argc, const char* argv[])
 {
     using namespace sli::testing;
 
-    (void)argc;
-    (void)argv;    
-
     try
     {
+        // replay a recorded trace: test_gsli --replay <file> [n_rep]
+        if (argc >= 3 && std::string(argv[1]) == "--replay")
+        {
+            int n_rep   = argc >= 4 ? std::atoi(argv[3]) : 10;
+            return test_gsli::replay_trace_file(argv[2], std::max(n_rep, 1));
+        };
+
         test_gsli().test();
         test_gsli_perf().test();
     }
     catch(std::exception& ex)
     {
         std::cout << ex.what();
+        return 1;
     }
     catch(gsli::assert_exception& ex)
     {
         std::cout << ex.what();
+        return 1;
     }    
 
     return 0;
@@ -18,8 +18,6 @@
 *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 */
 
-#pragma once
-
 #include "test_gsli.h"
 
 #include "timer.h"
@@ -29,6 +27,25 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+#if defined(__has_include)
+    #if __has_include(<boost/multiprecision/cpp_int.hpp>) \
+        && __has_include(<boost/multiprecision/cpp_bin_float.hpp>)
+        #define GSLI_TEST_HAS_BOOST
+    #endif
+#endif
+
+#ifdef GSLI_TEST_HAS_BOOST
+    #include "gsli/gsli_multiprecision.h"
+    #include <boost/multiprecision/cpp_int.hpp>
+    #include <boost/multiprecision/cpp_bin_float.hpp>
+#endif
 
 namespace sli { namespace testing
 {
@@ -1065,6 +1082,406 @@ void test_gsli::test_log_exp_lev(int n_rep, int max_lev)
     std::cout << "; mean error: " << prec_mean << "; max error: " << prec_max << "\n";
 };
 
+// return true if exact value ex is contained in x
+static bool contains_exact(const gsli_interval& x, long double ex)
+{
+    return (long double)x.lower().get_value() <= ex 
+        && ex <= (long double)x.upper().get_value();
+};
+
+void test_gsli::test_interval_0(int n_rep)
+{
+    std::cout << "\n" << "testing interval level 0" << "\n";
+
+    bool failed         = false;
+    double width_max    = 0.0;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        double x1       = rand_num(-300, 300);
+        double x2       = rand_num(-300, 300);
+        double y1       = rand_num(-300, 300);
+        double y2       = rand_num(-300, 300);
+
+        if (x2 < x1) std::swap(x1, x2);
+        if (y2 < y1) std::swap(y1, y2);
+
+        // points inside intervals
+        double px       = x1 + (x2 - x1) * genrand_real1();
+        double py       = y1 + (y2 - y1) * genrand_real1();
+
+        if (px < x1 || px > x2) px = x1;
+        if (py < y1 || py > y2) py = y2;
+
+        gsli_interval x(x1, x2);
+        gsli_interval y(y1, y2);
+
+        long double lx  = px;
+        long double ly  = py;
+
+        bool err        = false;
+
+        err |= contains_exact(x + y, lx + ly) == false;
+        err |= contains_exact(x - y, lx - ly) == false;
+        err |= contains_exact(x * y, lx * ly) == false;
+
+        if (y1 > 0 || y2 < 0)
+            err |= contains_exact(x / y, lx / ly) == false;
+
+        if (std::abs(px) < 700.0)
+            err |= contains_exact(exp(x), std::exp(lx)) == false;
+
+        if (x1 > 0)
+            err |= contains_exact(log_abs(x), std::log(lx)) == false;
+
+        // point intervals must be tight
+        gsli_interval px_int(px);
+        gsli_interval py_int(py);
+
+        double width    = ulp_width(px_int * py_int);
+        width_max       = std::max(width_max, width);
+
+        if (width > 2.0)
+            err         = true;
+
+        if (err == true)
+        {
+            failed      = true;
+            std::cout   << i << " " << x << " " << y << " " << px << " " << py << "\n";
+        };
+    };
+
+    if (failed == true)
+        std::cout << "FAILED";
+    else
+        std::cout << "OK";
+
+    std::cout << "; max width: " << width_max << "\n";
+};
+
+gsli_interval test_gsli::rand_interval(int max_lev, gsli_double& point)
+{
+    gsli_double v[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        v[i]    = rand_gsli(false, true, max_lev);
+
+        if (is_nan(v[i]) == true)
+            v[i]= gsli_double::make_zero();
+    };
+
+    std::sort(v, v + 3);
+
+    point       = v[1];
+    return gsli_interval(v[0], v[2]);
+};
+
+void test_gsli::test_interval_lev(int n_rep, int max_lev)
+{
+    std::cout << "\n" << "testing interval lev > 1" << "\n";
+
+    bool failed         = false;
+    long n_cases        = 0;
+
+    std::vector<gsli_interval> vec_x, vec_y, vec_res1, vec_res2;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        gsli_double px, py;
+        gsli_interval x = rand_interval(max_lev, px);
+        gsli_interval y = rand_interval(max_lev, py);
+
+        vec_x.push_back(x);
+        vec_y.push_back(y);
+
+        bool err        = false;
+
+        // results for points inside intervals must be contained in
+        // results for intervals
+        gsli_double res[]       = {px + py, px - py, px * py, px / py, exp(px), 
+                                   log_abs(px), inv(px), pow_abs(px, py), 
+                                   pow_int(px, 3), pow_int(px, -2)};
+        gsli_interval res_int[] = {x + y, x - y, x * y, x / y, exp(x), 
+                                   log_abs(x), inv(x), pow_abs(x, y),
+                                   pow_int(x, 3), pow_int(x, -2)};
+
+        int n_res       = sizeof(res) / sizeof(res[0]);
+
+        for (int j = 0; j < n_res; ++j)
+        {
+            if (is_nan(res[j]) == true)
+                continue;
+
+            ++n_cases;
+
+            if (is_nan(res_int[j]) == true || contains(res_int[j], res[j]) == false)
+            {
+                err     = true;
+                std::cout << j << ": " << res[j] << " " << res_int[j] << "\n";
+            }
+        };
+
+        if (err == true)
+        {
+            failed      = true;
+            std::cout   << i << " " << x << " " << y << " " << px << " " << py << "\n";
+        };
+    };
+
+    // batch versions must agree with scalar versions
+    vec_res1.resize(n_rep);
+
+    mult(vec_x.data(), vec_y.data(), vec_res1.data(), n_rep);
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        gsli_interval res   = vec_x[i] * vec_y[i];
+
+        if (equal_nan(res.lower(), vec_res1[i].lower()) == false 
+            || equal_nan(res.upper(), vec_res1[i].upper()) == false)
+        {
+            failed          = true;
+        }
+    };
+
+    exp(vec_x.data(), vec_res1.data(), n_rep);
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        gsli_interval res   = exp(vec_x[i]);
+
+        if (equal_nan(res.lower(), vec_res1[i].lower()) == false 
+            || equal_nan(res.upper(), vec_res1[i].upper()) == false)
+        {
+            failed          = true;
+        }
+    };
+
+    if (failed == true)
+        std::cout << "FAILED";
+    else
+        std::cout << "OK";
+
+    std::cout << "; cases: " << n_cases << "\n";
+};
+
+double test_gsli::ulp_error(double calc, long double exact)
+{
+    double ex_d     = (double)exact;
+    double abs_ex   = std::abs(ex_d);
+    double ulp      = std::nextafter(abs_ex, std::numeric_limits<double>::infinity()) 
+                    - abs_ex;
+
+    if (std::isfinite(calc) == false)
+        return 1.0e100;
+
+    return (double)(std::abs((long double)calc - exact) / ulp);
+};
+
+double test_gsli::abs_ulp_error(double calc, long double exact)
+{
+    if (std::abs(exact) < 1.0)
+    {
+        if (std::isfinite(calc) == false)
+            return 1.0e100;
+
+        return (double)(std::abs((long double)calc - exact) 
+                        / std::numeric_limits<double>::epsilon());
+    };
+
+    return ulp_error(calc, exact);
+};
+
+void test_gsli::test_math_kernels(int n_rep)
+{
+    std::cout << "\n" << "testing exp and log kernels" << "\n";
+
+    // when long double is double, then errors of reference values
+    // must be taken into account
+    double tol          = (sizeof(long double) > sizeof(double)) ? 1.0 : 2.0;
+    double min_normal   = std::numeric_limits<double>::min();
+
+    double err_exp      = 0.0;
+    double err_log      = 0.0;
+    double err_exp_f    = 0.0;
+    double err_log_f    = 0.0;
+    bool failed         = false;
+
+    std::vector<double> vec_x, vec_res;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        double x        = -745.0 + genrand_real1() * (709.7 + 745.0);
+        long double ex  = std::exp((long double)x);
+
+        vec_x.push_back(x);
+
+        if (std::abs(ex) >= min_normal)
+        {
+            err_exp     = std::max(err_exp, ulp_error(details::exp_kernel(x), ex));
+            err_exp_f   = std::max(err_exp_f, ulp_error(details::exp_kernel_fast(x), ex));
+        };
+
+        // random positive normal number
+        double y        = std::abs(rand_num(false, false));
+
+        if (y < min_normal)
+            continue;
+
+        long double ey  = std::log((long double)y);
+        err_log         = std::max(err_log, ulp_error(details::log_kernel(y), ey));
+        err_log_f       = std::max(err_log_f, abs_ulp_error(details::log_kernel_fast(y), ey));
+
+        // arguments close to 1, as in log(1 + w)
+        double w        = 1.0 + std::ldexp(genrand_real1() - 0.5, -int(genrand_int32() % 61));
+        long double ew  = std::log((long double)w);
+        err_log_f       = std::max(err_log_f, abs_ulp_error(details::log_kernel_fast(w), ew));
+    };
+
+    if (err_exp > tol || err_log > tol)
+        failed          = true;
+
+    if (err_exp_f > tol + 1.0 || err_log_f > tol + 1.0)
+        failed          = true;
+
+    // special values
+    double inf          = std::numeric_limits<double>::infinity();
+    double nan          = std::numeric_limits<double>::quiet_NaN();
+
+    if (details::exp_kernel(1000.0) != inf || details::exp_kernel(-1000.0) != 0.0
+        || details::exp_kernel(-inf) != 0.0 || details::exp_kernel(inf) != inf
+        || std::isnan(details::exp_kernel(nan)) == false
+        || details::exp_kernel(0.0) != 1.0)
+    {
+        failed          = true;
+    }
+
+    if (details::log_kernel(0.0) != -inf || details::log_kernel(inf) != inf
+        || std::isnan(details::log_kernel(-1.0)) == false
+        || std::isnan(details::log_kernel(nan)) == false
+        || details::log_kernel(1.0) != 0.0
+        || ulp_error(details::log_kernel(1.0e-310), std::log((long double)1.0e-310)) > tol)
+    {
+        failed          = true;
+    }
+
+    if (details::exp_kernel_fast(1000.0) != inf || details::exp_kernel_fast(-1000.0) != 0.0
+        || std::isnan(details::exp_kernel_fast(nan)) == false
+        || details::exp_kernel_fast(0.0) != 1.0
+        || details::log_kernel_fast(0.0) != -inf || details::log_kernel_fast(inf) != inf
+        || std::isnan(details::log_kernel_fast(-1.0)) == false
+        || abs_ulp_error(details::log_kernel_fast(1.0e-310), 
+                         std::log((long double)1.0e-310)) > tol + 1.0)
+    {
+        failed          = true;
+    }
+
+    // batch versions must agree with scalar versions
+    vec_res.resize(vec_x.size());
+    details::exp_kernel(vec_x.data(), vec_res.data(), vec_x.size());
+
+    for (size_t i = 0; i < vec_x.size(); ++i)
+    {
+        if (vec_res[i] != details::exp_kernel(vec_x[i]))
+            failed      = true;
+
+        vec_x[i]        = vec_res[i];
+    };
+
+    details::log_kernel(vec_x.data(), vec_res.data(), vec_x.size());
+
+    for (size_t i = 0; i < vec_x.size(); ++i)
+    {
+        if (vec_res[i] != details::log_kernel(vec_x[i]))
+            failed      = true;
+    };
+
+    if (failed == true)
+        std::cout << "FAILED";
+    else
+        std::cout << "OK";
+
+    std::cout << "; max error exp: " << err_exp << "; max error log: " << err_log
+              << "; max error exp fast: " << err_exp_f << "; max error log fast: " << err_log_f
+              << "\n";
+};
+
+void test_gsli::test_prob(int n_rep, int max_lev)
+{
+    std::cout << "\n" << "testing gsli_prob" << "\n";
+
+    bool failed         = false;
+
+    std::vector<gsli_prob> vec_x;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        gsli_double dx  = abs(rand_gsli(false, true, max_lev));
+        gsli_double dy  = abs(rand_gsli(false, true, max_lev));
+
+        gsli_prob x     = gsli_prob(dx);
+        gsli_prob y     = gsli_prob(dy);
+
+        vec_x.push_back(x);
+
+        // results must be the same as results for gsli_double
+        gsli_double res[]   = {dx + dy, dx * dy, dx / dy, inv(dx), pow_int(dx, 3),
+                               pow_abs(dx, dy)};
+        gsli_prob res_p[]   = {x + y, x * y, x / y, inv(x), pow_int(x, 3), 
+                               pow(x, dy)};
+
+        int n_res       = sizeof(res) / sizeof(res[0]);
+        bool err        = false;
+
+        for (int j = 0; j < n_res; ++j)
+        {
+            if (equal_nan(res[j], res_p[j].get_gsli_double()) == false)
+            {
+                err     = true;
+                std::cout << j << ": " << res[j] << " " << res_p[j] << "\n";
+            }
+        };
+
+        if (equal_nan(log_abs(dx), log(x)) == false)
+            err         = true;
+
+        bool cmp[]      = {dx == dy, dx != dy, dx < dy, dx > dy, dx <= dy, dx >= dy};
+        bool cmp_p[]    = {x == y, x != y, x < y, x > y, x <= y, x >= y};
+
+        for (int j = 0; j < 6; ++j)
+        {
+            if (cmp[j] != cmp_p[j])
+            {
+                err     = true;
+                std::cout << "cmp " << j << ": " << cmp[j] << " " << cmp_p[j] << "\n";
+            }
+        };
+
+        if (err == true)
+        {
+            failed      = true;
+            std::cout   << i << " " << dx << " " << dy << "\n";
+        };
+    };
+
+    // batch versions must agree with scalar versions
+    gsli_prob res;
+
+    for (int i = 0; i < n_rep; ++i)
+        res             += vec_x[i];
+
+    gsli_prob res_b     = sum(vec_x.data(), vec_x.size());
+
+    if (equal_nan(res.get_gsli_double(), res_b.get_gsli_double()) == false)
+        failed          = true;
+
+    if (failed == true)
+        std::cout << "FAILED" << "\n";
+    else
+        std::cout << "OK" << "\n";
+};
+
 bool test_gsli::check_rep_level(int lev, double ind, bool sign_ind)
 {
     using sli = sli::gsli_double;
@@ -1089,8 +1506,10 @@ bool test_gsli::check_rep_level(int lev, double ind, bool sign_ind)
     return ok;
 };
 
-#pragma warning(push)
-#pragma warning(disable : 4127) //conditional expression is constant
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4127) //conditional expression is constant
+#endif
 
 void test_gsli::test_constants()
 {
@@ -1225,7 +1644,9 @@ void test_gsli::test_constants()
     }
 };
 
-#pragma warning(pop)
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 void test_gsli::test_nextafter(bool up)
 {
@@ -1292,6 +1713,96 @@ void test_gsli::test_nextafter(bool up)
     std::cout << (error ? "FAILED" : "OK") << "\n";
 };
 
+void test_gsli::test_float_distance(int n_rep)
+{
+    using config    = gsli_double::config_type;
+
+    std::cout << "\n";
+    std::cout << "testing float_distance" << "\n";
+
+    std::vector<gsli_double> vec_x, vec_y, vec_z;
+    std::vector<gsli_double> vec_up, vec_down;
+    std::vector<double> vec_dist;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        vec_x.push_back(rand_gsli(false, true, config::max_level));
+        vec_y.push_back(rand_gsli(false, true, config::max_level));
+        vec_z.push_back(rand_gsli(false, true, config::max_level));
+    };
+
+    vec_up.resize(n_rep);
+    vec_down.resize(n_rep);
+    vec_dist.resize(n_rep);
+
+    nextabove(vec_x.data(), vec_up.data(), n_rep);
+    nextbelow(vec_x.data(), vec_down.data(), n_rep);
+    float_distance(vec_x.data(), vec_y.data(), vec_dist.data(), n_rep);
+
+    bool error  = false;
+
+    for (int i = 0; i < n_rep; ++i)
+    {
+        const gsli_double& x    = vec_x[i];
+        gsli_double up          = nextabove(x);
+        gsli_double down        = nextbelow(x);
+        double dist             = float_distance(x, vec_y[i]);
+
+        bool new_error          = false;
+
+        // batch versions must agree with scalar versions
+        if (equal_nan(up, vec_up[i]) == false || equal_nan(down, vec_down[i]) == false)
+            new_error           = true;
+
+        if (dist != vec_dist[i] && (is_nan(dist) == false || is_nan(vec_dist[i]) == false))
+            new_error           = true;
+
+        if (dist != float_distance(vec_y[i], x) && is_nan(dist) == false)
+            new_error           = true;
+
+        if (is_finite(x) == true)
+        {
+            if (float_distance(x, up) != 1.0 || float_distance(x, down) != 1.0)
+                new_error       = true;
+
+            if (up <= x || down >= x)
+                new_error       = true;
+
+            if (nextbelow(up) != x || nextabove(down) != x)
+                new_error       = true;
+
+            if (float_distance(x, x) != 0.0)
+                new_error       = true;
+        };
+
+        // distance must be additive
+        gsli_double a           = x;
+        gsli_double b           = vec_y[i];
+        gsli_double c           = vec_z[i];
+
+        if (is_nan(a) == false && is_nan(b) == false && is_nan(c) == false)
+        {
+            if (b < a) std::swap(a, b);
+            if (c < b) std::swap(b, c);
+            if (b < a) std::swap(a, b);
+
+            double d_ab         = float_distance(a, b);
+            double d_bc         = float_distance(b, c);
+            double d_ac         = float_distance(a, c);
+
+            if (std::abs(d_ac - (d_ab + d_bc)) > 4.0 * config::eps * d_ac)
+                new_error       = true;
+        };
+
+        error   |= new_error;
+
+        if (new_error == true)
+            std::cout   << i << " " << x << " " << vec_y[i] << " " << vec_z[i] << "\n";
+    };
+
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
 void test_gsli::make_limit_numbers(std::vector<gsli_double>& vec)
 {
     using config    = gsli_double::config_type;    
@@ -1390,418 +1901,2737 @@ void test_gsli::test_io()
     std::cout << (error ? "FAILED" : "OK") << "\n";
 }
 
-double test_gsli::make_pow2_value(int pow, int subvalue)
+void test_gsli::test_chars(int n_sample)
 {
-    double val = std::ldexp(1.0, pow);
+    std::cout << "\n";
+    std::cout << "testing " << "chars" << "\n";
 
-    static const double E1  = 1.0 + std::numeric_limits<double>::epsilon();
-    static const double E2  = 1.5;
+    using config_type   = gsli_double::config_type;
 
-    switch(subvalue)
-    {
-        case 0:     return val;
-        case 1:     return val * E1;
-        case 2:     return val / E1;
-        case 3:     return val * E2;
-        case 4:     return val / E2;
-        default:    return val;
-    };
-};
+    std::vector<gsli_double> vec;
+    make_limit_numbers(vec);
 
-void test_gsli::test_rep()
-{   
-    using config_type   = gsli_double::config_type;
-    using sli           = sli::gsli_double;
+    vec.push_back(gsli_double(0.0));
+    vec.push_back(gsli_double(-1.0));
+    vec.push_back(gsli_double::make_infinity(true));
 
-    bool ok     = true;
+    for (int i = 0; i < n_sample; ++i)
+        vec.push_back(rand_gsli(true, true, config_type::max_level));
 
-    double E            = 1.0 + std::numeric_limits<double>::epsilon();
+    bool error          = false;
+    size_t max_length   = 0;
 
-    for (size_t lev = 1; lev < config_type::max_level; ++lev)
-    for(size_t sign_lev = 0; sign_lev <= 1; ++sign_lev)
-    for(size_t sign_ind = 0; sign_ind <= 1; ++sign_ind)
+    char buf[chars_max_length];
+    std::string str;
+
+    // text in shortest form must be read back exactly by operator>>
+    for (const gsli_double& elem : vec)
     {
-        bool sign_lev2  = sign_lev ? true : false;
-        bool sign_ind2  = sign_ind ? true : false;
+        to_chars_result res = to_chars(buf, buf + chars_max_length, elem);
 
-        int sig_lev = sign_lev2 ? -1 : 1;
+        if (res.ec != std::errc())
+        {
+            error       = true;
+            std::cout << "to_chars failed: " << elem << "\n";
+            continue;
+        };
 
-        ok          &= check_rep_level(sig_lev, config_type::min_index_1r, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * E, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * 1.5, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * 2.0, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::max_index_1, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / E, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / 1.5, sign_ind2);
-        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / 2.0, sign_ind2);
-    }
+        size_t length   = size_t(res.ptr - buf);
+        max_length      = std::max(max_length, length);
 
-    if (ok == false)
-        std::cout << "gsli rep error" << "\n";
+        str.assign(buf, length);
+        std::istringstream is(str);
 
-    int min_pow     = -1074;
-    int max_pow     = 1023;
+        gsli_double v;
+        is >> v;
 
-    double sum_prec = 0.0;
-    int num_prec    = 0;
+        if (equal_nan(v, elem) == false 
+            || (is_nan(elem) == false && v.get_internal_rep() != elem.get_internal_rep()))
+        {
+            error       = true;
+            std::cout << str << " " << elem << " " << v << "\n";
+        };
 
-    for(int i = min_pow; i <= max_pow; ++i)
+        // and by from_chars
+        gsli_double v2;
+        from_chars_result res_2 = from_chars(buf, res.ptr, v2);
+
+        if (res_2.ec != std::errc() || res_2.ptr != res.ptr || equal_nan(v2, elem) == false 
+            || (is_nan(elem) == false && v2.get_internal_rep() != elem.get_internal_rep()))
+        {
+            error       = true;
+            std::cout << "from_chars: " << str << " " << elem << " " << v2 << "\n";
+        };
+
+        // too small buffer
+        if (length > 0)
+        {
+            res         = to_chars(buf, buf + length - 1, elem);
+
+            if (res.ec != std::errc::value_too_large || res.ptr != buf + length - 1)
+            {
+                error   = true;
+                std::cout << "too small buffer accepted: " << str << "\n";
+            };
+        };
+    };
+
+    // text with precision 17 in scientific format is also exact
+    for (const gsli_double& elem : vec)
     {
-        for (int j = 0; j < 5; ++j)
+        char buf_prec[64];
+        to_chars_result res = to_chars(buf_prec, buf_prec + sizeof(buf_prec), elem,
+                                       chars_format::scientific, 16);
+
+        std::istringstream is(std::string(buf_prec, res.ptr));
+
+        gsli_double v;
+        is >> v;
+
+        gsli_double v2;
+        from_chars_result res_2 = from_chars(buf_prec, res.ptr, v2, chars_format::scientific);
+
+        if (res.ec != std::errc() || equal_nan(v, elem) == false 
+            || res_2.ec != std::errc() || equal_nan(v2, elem) == false)
         {
-            double val  = make_pow2_value(i, j);
-            sli x       = sli(val);
+            error       = true;
+            std::cout << std::string(buf_prec, res.ptr) << " " << elem << "\n";
+        };
+    };
 
-            double x_d  = x.get_internal_rep();
-            double x_v  = x.get_value();
-            double prec = (x_v - val)/val;
-            prec        = ::abs(prec);
+    // parsing of other forms; expected is compared with tolerance tol
+    // in ulp if ec is std::errc(), length is number of parsed characters
+    struct parse_case
+    {
+        const char*     m_text;
+        gsli_double     m_expected;
+        double          m_tol;
+        size_t          m_length;
+        std::errc       m_ec;
+    };
 
-            sum_prec    += prec;
-            num_prec    += 1;
+    const double ln10   = 2.30258509299404568402;
+    const std::errc ok  = std::errc();
+    const std::errc inv = std::errc::invalid_argument;
+    const std::errc oor = std::errc::result_out_of_range;
+
+    parse_case cases[] = 
+    {
+        {"1.5",             gsli_double(1.5),                       0.0,  3, ok},
+        {"-0.001",          gsli_double(-0.001),                    0.0,  6, ok},
+        {"1e1e2",           gsli_double(1.0e100),                   0.0,  5, ok},
+        {"25e-1e1",         gsli_double(2.5e-9),                    0.0,  7, ok},
+        {"1e400",           pow_int(gsli_double(10.0), 400),        4.0,  5, ok},
+        {"-1e-400",         -pow_int(gsli_double(10.0), -400),      4.0,  7, ok},
+        {"1e1e-2",          gsli_double(std::pow(10.0, 0.01)),      2.0,  6, ok},
+        {"-2.5e1e30",       -2.5 * exp(gsli_double(1.0e30) * ln10), 4.0,  9, ok},
+        {"1e-1e30",         exp(gsli_double(-1.0e30) * ln10),       4.0,  7, ok},
+        {"{2, 3.5}",        gsli_double(2, 3.5),                    0.0,  8, ok},
+        {"{-1,-7}",         gsli_double(-1, -7.0),                  0.0,  7, ok},
+        {"Infinity",        gsli_double::make_infinity(false),      0.0,  8, ok},
+        {"-inf",            gsli_double::make_infinity(true),       0.0,  4, ok},
+        {"NaN",             gsli_double::make_nan(),                0.0,  3, ok},
+        {"0e1e400",         gsli_double(0.0),                       0.0,  7, ok},
+        {"1e",              gsli_double(1.0),                       0.0,  1, ok},
+        {"1.5e+3x",         gsli_double(1500.0),                    0.0,  6, ok},
+        {"1e1e1e1e1e400",   gsli_double(),                          0.0, 13, oor},
+        {"1e-1e1e1e1e400",  gsli_double(),                          0.0, 14, oor},
+        {"",                gsli_double(),                          0.0,  0, inv},
+        {"-",               gsli_double(),                          0.0,  0, inv},
+        {"+1",              gsli_double(),                          0.0,  0, inv},
+        {"abc",             gsli_double(),                          0.0,  0, inv},
+        {"e5",              gsli_double(),                          0.0,  0, inv},
+        {"{1 2}",           gsli_double(),                          0.0,  0, inv},
+        {"{7, 2.0}",        gsli_double(),                          0.0,  0, inv},
+        {"{-5, 1.0}",       gsli_double(),                          0.0,  0, inv},
+    };
+
+    for (const parse_case& c : cases)
+    {
+        gsli_double v(7.0);
+        const char* last        = c.m_text + std::strlen(c.m_text);
+        from_chars_result res   = from_chars(c.m_text, last, v);
+
+        bool ok_res = res.ec == c.m_ec && size_t(res.ptr - c.m_text) == c.m_length;
+
+        if (c.m_ec == ok)
+            ok_res  = ok_res && calc_prec(v, c.m_expected) <= c.m_tol;
+        else
+            ok_res  = ok_res && v == gsli_double(7.0);
+
+        if (ok_res == false)
+        {
+            error   = true;
+            std::cout << "from_chars: " << c.m_text << " -> " << v << " " 
+                      << c.m_expected << "\n";
+        };
+    };
+
+    // the same text is written by operator<< for level 0 numbers
+    {
+        std::ostringstream os;
+        os << gsli_double(0.1) << " " << gsli_double(1, 2.5) << " " << gsli_double(-1.0e200);
+
+        std::string str_2;
+        to_chars_result res;
+
+        res             = to_chars(buf, buf + chars_max_length, gsli_double(0.1));
+        str_2.append(buf, res.ptr);
+        str_2.append(" ");
+        res             = to_chars(buf, buf + chars_max_length, gsli_double(1, 2.5));
+        str_2.append(buf, res.ptr);
+        str_2.append(" ");
+        res             = to_chars(buf, buf + chars_max_length, gsli_double(-1.0e200));
+        str_2.append(buf, res.ptr);
+
+        if (os.str() != str_2)
+        {
+            error       = true;
+            std::cout << os.str() << " != " << str_2 << "\n";
+        };
+    };
+
+    // decimal towers
+    struct tower_case
+    {
+        const char*     m_value;
+        int             m_digits;
+        const char*     m_tower;
+    };
+
+    tower_case towers[] = 
+    {
+        {"1.5",             6,      "1.5"},
+        {"2.5e400",         6,      "2.5e400"},
+        {"-9.9999999e400",  6,      "-1e401"},
+        {"1e-400",          6,      "1e-400"},
+        {"3.3e1e30",        6,      "1e1e30"},
+        {"-2.5e-1e1e30",    6,      "-1e-1e1e30"},
+        {"{2, 700}",        6,      "1e4.67054e320"},
+        {"{3, 2}",          3,      "1e1e3.4e17"},
+        {"1e1e1e1e1e15",    6,      "1e1e1e1e1e15"},
+        {"-Inf",            6,      "-Inf"},
+    };
+
+    for (const tower_case& c : towers)
+    {
+        gsli_double v;
+        from_chars(c.m_value, c.m_value + std::strlen(c.m_value), v);
+
+        char buf_tower[chars_tower_max_length];
+        to_chars_result res = to_chars_tower(buf_tower, buf_tower + chars_tower_max_length,
+                                             v, c.m_digits);
+
+        if (res.ec != std::errc() || std::string(buf_tower, res.ptr) != c.m_tower)
+        {
+            error       = true;
+            std::cout << "tower: " << c.m_value << " -> " << std::string(buf_tower, res.ptr) 
+                      << " != " << c.m_tower << "\n";
+        };
+    };
+
+    // towers are read back by from_chars with relative error 10^-digits
+    // of iterated logarithms on level 0; mantissas have at most 12 digits
+    // if exponents have 3 digits
+    std::vector<char> buf_batch(vec.size() * chars_tower_max_length);
+
+    for (int digits = 3; digits <= 15; digits += 6)
+    {
+        to_chars_result res = to_chars_tower(buf_batch.data(), buf_batch.data() 
+                                    + buf_batch.size(), vec.data(), vec.size(), digits, ';');
+
+        if (res.ec != std::errc())
+        {
+            error       = true;
+            std::cout << "tower batch failed" << "\n";
+            continue;
+        };
+
+        const char* pos = buf_batch.data();
+        double max_err  = 0.0;
+
+        for (const gsli_double& elem : vec)
+        {
+            gsli_double v;
+            from_chars_result res_v = from_chars(pos, res.ptr, v);
+
+            // rounded towers of the largest numbers can be out of range
+            if (res_v.ec == std::errc::result_out_of_range)
+            {
+                gsli_rep rep;
+                elem.get_gsli_rep(rep);
+
+                if (std::abs(rep.level()) == config_type::max_level)
+                {
+                    pos     = res_v.ptr + 1;
+                    continue;
+                };
+            };
+
+            if (res_v.ec != std::errc() || (res_v.ptr != res.ptr && *res_v.ptr != ';'))
+            {
+                error   = true;
+                std::cout << "tower batch: " << elem << " " << std::string(pos, res_v.ptr) 
+                          << "\n";
+                break;
+            };
+
+            pos         = res_v.ptr + 1;
+
+            if (is_finite(elem) == false || is_zero(elem) == true)
+            {
+                if (equal_nan(v, elem) == false)
+                {
+                    error   = true;
+                    std::cout << "tower batch: " << elem << " " << v << "\n";
+                };
 
-            if (prec < 1e-13)
                 continue;
+            };
 
-            std::cout   << i << " ";
-            std::cout   <<  std::scientific << std::setw(11) << std::setprecision(5) << val << " : " 
-                        <<  std::scientific << std::setw(11) << std::setprecision(5) << x_d << "; " 
-                        <<  std::scientific << std::setw(11) << std::setprecision(5) << x_v << "; "
-                        <<  std::scientific << std::setw(11) << std::setprecision(5) << prec
-                        << "\n";
+            gsli_double a   = elem;
+            gsli_double b   = v;
+
+            while (details::is_level_0(a.get_internal_rep()) == false)
+            {
+                a           = log_abs(a);
+                b           = log_abs(b);
+            };
+
+            double err      = std::abs((a.get_value() - b.get_value()) / a.get_value());
+            max_err         = std::max(max_err, err);
+        };
+
+        if (max_err > 10.0 * std::pow(10.0, -std::min(digits, 11)))
+        {
+            error       = true;
+            std::cout << "tower error: " << max_err << ", digits: " << digits << "\n";
         };
     };
 
-    std::cout << "\n";
-    std::cout << "mean error: " << sum_prec/num_prec << "\n";
-    std::cout << "\n";
+    std::cout << "max length: " << max_length << "\n";
+    std::cout << (error ? "FAILED" : "OK") << "\n";
 };
 
-double test_gsli::rand_num(bool with_denorm, bool with_special)
+static bool same_internal_rep(const gsli_double* x, const gsli_double* y, size_t n)
 {
-    const int min_pow   = with_denorm ? (-1074 + 1) : (-1022 + 1);
-    const int max_pow   = 1023;
+    return n == 0 || std::memcmp(x, y, n * sizeof(gsli_double)) == 0;
+};
 
-    double prob_special = get_prob_special();
+// write raw bytes to a file
+static void write_raw_file(const std::string& file, const std::string& bytes)
+{
+    std::ofstream os(file, std::ios::binary);
+    os.write(bytes.data(), std::streamsize(bytes.size()));
+};
 
-    if (with_special == true)
+void test_gsli::test_array_io(int n_sample)
+{
+    std::cout << "\n";
+    std::cout << "testing " << "array io" << "\n";
+
+    using config_type   = gsli_double::config_type;
+
+    std::vector<gsli_double> vec;
+    make_limit_numbers(vec);
+
+    vec.push_back(gsli_double(0.0));
+    vec.push_back(gsli_double::make_nan());
+    vec.push_back(gsli_double::make_infinity(true));
+
+    for (int i = 0; i < n_sample; ++i)
+        vec.push_back(rand_gsli(true, true, config_type::max_level));
+
+    bool error          = false;
+    std::string file    = "test_gsli_array.bin";
+
+    // stream round trip
+    std::ostringstream os(std::ios::binary);
+    write_array(os, vec.data(), vec.size());
+
+    std::string bytes   = os.str();
+
+    if (bytes.size() != array_header_size + vec.size() * sizeof(gsli_double))
     {
-        if (genrand_real1() < prob_special)
-            return rand_special();
+        error           = true;
+        std::cout << "invalid array size: " << bytes.size() << "\n";
     };
 
-    return rand_num(min_pow, max_pow);
-};
+    {
+        std::istringstream is(bytes, std::ios::binary);
+        std::vector<gsli_double> res;
+        array_status st = read_array(is, res);
 
-double test_gsli::rand_special()
-{
-    double base = rand_special_base();
+        if (st != array_status::ok || res.size() != vec.size()
+            || same_internal_rep(res.data(), vec.data(), vec.size()) == false)
+        {
+            error       = true;
+            std::cout << "read_array failed: " << array_status_name(st) << "\n";
+        };
+    };
 
-    unsigned ir         = genrand_int32();
-    ir                  = ir % 5;
+    // file round trip
+    if (write_array_file(file, vec.data(), vec.size()) != array_status::ok)
+    {
+        error           = true;
+        std::cout << "write_array_file failed\n";
+    };
 
-    static const double E1  = 1.0 + std::numeric_limits<double>::epsilon();
-    static const double E2  = 1.5;
+    {
+        std::vector<gsli_double> res;
+        array_status st = read_array_file(file, res);
 
-    switch (ir)
+        if (st != array_status::ok || res.size() != vec.size()
+            || same_internal_rep(res.data(), vec.data(), vec.size()) == false)
+        {
+            error       = true;
+            std::cout << "read_array_file failed: " << array_status_name(st) << "\n";
+        };
+    };
+
+    // mapped file
     {
-        case 0:     return base;
-        case 1:     return base * E1;
-        case 2:     return base / E1;
-        case 3:     return base * E2;
-        case 4:     return base / E2;
-        default:    return base;
-    }
-}
+        mapped_array map;
+        array_status st = map.open(file);
 
-double test_gsli::rand_special_base()
+        if (st != array_status::ok || map.is_open() == false || map.size() != vec.size()
+            || same_internal_rep(map.data(), vec.data(), vec.size()) == false)
+        {
+            error       = true;
+            std::cout << "mapped_array failed: " << array_status_name(st) << "\n";
+        };
+
+        span<const gsli_double> sub = map.elements().subspan(2, 3);
+
+        if (sub.size() != 3 || same_internal_rep(sub.data(), vec.data() + 2, 3) == false)
+        {
+            error       = true;
+            std::cout << "subspan failed\n";
+        };
+
+        mapped_array map2(std::move(map));
+
+        if (map.is_open() == true || map2.size() != vec.size())
+        {
+            error       = true;
+            std::cout << "mapped_array move failed\n";
+        };
+    };
+
+    // corrupted files must be rejected
+    struct corrupt_case
+    {
+        size_t          pos;        // position of modified byte or new size
+        bool            truncate;
+        array_status    expected;
+    };
+
+    corrupt_case cases[] =
+    {
+        {0,                                 false,  array_status::bad_magic},
+        {8,                                 false,  array_status::bad_version},
+        {16,                                false,  array_status::bad_config},
+        {20,                                false,  array_status::bad_config},
+        {32,                                false,  array_status::bad_byte_order},
+        {48,                                false,  array_status::bad_version},
+        {56,                                false,  array_status::bad_encoding},
+        {44,                                false,  array_status::truncated},
+        {array_header_size / 2,             true,   array_status::truncated},
+        {bytes.size() - 1,                  true,   array_status::truncated},
+    };
+
+    for (const corrupt_case& c : cases)
+    {
+        std::string data    = bytes;
+
+        if (c.truncate == true)
+            data.resize(c.pos);
+        else
+            data[c.pos]     = char(data[c.pos] ^ 0x01);
+
+        write_raw_file(file, data);
+
+        mapped_array map;
+        array_status st_map = map.open(file);
+
+        std::vector<gsli_double> res;
+        array_status st_read = read_array_file(file, res);
+
+        if (st_map != c.expected || st_read == array_status::ok || map.is_open() == true
+            || res.empty() == false)
+        {
+            error       = true;
+            std::cout << "corrupted file at " << c.pos << " not detected: " 
+                      << array_status_name(st_map) << ", " << array_status_name(st_read)
+                      << "\n";
+        };
+    };
+
+    // data offsets beyond the stream or not representable as streamsize
+    struct offset_case
+    {
+        uint64_t        offset;
+        array_status    expected;
+    };
+
+    offset_case offset_cases[] =
+    {
+        {array_header_size + 64,            array_status::truncated},
+        {uint64_t(1) << 63,                 array_status::truncated},
+        {(uint64_t(1) << 63) + 64,          array_status::bad_version},
+        {uint64_t(-1) - 7,                  array_status::bad_version},
+    };
+
+    for (const offset_case& c : offset_cases)
+    {
+        array_header h      = array_header::make(0, array_encoding::raw);
+        h.m_data_offset     = c.offset;
+
+        unsigned char buf[array_header_size];
+        write_array_header(h, buf);
+
+        std::istringstream is(std::string((const char*)buf, array_header_size), 
+                              std::ios::binary);
+        std::vector<gsli_double> res;
+        array_status st     = read_array(is, res);
+
+        if (st != c.expected)
+        {
+            error       = true;
+            std::cout << "data offset " << c.offset << " not detected: " 
+                      << array_status_name(st) << "\n";
+        };
+    };
+
+    std::remove(file.c_str());
+
+    {
+        mapped_array map;
+
+        if (map.open(file) != array_status::io_error)
+        {
+            error       = true;
+            std::cout << "missing file not detected\n";
+        };
+    };
+
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
+// compress vec to arr and check all ways of decoding; return false on error
+static bool check_codec(const std::vector<gsli_double>& vec, compressed_array& arr)
 {
     using config_type   = gsli_double::config_type;
-    unsigned ir         = genrand_int32();
-    ir                  = ir % 19;
 
-    switch(ir)
+    bool error          = false;
+    size_t n            = vec.size();
+
+    arr.assign(vec.data(), n);
+
+    std::vector<gsli_double> res(n + codec_block_size);
+    arr.decode(res.data());
+
+    if (arr.size() != n || same_internal_rep(res.data(), vec.data(), n) == false)
     {
-        case 0:     return 0.0;
-        case 1:     return -0.0;
-        
-        case 2:     return 1.0;
-        case 3:     return -1.0;
-        
-        case 4:     return 2.0;
-        case 5:     return -2.0;
-        
-        case 6:     return 0.5;
-        case 7:     return -0.5;
+        error           = true;
+        std::cout << "decode failed, size: " << n << "\n";
+    };
+
+    gsli_double block[codec_block_size];
+
+    for (size_t k = 0; k < arr.num_blocks(); ++k)
+    {
+        size_t first    = k * codec_block_size;
+        size_t len      = arr.decode_block(k, block);
+        int min_lev     = config_type::max_level + 1;
+        int max_lev     = -(config_type::max_level + 1);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            gsli_rep rep;
+            vec[first + i].get_gsli_rep(rep);
+
+            int lev     = vec[first + i] == 0.0 ? 0 : rep.level();
+            min_lev     = std::min(min_lev, lev);
+            max_lev     = std::max(max_lev, lev);
+        };
+
+        if (len != std::min(codec_block_size, n - first)
+            || same_internal_rep(block, vec.data() + first, len) == false
+            || arr.block_min_level(k) != min_lev || arr.block_max_level(k) != max_lev)
+        {
+            error       = true;
+            std::cout << "decode_block failed, block: " << k << "\n";
+        };
+    };
+
+    for (size_t i = 0; i < n; i += 7)
+    {
+        gsli_double val = arr.get(i);
+
+        if (same_internal_rep(&val, &vec[i], 1) == false)
+        {
+            error       = true;
+            std::cout << "get failed, index: " << i << "\n";
+        };
+    };
+
+    // stream round trip
+    std::ostringstream os(std::ios::binary);
+    arr.write(os);
+
+    std::istringstream is(os.str(), std::ios::binary);
+    compressed_array arr2;
+    array_status st     = arr2.read(is);
+
+    arr2.decode(res.data());
+
+    if (st != array_status::ok || arr2.size() != n
+        || arr2.compressed_size() != arr.compressed_size()
+        || same_internal_rep(res.data(), vec.data(), n) == false)
+    {
+        error           = true;
+        std::cout << "compressed read failed: " << array_status_name(st) << "\n";
+    };
+
+    return error == false;
+};
+
+void test_gsli::test_codec(int n_sample)
+{
+    std::cout << "\n";
+    std::cout << "testing " << "codec" << "\n";
+
+    using config_type   = gsli_double::config_type;
+
+    bool error          = false;
+    size_t n            = size_t(n_sample) + 37;
+    compressed_array arr;
+
+    // all levels and special values
+    std::vector<gsli_double> vec;
+    make_limit_numbers(vec);
+
+    vec.push_back(gsli_double(0.0));
+    vec.push_back(-gsli_double(0.0));
+    vec.push_back(gsli_double::make_nan());
+    vec.push_back(gsli_double::make_infinity(true));
+
+    while (vec.size() < n)
+        vec.push_back(rand_gsli(true, true, config_type::max_level));
+
+    error               |= check_codec(vec, arr) == false;
+
+    // mostly level 0 values converted from float, zeros, and a few 
+    // level 1 values
+    std::vector<gsli_double> vec_f(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        double r        = genrand_real1();
+        double v        = double(float(rand_num(-20, 20)));
+
+        if (r < 0.1)
+            vec_f[i]    = gsli_double(0.0);
+        else if (r < 0.12)
+            vec_f[i]    = gsli_double(1.0e300) * gsli_double(1.0e300) * gsli_double(v);
+        else
+            vec_f[i]    = gsli_double(v);
+    };
+
+    error               |= check_codec(vec_f, arr) == false;
+
+    double ratio        = double(n * sizeof(gsli_double)) / double(arr.compressed_size());
+
+    if (ratio < 1.8)
+    {
+        error           = true;
+        std::cout << "compression ratio too low: " << ratio << "\n";
+    };
+
+    std::cout << "compression ratio: " << ratio << "\n";
+
+    // empty array and single block
+    error               |= check_codec(std::vector<gsli_double>(), arr) == false;
+    error               |= check_codec(std::vector<gsli_double>(3, gsli_double(1.0)), arr) 
+                            == false;
+
+    // invalid streams
+    arr.assign(vec_f.data(), vec_f.size());
+
+    std::ostringstream os_c(std::ios::binary);
+    arr.write(os_c);
+    std::string bytes_c = os_c.str();
+
+    std::ostringstream os_r(std::ios::binary);
+    write_array(os_r, vec_f.data(), vec_f.size());
+    std::string bytes_r = os_r.str();
+
+    {
+        std::istringstream is(bytes_r, std::ios::binary);
+        compressed_array arr2;
+
+        if (arr2.read(is) != array_status::bad_encoding)
+        {
+            error       = true;
+            std::cout << "raw array read as compressed array\n";
+        };
+    };
+
+    {
+        std::istringstream is(bytes_c, std::ios::binary);
+        std::vector<gsli_double> res;
+
+        if (read_array(is, res) != array_status::bad_encoding)
+        {
+            error       = true;
+            std::cout << "compressed array read as raw array\n";
+        };
+    };
+
+    {
+        std::istringstream is(bytes_c.substr(0, bytes_c.size() - 1), std::ios::binary);
+        compressed_array arr2;
+
+        if (arr2.read(is) != array_status::truncated)
+        {
+            error       = true;
+            std::cout << "truncated compressed array not detected\n";
+        };
+    };
+
+    {
+        // width of exponent fields of the first block
+        size_t pos      = array_header_size + 8 * (1 + arr.num_blocks()) + 2;
+        std::string bad = bytes_c;
+        bad[pos]        = char(12);
+
+        std::istringstream is(bad, std::ios::binary);
+        compressed_array arr2;
+
+        if (arr2.read(is) != array_status::truncated)
+        {
+            error       = true;
+            std::cout << "corrupted block not detected\n";
+        };
+    };
+
+    {
+        // data offset not representable as streamsize
+        array_header h;
+        read_array_header((const unsigned char*)bytes_c.data(), h);
+        h.m_data_offset = (uint64_t(1) << 63) + 64;
+
+        unsigned char buf[array_header_size];
+        write_array_header(h, buf);
+
+        std::string bad = bytes_c;
+        bad.replace(0, array_header_size, (const char*)buf, array_header_size);
+
+        std::istringstream is(bad, std::ios::binary);
+        compressed_array arr2;
+
+        if (arr2.read(is) != array_status::bad_version)
+        {
+            error       = true;
+            std::cout << "invalid data offset not detected\n";
+        };
+    };
+
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
+void test_gsli::test_mapped_vector(int n_sample)
+{
+    std::cout << "\n";
+    std::cout << "testing " << "mapped vector" << "\n";
+
+    using config_type   = gsli_double::config_type;
+
+    bool error          = false;
+    size_t n            = 3 * size_t(n_sample) + 5;
+    size_t chunk        = 1000;
+    std::string file_x  = "test_gsli_mapped_x.bin";
+    std::string file_r  = "test_gsli_mapped_r.bin";
+
+    std::vector<gsli_double> ref(n);
+
+    for (size_t i = 0; i < n; ++i)
+        ref[i]          = rand_gsli(true, true, config_type::max_level);
+
+    // create and fill chunk by chunk
+    {
+        gsli_mapped_vector x;
+
+        if (x.create(file_x, n) != array_status::ok || x.size() != n 
+            || x.is_writable() == false)
+        {
+            error       = true;
+            std::cout << "create failed\n";
+        };
+
+        x.set_chunk_size(chunk);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (x[i] != 0.0)
+                error   = true;
+        };
+
+        size_t count    = 0;
+        size_t pos      = 0;
+
+        for (auto it = x.chunks().begin(); it != x.chunks().end(); ++it)
+        {
+            span<gsli_double> part  = *it;
+
+            if (it.index() != count || part.size() != std::min(chunk, n - pos))
+                error   = true;
+
+            for (gsli_double& elem : part)
+                elem    = ref[pos++];
+
+            ++count;
+        };
+
+        if (count != x.num_chunks() || pos != n || x.flush() == false)
+        {
+            error       = true;
+            std::cout << "chunk iteration failed\n";
+        };
+    };
+
+    gsli_mapped_vector x;
+    x.set_chunk_size(chunk);
+
+    if (x.open(file_x) != array_status::ok || x.size() != n || x.is_writable() == true
+        || same_internal_rep(x.data(), ref.data(), n) == false)
+    {
+        error           = true;
+        std::cout << "open failed\n";
+    };
+
+    // chunks processed by many threads
+    stream_options opts;
+    opts.m_threads      = 4;
+
+    std::atomic<size_t> count(0);
+    std::atomic<bool> chunk_error(false);
+
+    for_each_chunk(x, [&](size_t i, span<const gsli_double> part)
+    {
+        count           += part.size();
+
+        if (same_internal_rep(part.data(), ref.data() + i * chunk, part.size()) == false)
+            chunk_error = true;
+    }, opts);
+
+    if (count != n || chunk_error == true)
+    {
+        error           = true;
+        std::cout << "for_each_chunk failed\n";
+    };
+
+    // exceptions thrown in any thread are propagated to the caller
+    {
+        bool caught     = false;
+
+        try
+        {
+            for_each_chunk(x, [&](size_t i, span<const gsli_double>)
+            {
+                if (i % 2 == 1)
+                    throw std::runtime_error("chunk error");
+            }, opts);
+        }
+        catch (const std::runtime_error&)
+        {
+            caught      = true;
+        };
+
+        if (caught == false)
+        {
+            error       = true;
+            std::cout << "exception not propagated\n";
+        };
+    };
+
+    // transform into another mapped vector
+    {
+        gsli_mapped_vector res;
+        res.create(file_r, n);
+        res.set_chunk_size(chunk);
+
+        transform_chunks(x, x, res, [](const gsli_double* a, const gsli_double* b, 
+                                       gsli_double* r, size_t len)
+        {
+            mult(a, b, r, len);
+        }, opts);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res[i], ref[i] * ref[i]) == false)
+                chunk_error = true;
+        };
+
+        transform_chunks(x, res, [](const gsli_double* a, gsli_double* r, size_t len)
+        {
+            for (size_t i = 0; i < len; ++i)
+                r[i]    = -a[i];
+        }, opts);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res[i], -ref[i]) == false)
+                chunk_error = true;
+        };
+
+        if (chunk_error == true)
+        {
+            error       = true;
+            std::cout << "transform_chunks failed\n";
+        };
+    };
+
+    // reductions do not depend on number of threads
+    {
+        auto kernel     = [](const gsli_double* a, size_t len) { return sum(a, len); };
+        auto combine    = [](const gsli_double& a, const gsli_double& b) { return a + b; };
+
+        gsli_double s_ref   = gsli_double(0.0);
+
+        for (size_t first = 0; first < n; first += chunk)
+            s_ref       = s_ref + sum(ref.data() + first, std::min(chunk, n - first));
+
+        for (int threads = 1; threads <= 4; ++threads)
+        {
+            opts.m_threads  = threads;
+            gsli_double s   = reduce_chunks(x, kernel, combine, gsli_double(0.0), opts);
+
+            if (same_internal_rep(&s, &s_ref, 1) == false)
+            {
+                error       = true;
+                std::cout << "reduce_chunks failed, threads: " << threads << "\n";
+            };
+        };
+    };
+
+    x.close();
+
+    // invalid files
+    {
+        compressed_array arr;
+        arr.assign(ref.data(), n);
+
+        std::ofstream os(file_r, std::ios::binary);
+        arr.write(os);
+        os.close();
+
+        gsli_mapped_vector y;
+
+        if (y.open(file_r) != array_status::bad_encoding || y.is_open() == true)
+        {
+            error       = true;
+            std::cout << "compressed file mapped\n";
+        };
+    };
+
+    std::remove(file_x.c_str());
+    std::remove(file_r.c_str());
+
+    {
+        gsli_mapped_vector y;
+
+        if (y.open(file_x) != array_status::io_error)
+        {
+            error       = true;
+            std::cout << "missing file not detected\n";
+        };
+    };
+
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
+// compare summaries of chunks of x with summaries computed from elements
+static bool check_vector_summary(const gsli_vector& x)
+{
+    using config_type   = gsli_double::config_type;
+
+    const double max_mod    = config_type::max_index_0_sqrt;
+    const double min_mod    = 1.0 / max_mod;
+
+    for (size_t k = 0; k < x.num_chunks(); ++k)
+    {
+        span<const gsli_double> part    = x.chunk(k);
+        chunk_summary s                 = x.summary(k);
+
+        int min_lev     = config_type::max_level + 1;
+        int max_lev     = -(config_type::max_level + 1);
+        bool all_0      = true;
+        bool all_mod    = true;
+        bool has_zero   = false;
+        bool has_spec   = false;
+        bool has_nan    = false;
+
+        for (const gsli_double& v : part)
+        {
+            double a    = std::abs(v.get_value());
+
+            has_zero    = has_zero || is_zero(v);
+            has_nan     = has_nan || is_nan(v);
+            has_spec    = has_spec || is_nan(v) || is_inf(v);
+            all_mod     = all_mod && (a == 0.0 || (a >= min_mod && a <= max_mod));
+
+            if (is_nan(v) == true)
+            {
+                all_0   = false;
+                continue;
+            };
+
+            gsli_rep rep;
+            v.get_gsli_rep(rep);
+
+            // zeros have level -(max_level + 1)
+            int lev     = rep.level();
+            all_0       = all_0 && (lev == 0 || is_zero(v) == true);
+            min_lev     = std::min(min_lev, lev);
+            max_lev     = std::max(max_lev, lev);
+        };
+
+        if (s.m_min_level != min_lev || s.m_max_level != max_lev 
+            || s.m_all_level_0 != all_0 || s.m_all_moderate != all_mod
+            || s.m_has_zero != has_zero || s.m_has_special != has_spec 
+            || s.m_has_nan != has_nan)
+        {
+            return false;
+        };
+    };
+
+    return true;
+};
+
+// random element of gsli_vector; most elements are moderate numbers
+gsli_double test_gsli::rand_vector_elem()
+{
+    double r    = genrand_real1();
+
+    if (r < 0.1)
+        return gsli_double(r < 0.05 ? 0.0 : -0.0);
+    else if (r < 0.8)
+        return gsli_double(rand_num(-392, 393));
+    else
+        return rand_gsli(true, true, gsli_double::config_type::max_level);
+};
+
+void test_gsli::test_vector(int n_sample)
+{
+    std::cout << "\n";
+    std::cout << "testing " << "gsli_vector" << "\n";
+
+    bool error          = false;
+    size_t chunk        = gsli_vector::chunk_size();
+    size_t n            = 5 * chunk + 17;
+
+    std::vector<gsli_double> ref;
+    gsli_vector x;
+
+    // summaries are updated on every write
+    for (size_t i = 0; i < n; ++i)
+    {
+        ref.push_back(rand_vector_elem());
+        x.push_back(ref.back());
+    };
+
+    for (int rep = 0; rep < n_sample; ++rep)
+    {
+        double r        = genrand_real1();
+
+        if (r < 0.9)
+        {
+            size_t i    = genrand_int32() % ref.size();
+            ref[i]      = rand_vector_elem();
+            x.set(i, ref[i]);
+        }
+        else if (r < 0.95)
+        {
+            ref.push_back(rand_vector_elem());
+            x.push_back(ref.back());
+        }
+        else
+        {
+            size_t len  = n / 2 + genrand_int32() % n;
+            ref.resize(len);
+            x.resize(len);
+        };
+    };
+
+    if (x.size() != ref.size() || same_internal_rep(x.data(), ref.data(), x.size()) == false
+        || check_vector_summary(x) == false)
+    {
+        error           = true;
+        std::cout << "incremental update failed\n";
+    };
+
+    if (reinterpret_cast<uintptr_t>(x.data()) % 64 != 0)
+    {
+        error           = true;
+        std::cout << "invalid alignment\n";
+    };
+
+    x.update(chunk / 2, 2 * chunk, [&](gsli_double* ptr, size_t len)
+    {
+        for (size_t i = 0; i < len; ++i)
+            ptr[i]      = gsli_double(rand_num(-20, 20));
+    });
+
+    for (size_t i = 0; i < x.size(); ++i)
+        ref[i]          = x[i];
+
+    if (check_vector_summary(x) == false || x.summary(1).m_all_moderate == false)
+    {
+        error           = true;
+        std::cout << "update failed\n";
+    };
+
+    // queries
+    {
+        bool any_nan    = false;
+        bool any_spec   = false;
+        gsli_double m;
+
+        for (const gsli_double& v : ref)
+        {
+            any_nan     = any_nan || is_nan(v);
+            any_spec    = any_spec || is_nan(v) || is_inf(v);
+
+            if (is_nan(v) == false && abs(v) > m)
+                m       = abs(v);
+        };
+
+        if (x.any_nan() != any_nan || x.any_special() != any_spec 
+            || equal_nan(x.max_abs(), m) == false)
+        {
+            error       = true;
+            std::cout << "queries failed\n";
+        };
+
+        gsli_vector y(chunk + 3);
+        y.set(chunk + 1, gsli_double(1.0e300) * gsli_double(1.0e300));
+        y.set(5, gsli_double(-2.0));
+
+        if (y.all_level_0() == true || y.max_level() != 1 
+            || y.min_level() != -(gsli_double::config_type::max_level + 1)
+            || y.max_abs() != gsli_double(1.0e300) * gsli_double(1.0e300)
+            || y.any_nan() == true)
+        {
+            error       = true;
+            std::cout << "level queries failed\n";
+        };
+
+        // chunk of zeros next to a chunk of level -1 numbers
+        gsli_vector z(2 * chunk);
+
+        for (size_t i = chunk; i < 2 * chunk; ++i)
+            z.set(i, gsli_double(-1, 5.0));
+
+        if (z.max_abs() != gsli_double(-1, 5.0) || z.max_level() != -1 
+            || z.min_level() != -(gsli_double::config_type::max_level + 1) 
+            || gsli_vector(chunk).max_abs() != gsli_double(0.0)
+            || check_vector_summary(z) == false)
+        {
+            error       = true;
+            std::cout << "queries with zeros failed\n";
+        };
+    };
+
+    // batch functions are equal to elementwise operations; chunks are 
+    // moderate, mixed, moderate with zeros and general
+    {
+        size_t len      = 4 * chunk + 100;
+        std::vector<gsli_double> a(len), b(len), r(len);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            size_t k    = i / chunk;
+            double v1   = rand_num(-392, 393);
+            double v2   = rand_num(-392, 393);
+
+            a[i]        = gsli_double(v1);
+            b[i]        = gsli_double(v2);
+
+            if (k == 1 && i % 97 == 0)
+                b[i]    = rand_gsli(true, true, gsli_double::config_type::max_level);
+            else if (k == 2 && i % 5 == 0)
+                a[i]    = gsli_double(i % 2 == 0 ? 0.0 : -0.0);
+            else if (k >= 3)
+                a[i]    = rand_vector_elem();
+        };
+
+        gsli_vector va(a.data(), len), vb(b.data(), len), vr;
+        bool failed     = false;
+
+        plus(va, vb, vr);
+
+        for (size_t i = 0; i < len; ++i)
+            r[i]        = a[i] + b[i];
+
+        failed          |= same_internal_rep(vr.data(), r.data(), len) == false;
+        failed          |= check_vector_summary(vr) == false;
+
+        minus(va, vb, vr);
+
+        for (size_t i = 0; i < len; ++i)
+            r[i]        = a[i] - b[i];
+
+        failed          |= same_internal_rep(vr.data(), r.data(), len) == false;
+        failed          |= check_vector_summary(vr) == false;
+
+        mult(va, vb, vr);
+
+        for (size_t i = 0; i < len; ++i)
+            r[i]        = a[i] * b[i];
+
+        failed          |= same_internal_rep(vr.data(), r.data(), len) == false;
+        failed          |= check_vector_summary(vr) == false;
+
+        // result is one of arguments
+        mult(va, va, va);
+
+        for (size_t i = 0; i < len; ++i)
+            a[i]        = a[i] * a[i];
+
+        failed          |= same_internal_rep(va.data(), a.data(), len) == false;
+        failed          |= check_vector_summary(va) == false;
+
+        std::vector<double> d1(len), d2(len);
+        get_value(vb, d1.data());
+        get_value(b.data(), d2.data(), len);
+
+        failed          |= std::memcmp(d1.data(), d2.data(), len * sizeof(double)) != 0;
+
+        if (failed == true)
+        {
+            error       = true;
+            std::cout << "batch functions failed\n";
+        };
+    };
+
+    // sums are equal to sequential sums
+    {
+        size_t len      = 3 * chunk + 10;
+        std::vector<gsli_double> a(len);
+
+        for (int test = 0; test < 4; ++test)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                if (test == 0)
+                    a[i]    = gsli_double(rand_num(-392, 393));
+                else if (test == 1)
+                    a[i]    = gsli_double(i % 2 == 0 ? 0x1.0p393 : -0x1.fffffp392);
+                else if (test == 2)
+                    a[i]    = i < chunk ? gsli_double(1.0e300) * gsli_double(1.0e300) 
+                                        : gsli_double(rand_num(-392, 393));
+                else
+                    a[i]    = rand_vector_elem();
+            };
+
+            gsli_double s1  = sum(gsli_vector(a.data(), len));
+            gsli_double s2  = sum(a.data(), len);
+
+            if (same_internal_rep(&s1, &s2, 1) == false && (is_nan(s1) && is_nan(s2)) == false)
+            {
+                error       = true;
+                std::cout << "sum failed, test: " << test << "\n";
+            };
+        };
+    };
+
+    // parallel reductions
+    {
+        gsli_vector y(ref.data(), ref.size());
+
+        auto kernel     = [](const gsli_double* a, size_t len) { return sum(a, len); };
+        auto combine    = [](const gsli_double& a, const gsli_double& b) { return a + b; };
+
+        gsli_double s_ref   = gsli_double(0.0);
+
+        for (size_t first = 0; first < y.size(); first += chunk)
+            s_ref       = s_ref + sum(ref.data() + first, std::min(chunk, y.size() - first));
+
+        stream_options opts;
+        opts.m_threads  = 3;
+
+        gsli_double s   = reduce_chunks(y, kernel, combine, gsli_double(0.0), opts);
+        std::atomic<size_t> count(0);
+
+        for_each_chunk(y, [&](size_t, span<const gsli_double> part)
+        {
+            count       += part.size();
+        }, opts);
+
+        if (equal_nan(s, s_ref) == false || count != y.size())
+        {
+            error       = true;
+            std::cout << "reductions failed\n";
+        };
+    };
+
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
+void test_gsli::test_ldexp(int n_sample)
+{
+    std::cout << "\n";
+    std::cout << "testing " << "ldexp/frexp" << "\n";
+
+    using mant_exp      = gsli_double::mant_exp;
+
+    bool error          = false;
+    double max_dist     = 0.0;
+
+    // construction from (mant, exp) is equal to conversion of mant * 2^exp,
+    // if the result is a normal double; level 0 results are exact
+    for (int i = 0; i < n_sample; ++i)
+    {
+        double val      = rand_num(-960, 960);
+        int shift       = rand_int(-60, 60);
+        double mant     = std::ldexp(val, -shift);
+
+        gsli_double x(mant, shift, mant_exp());
+        gsli_double ref(val);
+
+        double dist     = std::abs(float_distance(x, ref));
+        max_dist        = std::max(max_dist, dist);
+
+        bool level_0    = std::abs(val) >= std::ldexp(1.0, -786) && std::abs(val) <= std::ldexp(1.0, 786);
+
+        if (dist > 1.0 || (level_0 == true && same_internal_rep(&x, &ref, 1) == false))
+        {
+            error       = true;
+            std::cout << "invalid (mant, exp) conversion: " << mant << " " << shift << "\n";
+            break;
+        };
+    };
+
+    // frexp returns mantissa from [0.5, 1) and reconstructs the same value
+    // within rounding error of the index; ldexp shifts the exponent
+    for (int i = 0; i < n_sample; ++i)
+    {
+        double mant     = rand_num(-1, -1);
+        int64_t exp     = int64_t(rand_num(-40, 40));
+
+        gsli_double x(mant, exp, mant_exp());
+
+        int64_t e;
+        double m        = frexp(x, e);
+
+        gsli_double y(m, e, mant_exp());
+
+        // rounding error of the argument is not larger than ulp of the
+        // result, if the result has larger index
+        int64_t shift   = int64_t(rand_num(-30, 30));
+        int64_t exp_z   = exp + shift;
+
+        if (std::abs(exp_z) < std::abs(exp))
+            std::swap(exp, exp_z);
+
+        gsli_double z   = ldexp(gsli_double(mant, exp, mant_exp()), exp_z - exp);
+        gsli_double z_ref(mant, exp_z, mant_exp());
+
+        double dist_y   = std::abs(float_distance(x, y));
+        double dist_z   = std::abs(float_distance(z, z_ref));
+
+        if (std::abs(m) < 0.5 || std::abs(m) >= 1.0 || dist_y > 2.0 || dist_z > 2.0)
+        {
+            error       = true;
+            std::cout << "invalid frexp/ldexp: " << mant << " " << exp << "\n";
+            break;
+        };
+
+        max_dist        = std::max(max_dist, std::max(dist_y, dist_z));
+    };
+
+    // special values
+    {
+        int64_t e       = 1;
+        bool failed     = false;
+
+        failed          |= frexp(gsli_double(-0.0), e) != 0.0 || e != 0 
+                            || is_signed(gsli_double(0.0, 100, mant_exp())) == true
+                            || is_signed(gsli_double(-0.0, 100, mant_exp())) == false;
+        failed          |= is_nan(gsli_double(std::numeric_limits<double>::quiet_NaN(), 
+                                10, mant_exp())) == false;
+        failed          |= is_inf(ldexp(gsli_double::make_infinity(false), -100)) == false;
+        failed          |= is_nan(ldexp(gsli_double::make_nan(), 100)) == false;
+
+        // exact level 0 results
+        failed          |= ldexp(gsli_double(0.75), -700).get_value() != 0.75 * std::ldexp(1.0, -700);
+        failed          |= ldexp(gsli_double(3.0), 700).get_value() != 3.0 * std::ldexp(1.0, 700);
+        failed          |= gsli_double(0.5, 787, mant_exp()) != gsli_double(std::ldexp(1.0, 786));
+
+        // exponents of level 3 values saturate
+        gsli_double big = gsli_double(3, 1.5);
+        double m        = frexp(big, e);
+        failed          |= m != 0.5 || e != std::numeric_limits<int64_t>::max();
+
+        m               = frexp(-inv(big), e);
+        failed          |= m != -0.5 || e != std::numeric_limits<int64_t>::min();
+
+        // exponents beyond int64_t
+        gsli_double h   = ldexp(gsli_double(0.5, std::numeric_limits<int64_t>::max(), mant_exp()),
+                            std::numeric_limits<int64_t>::max());
+        failed          |= h <= gsli_double(0.5, std::numeric_limits<int64_t>::max(), mant_exp());
+
+        if (failed == true)
+        {
+            error       = true;
+            std::cout << "invalid special values\n";
+        };
+    };
+
+#ifdef GSLI_TEST_HAS_BOOST
+    // conversions of multiprecision numbers
+    {
+        namespace mp    = boost::multiprecision;
+        using mp_float  = mp::number<mp::cpp_bin_float<1024, mp::digit_base_2>>;
+
+        bool failed     = false;
+
+        for (int i = 0; i < n_sample / 10; ++i)
+        {
+            mp::cpp_int x   = genrand_int32();
+
+            for (int k = rand_int(0, 20); k > 0; --k)
+                x           = x * genrand_int32() + genrand_int32();
+
+            if (genrand_real1() < 0.5)
+                x           = -x;
+
+            // x is exactly representable by the binary float, which is
+            // rounded to nearest
+            gsli_double g   = to_gsli_double(x);
+            gsli_double r   = to_gsli_double(mp_float(x));
+
+            failed          |= float_distance(g, r) != 0.0;
+        };
+
+        mp::cpp_int f   = 1;
+        gsli_double p   = gsli_double(1.0);
+
+        for (int i = 1; i <= 1000; ++i)
+        {
+            f           *= i;
+            p           = p * gsli_double(double(i));
+        };
+
+        failed          |= std::abs(float_distance(to_gsli_double(f), p)) > 10.0;
+        failed          |= to_gsli_double(mp::cpp_int(-12345)) != gsli_double(-12345.0);
+        failed          |= to_gsli_double(mp::cpp_int(0)) != gsli_double(0.0);
+        failed          |= is_nan(to_gsli_double(mp::cpp_bin_float_50(
+                                std::numeric_limits<double>::quiet_NaN()))) == false;
+
+        if (failed == true)
+        {
+            error       = true;
+            std::cout << "invalid multiprecision conversion\n";
+        };
+    };
+#endif
+
+    std::cout << "max distance: " << max_dist << "\n";
+    std::cout << (error ? "FAILED" : "OK") << "\n";
+};
+
+double test_gsli::make_pow2_value(int pow, int subvalue)
+{
+    double val = std::ldexp(1.0, pow);
+
+    static const double E1  = 1.0 + std::numeric_limits<double>::epsilon();
+    static const double E2  = 1.5;
+
+    switch(subvalue)
+    {
+        case 0:     return val;
+        case 1:     return val * E1;
+        case 2:     return val / E1;
+        case 3:     return val * E2;
+        case 4:     return val / E2;
+        default:    return val;
+    };
+};
+
+void test_gsli::test_rep()
+{   
+    using config_type   = gsli_double::config_type;
+    using sli           = sli::gsli_double;
+
+    bool ok     = true;
+
+    double E            = 1.0 + std::numeric_limits<double>::epsilon();
+
+    for (size_t lev = 1; lev < config_type::max_level; ++lev)
+    for(size_t sign_lev = 0; sign_lev <= 1; ++sign_lev)
+    for(size_t sign_ind = 0; sign_ind <= 1; ++sign_ind)
+    {
+        bool sign_lev2  = sign_lev ? true : false;
+        bool sign_ind2  = sign_ind ? true : false;
+
+        int sig_lev = sign_lev2 ? -1 : 1;
+
+        ok          &= check_rep_level(sig_lev, config_type::min_index_1r, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * E, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * 1.5, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::min_index_1r * 2.0, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::max_index_1, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / E, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / 1.5, sign_ind2);
+        ok          &= check_rep_level(sig_lev, config_type::max_index_1 / 2.0, sign_ind2);
+    }
+
+    if (ok == false)
+        std::cout << "gsli rep error" << "\n";
+
+    int min_pow     = -1074;
+    int max_pow     = 1023;
+
+    double sum_prec = 0.0;
+    int num_prec    = 0;
+
+    for(int i = min_pow; i <= max_pow; ++i)
+    {
+        for (int j = 0; j < 5; ++j)
+        {
+            double val  = make_pow2_value(i, j);
+            sli x       = sli(val);
+
+            double x_d  = x.get_internal_rep();
+            double x_v  = x.get_value();
+            double prec = (x_v - val)/val;
+            prec        = std::abs(prec);
+
+            sum_prec    += prec;
+            num_prec    += 1;
+
+            if (prec < 1e-13)
+                continue;
+
+            std::cout   << i << " ";
+            std::cout   <<  std::scientific << std::setw(11) << std::setprecision(5) << val << " : " 
+                        <<  std::scientific << std::setw(11) << std::setprecision(5) << x_d << "; " 
+                        <<  std::scientific << std::setw(11) << std::setprecision(5) << x_v << "; "
+                        <<  std::scientific << std::setw(11) << std::setprecision(5) << prec
+                        << "\n";
+        };
+    };
+
+    std::cout << "\n";
+    std::cout << "mean error: " << sum_prec/num_prec << "\n";
+    std::cout << "\n";
+};
+
+double test_gsli::rand_num(bool with_denorm, bool with_special)
+{
+    const int min_pow   = with_denorm ? (-1074 + 1) : (-1022 + 1);
+    const int max_pow   = 1023;
+
+    double prob_special = get_prob_special();
+
+    if (with_special == true)
+    {
+        if (genrand_real1() < prob_special)
+            return rand_special();
+    };
+
+    return rand_num(min_pow, max_pow);
+};
+
+double test_gsli::rand_special()
+{
+    double base = rand_special_base();
+
+    unsigned ir         = genrand_int32();
+    ir                  = ir % 5;
+
+    static const double E1  = 1.0 + std::numeric_limits<double>::epsilon();
+    static const double E2  = 1.5;
+
+    switch (ir)
+    {
+        case 0:     return base;
+        case 1:     return base * E1;
+        case 2:     return base / E1;
+        case 3:     return base * E2;
+        case 4:     return base / E2;
+        default:    return base;
+    }
+}
+
+double test_gsli::rand_special_base()
+{
+    using config_type   = gsli_double::config_type;
+    unsigned ir         = genrand_int32();
+    ir                  = ir % 19;
+
+    switch(ir)
+    {
+        case 0:     return 0.0;
+        case 1:     return -0.0;
+        
+        case 2:     return 1.0;
+        case 3:     return -1.0;
+        
+        case 4:     return 2.0;
+        case 5:     return -2.0;
+        
+        case 6:     return 0.5;
+        case 7:     return -0.5;
+
+        case 8:     return -std::numeric_limits<double>::infinity();
+        case 9:     return std::numeric_limits<double>::infinity();
+        case 10:    return std::numeric_limits<double>::quiet_NaN();
+
+        case 11:    return config_type::max_index_0;
+        case 12:    return -config_type::max_index_0;
+        case 13:    return config_type::min_index_0;
+        case 14:    return -config_type::min_index_0;
+
+        case 15:    return config_type::max_index_1;
+        case 16:    return -config_type::max_index_1;
+        case 17:    return config_type::min_index_1;
+        case 18:    return -config_type::min_index_1;
+
+        default:
+            return 0.0;
+    }
+};
+
+double test_gsli::rand_num(int min_pow, int max_pow)
+{
+    const int num_pow    = max_pow - min_pow + 1;
+
+    // rand power
+    unsigned ir     = genrand_int32();
+    int pow         = min_pow + (ir % num_pow);
+
+    // number from [0.5, 1];
+    double sig      = std::abs(genrand_real1() - 0.5) + 0.5;
+
+    double sign     = 1.0;
+    if (genrand_real1() < 0.5)
+        sign        = -1.0;
+
+    double val      = sign * std::ldexp(sig, pow);
+    return val;
+};
+
+int test_gsli::rand_int(int min, int max)
+{
+    const int num_val   = max - min + 1;
+
+    // rand power
+    unsigned ir     = genrand_int32();
+    int val         = min + (ir % num_val);
+
+    if (genrand_real1() < 0.5)
+        val         = -val;
+
+    return val;
+};
+
+bool test_gsli::equal_nan(const gsli_double& x1, const gsli_double& x2)
+{
+    if (x1 == x2)
+        return true;
+
+    if (is_nan(x1) == true && is_nan(x2) == true)
+        return true;
+
+    return false;
+}
+
+double test_gsli::calc_prec(double exact, double calc, double prec)
+{
+    if (std::isfinite(exact) == true && std::isfinite(calc) == true)
+    {
+        if (exact - calc == 0.0)
+            return 0.0;
+
+        //|exact - calc| <= eps(exact) + prec
+        return std::abs((exact - calc))/(eps(exact) + prec);
+    }
+
+    if (exact == calc)
+        return 0.0;
+
+    bool nan1   = is_nan(exact);
+    bool nan2   = is_nan(calc);
+    if (nan1 == true && nan2 == true)
+        return 0.0;
+
+    return 1.0e100;
+};
+
+double test_gsli::calc_prec(const gsli_double& res1, const gsli_double& res2)
+{
+    if (is_finite(res1) == true && is_finite(res2) == true)
+    {
+        if (res1 - res2 == 0.0)
+            return 0.0;
+
+        return float_distance(res1, res2);
+    }
+
+    if (res1 == res2)
+        return 0.0;
+
+    bool nan1   = is_nan(res1);
+    bool nan2   = is_nan(res2);
+    if (nan1 == true && nan2 == true)
+        return 0.0;
+
+    return 1.0e100;
+};
+
+void test_gsli::rand_binary(double& res1, double& res2)
+{
+    res1    = rand_num(false, true);
+    res2    = rand_num(false, true);
+};
+
+void test_gsli::rand_mult(gsli_double& v1, gsli_double& v2, int max_lev)
+{
+    v1      = rand_gsli(false, true, max_lev);
+    v2      = rand_gsli(false, true, max_lev);
+}
+
+void test_gsli::rand_plus(gsli_double& v1, gsli_double& v2, int max_lev)
+{
+    v1      = rand_gsli(false, true, max_lev);
+    v2      = rand_gsli(false, true, max_lev);
+}
+
+gsli_double test_gsli::rand_gsli(bool with_denorm, bool with_special, int max_lev)
+{
+    using config_type   = gsli_double::config_type;
+
+    const int num_lev   = max_lev + 1;
+
+    // rand power
+    unsigned ir     = genrand_int32();
+    int lev         = 0 + (ir % num_lev);
+
+    if (lev == 0)
+    {
+        double prob_spec= 0.02;
+
+        if (genrand_real1() < prob_spec)
+        {
+            int num_cases   = 6;
+            unsigned r      = genrand_int32();
+            int ver         = 0 + (r % num_cases);
+
+            double eps      = config_type::eps;
+            double ind;
+
+            switch(ver)
+            {
+                case 0:     ind = config_type::min_index_0; break;
+                case 1:     ind = config_type::max_index_0; break;
+                case 2:     ind = config_type::min_index_0*(1+eps); break;
+                case 3:     ind = config_type::max_index_0*(1-eps); break;
+                case 4:     ind = config_type::min_index_0*(1+2*eps); break;
+                case 5:     ind = config_type::max_index_0*(1-2*eps); break;
+                default:    ind = config_type::max_index_0; break;
+            }
+
+            return ind;
+        };
+
+        return rand_num(with_denorm, with_special);
+    }
+
+    double ind;
+    double prob_spec= 0.02;
+
+    if (genrand_real1() < prob_spec)
+    {
+        int num_cases   = 6;
+        unsigned r  = genrand_int32();
+        int ver     = 0 + (r % num_cases);
+
+        double eps  = config_type::eps;
+
+        switch(ver)
+        {
+            case 0:     ind = config_type::min_index_1r; break;
+            case 1:     ind = config_type::max_index_1; break;
+            case 2:     ind = config_type::min_index_1r*(1+eps); break;
+            case 3:     ind = config_type::max_index_1*(1-eps); break;
+            case 4:     ind = config_type::min_index_1r*(1+2*eps); break;
+            case 5:     ind = config_type::max_index_1*(1-2*eps); break;
+            default:    ind = config_type::max_index_1; break;
+        }
+    }
+    else
+    {
+        int min_exp = config_type::min_index_exp_1;
+        int max_exp = config_type::max_index_exp_1;
+        ind         = rand_num(-min_exp, max_exp);
+        ind         = std::abs(ind);
+    };
+
+    bool sign_lev   = (genrand_real1() < 0.5);
+    bool sign_ind   = (genrand_real1() < 0.5);
+
+    if (ind <= config_type::min_index_1)
+        ind     = config_type::min_index_1r;
+
+    return gsli_double(sign_lev ? -lev : lev, ind, sign_ind);
+};
+
+void test_gsli::rand_unary(double& res1)
+{
+    res1    = rand_num(true, true);
+};
+
+void test_gsli::rand_exp(double& res1)
+{
+    double prob_special = get_prob_special();
+    if (genrand_real1() < prob_special)
+    {
+        res1 = rand_special();
+        return;
+    };
+
+    int min_exp = -53;
+    int max_exp = 10;
+    res1 = rand_num(min_exp, max_exp);
+};
+
+void test_gsli::rand_pow_real(double& res1, double& res2)
+{
+    double prob_special = get_prob_special();
+
+    double m;
+    if (genrand_real1() < prob_special)
+        m       = rand_special();
+    else if (genrand_real1() < 1e-4)
+        m       = rand_num(false, true);
+    else
+        m       = rand_num(-10, 10);
+
+    res1        = rand_num(false, true);
+    res2        = res1 * m;
+
+    if (genrand_real1() < 0.5)
+        std::swap(res1, res2);
+};
+
+void test_gsli::rand_pow_int(double& res1, int& res2)
+{
+    res1        = rand_num(false, true);
+
+    unsigned r  = genrand_int32();
+    int max_pow = 100;
+    res2        = r %(max_pow * 2 + 1);
+    res2        = res2 - max_pow;
+};
+
+void test_gsli::rand_plus(double& res1, double& res2)
+{
+    double prob_special = get_prob_special();
+
+    double m;
+    if (genrand_real1() < prob_special)
+        m = rand_special();
+    else if (genrand_real1() < 1e-4)
+        m       = rand_num(false, true);
+    else
+        m       = rand_num(-52, 52);
+
+    res1        = rand_num(false, true);
+    res2        = res1 * m;
+
+    if (genrand_real1() < 0.5)
+        std::swap(res1, res2);
+};
+
+// return true if bit patterns of x and y are equal
+static bool same_bits(double x, double y)
+{
+    return std::memcmp(&x, &y, sizeof(x)) == 0;
+};
+
+// read width bits starting at bit pos of a stream
+static uint64_t read_bits(const unsigned char* src, size_t pos, int width)
+{
+    uint64_t val    = 0;
+
+    for (int b = 0; b < width; ++b)
+    {
+        size_t p    = pos + size_t(b);
+        val         |= uint64_t((src[p / 8] >> (p % 8)) & 1) << b;
+    };
+
+    return val;
+};
+
+void test_gsli::test_batch(int n_sample)
+{
+    using details::batch_isa;
+    using details::batch_kernels;
+
+    std::cout << "\n" << "testing batch kernels; selected: " 
+              << details::batch_isa_name(g_global_constants.m_batch_isa) << "\n";
+
+    size_t n            = size_t(n_sample);
+
+    std::vector<double> vec_x(n), vec_y(n), vec_e(n);
+    std::vector<gsli_double> vec_gx(n), vec_gy(n);
+    std::vector<gsli_prob> vec_p(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        vec_x[i]        = rand_num(true, true);
+        vec_y[i]        = -745.0 + genrand_real1() * (709.7 + 745.0);
+        vec_gx[i]       = rand_gsli(false, true, 4);
+        vec_gy[i]       = rand_gsli(false, true, 4);
+        vec_p[i]        = gsli_prob(abs(vec_gx[i]));
+    };
+
+    // sums of random numbers of different levels are trivial; use level 0
+    // and level 1 numbers, that are close to each other
+    std::vector<gsli_double> vec_s(n);
+
+    for (size_t i = 0; i < n; ++i)
+        vec_s[i]        = gsli_double(1.0e200) * gsli_double(1.0 + genrand_real1());
+
+    // arguments of level 0 kernels; vec_mz contains zeros, which are allowed
+    // in sums
+    std::vector<gsli_double> vec_mx(n), vec_my(n), vec_mz(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        vec_mx[i]       = gsli_double(rand_num(-392, 393));
+        vec_my[i]       = gsli_double(rand_num(-392, 393));
+        vec_mz[i]       = i % 7 == 0 ? gsli_double(i % 2 == 0 ? 0.0 : -0.0) : vec_my[i];
+    };
+
+    std::vector<double> res_d(n);
+    std::vector<gsli_double> res_g(n);
+    std::vector<char> res_b(n);
+    bool* ptr_b         = reinterpret_cast<bool*>(res_b.data());
+
+    // streams of exponent and mantissa fields followed by padding
+    std::vector<unsigned char> codec_src(5 * n + 8);
+
+    for (unsigned char& c : codec_src)
+        c               = (unsigned char)genrand_int32();
+
+    for (int k = 0; k < details::batch_isa_count; ++k)
+    {
+        batch_isa isa   = batch_isa(k);
+        batch_kernels table;
+
+        std::cout << details::batch_isa_name(isa) << ": ";
+
+        if (details::init_batch_kernels(isa, table) == false)
+        {
+            std::cout << "not supported" << "\n";
+            continue;
+        };
+
+        bool failed     = false;
+
+        table.exp_kernel(vec_y.data(), res_d.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (same_bits(res_d[i], details::exp_kernel(vec_y[i])) == false)
+                failed  = true;
+        };
+
+        table.log_kernel(vec_x.data(), res_d.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (same_bits(res_d[i], details::log_kernel(vec_x[i])) == false)
+                failed  = true;
+        };
+
+        table.convert(vec_x.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res_g[i], gsli_double(vec_x[i])) == false)
+                failed  = true;
+        };
+
+        table.get_value(vec_gx.data(), res_d.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (same_bits(res_d[i], vec_gx[i].get_value()) == false)
+                failed  = true;
+        };
+
+        table.plus(vec_gx.data(), vec_gy.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res_g[i], vec_gx[i] + vec_gy[i]) == false)
+                failed  = true;
+        };
+
+        table.minus(vec_gx.data(), vec_gy.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res_g[i], vec_gx[i] - vec_gy[i]) == false)
+                failed  = true;
+        };
+
+        table.mult(vec_gx.data(), vec_gy.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res_g[i], vec_gx[i] * vec_gy[i]) == false)
+                failed  = true;
+        };
+
+        table.div(vec_gx.data(), vec_gy.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (equal_nan(res_g[i], vec_gx[i] / vec_gy[i]) == false)
+                failed  = true;
+        };
+
+        table.plus_level_0(vec_mx.data(), vec_mz.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            gsli_double r   = vec_mx[i] + vec_mz[i];
+
+            if (same_bits(res_g[i].get_internal_rep(), r.get_internal_rep()) == false)
+                failed      = true;
+        };
+
+        table.minus_level_0(vec_mz.data(), vec_mx.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            gsli_double r   = vec_mz[i] - vec_mx[i];
+
+            if (same_bits(res_g[i].get_internal_rep(), r.get_internal_rep()) == false)
+                failed      = true;
+        };
+
+        table.mult_level_0(vec_mx.data(), vec_my.data(), res_g.data(), n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            gsli_double r   = vec_mx[i] * vec_my[i];
+
+            if (same_bits(res_g[i].get_internal_rep(), r.get_internal_rep()) == false)
+                failed      = true;
+        };
+
+        {
+            const double max_mod    = gsli_double::config_type::max_index_0_sqrt;
+            size_t n_zero, n_mod, ref_zero = 0, ref_mod = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                double a    = std::abs(vec_gx[i].get_internal_rep());
+                ref_zero    += a == 0.0;
+                ref_mod     += a >= 1.0 / max_mod && a <= max_mod;
+            };
+
+            table.count_moderate(vec_gx.data(), n, &n_zero, &n_mod);
+
+            if (n_zero != ref_zero || n_mod != ref_mod)
+                failed      = true;
+        };
+
+        table.less(vec_gx.data(), vec_gy.data(), ptr_b, n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ptr_b[i] != (vec_gx[i] < vec_gy[i]))
+                failed  = true;
+        };
+
+        table.greater(vec_gx.data(), vec_gy.data(), ptr_b, n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ptr_b[i] != (vec_gx[i] > vec_gy[i]))
+                failed  = true;
+        };
+
+        // equal elements are compared too
+        table.leq(vec_gx.data(), vec_gx.data(), ptr_b, n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ptr_b[i] != (vec_gx[i] <= vec_gx[i]))
+                failed  = true;
+        };
+
+        table.geq(vec_gx.data(), vec_gy.data(), ptr_b, n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ptr_b[i] != (vec_gx[i] >= vec_gy[i]))
+                failed  = true;
+        };
+
+        table.eq(vec_gx.data(), vec_gx.data(), ptr_b, n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (ptr_b[i] != (vec_gx[i] == vec_gx[i]))
+                failed  = true;
+        };
+
+        gsli_double s   = gsli_double(0.0);
+        gsli_double p   = gsli_double(1.0);
+        gsli_prob sp;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            s           = s + vec_s[i];
+            p           = p * vec_gx[i];
+            sp          = sp + vec_p[i];
+        };
+
+        if (equal_nan(table.sum(vec_s.data(), n), s) == false)
+            failed      = true;
+
+        if (equal_nan(table.prod(vec_gx.data(), n), p) == false)
+            failed      = true;
+
+        if (equal_nan(table.sum_prob(vec_p.data(), n).get_gsli_double(), 
+                      sp.get_gsli_double()) == false)
+        {
+            failed      = true;
+        };
+
+        // random bytes are valid streams of fields of any width
+        {
+            const int exp_bits  = 7;
+            const int mant_bits = 23;
+            const int exp_base  = 900;
+
+            std::vector<uint64_t> res_c(n);
+
+            if (n > 0)
+            {
+                table.codec_unpack(codec_src.data(), codec_src.data() + n, exp_bits, 
+                                   mant_bits, exp_base, res_c.data(), n);
+            };
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                uint64_t e      = read_bits(codec_src.data(), i * exp_bits, exp_bits);
+                uint64_t m      = read_bits(codec_src.data() + n, i * (mant_bits + 1), 
+                                    mant_bits + 1);
+                uint64_t sign   = (m >> mant_bits) << 63;
+                uint64_t frac   = (m & ((uint64_t(1) << mant_bits) - 1)) << (52 - mant_bits);
+                uint64_t exp    = uint64_t(e + exp_base - 1) << 52;
+                uint64_t ref    = e == 0 ? sign : sign | exp | frac;
+
+                if (res_c[i] != ref)
+                    failed      = true;
+            };
+        };
+
+        if (failed == true)
+            std::cout << "FAILED" << "\n";
+        else
+            std::cout << "OK" << "\n";
+    };
+};
+
+void test_gsli::test_counters()
+{
+    std::cout << "\n" << "testing path counters; enabled: " 
+              << path_counters_enabled() << "\n";
+
+    gsli_double a       = gsli_double(2.0);
+    gsli_double b       = gsli_double(3.0);
+    gsli_double big     = sli::exp(gsli_double(1000.0));
+    gsli_double small   = sli::exp(gsli_double(-1000.0));
+
+    reset_path_counters();
+
+    volatile bool cmp_1 = a < b;
+    volatile bool cmp_2 = a < small;
+    gsli_double r1      = a + b;
+    gsli_double r2      = big + big;
+    gsli_double r3      = a * b;
+    gsli_double r4      = big * a;
+
+    (void)cmp_1;
+    (void)cmp_2;
+    (void)r1;
+    (void)r2;
+    (void)r3;
+    (void)r4;
+
+    path_counters pc    = get_path_counters();
+
+    // counters in other thread are independent
+    path_counters pc_thread;
+
+    std::thread th([&pc_thread, &a, &b]()
+    {
+        gsli_double r   = a + b;
+        (void)r;
+        pc_thread       = get_path_counters();
+    });
+
+    th.join();
+
+    path_counters pc_sum    = pc;
+    pc_sum                  += pc_thread;
+
+    uint64_t on         = path_counters_enabled() == true ? 1 : 0;
+    bool failed         = false;
+
+    for (int i = 0; i < path_counters::n_op; ++i)
+    for (int j = 0; j < path_counters::n_path; ++j)
+    {
+        counter_op op       = counter_op(i);
+        counter_path path   = counter_path(j);
+        uint64_t exp_main   = 0;
+        uint64_t exp_thread = 0;
+
+        if (op == counter_op::plus && path == counter_path::fast)
+        {
+            exp_main        = on;
+            exp_thread      = on;
+        }
+        else if (op == counter_op::plus && path == counter_path::level_k)
+            exp_main        = on;
+        else if (op == counter_op::mult && path == counter_path::fast)
+            exp_main        = on;
+        else if (op == counter_op::mult && path == counter_path::level_0_k)
+            exp_main        = on;
+        else if (op == counter_op::cmp && path == counter_path::fast)
+            exp_main        = on;
+        else if (op == counter_op::cmp && path == counter_path::level_0_k)
+            exp_main        = on;
+
+        if (pc.get(op, path) != exp_main)
+            failed          = true;
+        if (pc_thread.get(op, path) != exp_thread)
+            failed          = true;
+        if (pc_sum.get(op, path) != exp_main + exp_thread)
+            failed          = true;
+    };
+
+    reset_path_counters();
+
+    if (get_path_counters().get_general(counter_op::plus) != 0)
+        failed              = true;
+
+    std::cout << pc_sum;
+
+    if (failed == true)
+        std::cout << "FAILED" << "\n";
+    else
+        std::cout << "OK" << "\n";
+};
+
+void test_gsli::test_flags()
+{
+    std::cout << "\n" << "testing range flags" << "\n";
+
+    using config_type   = gsli_double::config_type;
+
+    bool failed         = false;
+
+    clear_flags();
+
+    gsli_double a       = gsli_double(2.0);
+    gsli_double b       = gsli_double(3.0);
+
+    // level 0 operations do not set flags
+    gsli_double r       = a * b + a / b - sli::exp(a);
+
+    if (sli::test_flags() != 0)
+        failed          = true;
+
+    // leave level 0
+    gsli_double big     = sli::exp(gsli_double(1000.0));
+
+    if (sli::test_flags() != flag_level_k)
+        failed          = true;
+
+    // flags are sticky
+    r                   = a + b;
+
+    if (sli::test_flags() != flag_level_k)
+        failed          = true;
+
+    // reach maximum level and overflow
+    gsli_double x       = big;
+    gsli_double x_max   = big;
+
+    while (is_finite(x) == true)
+    {
+        x_max           = x;
+        x               = sli::exp(x);
+    };
+
+    if (sli::test_flags(flag_max_level | flag_overflow) 
+            != (flag_max_level | flag_overflow))
+    {
+        failed          = true;
+    };
+
+    // operations on special values do not set flags, unless the result
+    // is NaN
+    clear_flags();
+
+    r                   = x * x;
+    r                   = inv(x);
+    r                   = gsli_double(0.0) * big;
+
+    if (sli::test_flags() != 0)
+        failed          = true;
+
+    r                   = x - x;
+
+    if (is_nan(r) == false || sli::test_flags() != flag_nan)
+        failed          = true;
+
+    clear_flags();
+    r                   = gsli_double(0.0) * x;
+
+    if (is_nan(r) == false || sli::test_flags() != flag_nan)
+        failed          = true;
+
+    // NaN operands do not set flag_nan
+    clear_flags();
+    r                   = r + big;
+
+    if (sli::test_flags(flag_nan) != 0)
+        failed          = true;
+
+    // exact cancellation is not an underflow
+    clear_flags();
+    r                   = big - big;
+    r                   = (-big) + big;
+    r                   = inv(big) - inv(big);
+
+    if (is_zero(r) == false || sli::test_flags(flag_underflow) != 0)
+        failed          = true;
+
+    // underflow
+    r                   = sli::exp(-x_max);
+
+    if (is_zero(r) == false || sli::test_flags(flag_underflow) == 0)
+        failed          = true;
+
+    // saturation in constructor
+    clear_flags();
+
+    r                   = gsli_double(config_type::max_level + 1, 
+                                      std::numeric_limits<double>::quiet_NaN());
+
+    if (sli::test_flags() != flag_nan)
+        failed          = true;
+
+    clear_flags(flag_nan);
+    raise_flags(flag_overflow);
+
+    if (sli::test_flags() != flag_overflow)
+        failed          = true;
+
+    // flags in other thread are independent
+    unsigned flags_thread   = 1;
+
+    std::thread th([&flags_thread, &big]()
+    {
+        gsli_double r   = big * big;
+        (void)r;
+        flags_thread    = sli::test_flags();
+    });
+
+    th.join();
+
+    if (flags_thread != flag_level_k || sli::test_flags() != flag_overflow)
+        failed          = true;
+
+    clear_flags();
+
+    if (failed == true)
+        std::cout << "FAILED" << "\n";
+    else
+        std::cout << "OK" << "\n";
+};
+
+void test_gsli::test_profile(int n_sample)
+{
+    using profile::operand_class;
+
+    std::cout << "\n" << "testing profile" << "\n";
+
+    bool failed         = false;
+
+    // histograms
+    std::vector<gsli_double> vec;
+
+    vec.push_back(gsli_double(1.0));
+    vec.push_back(gsli_double(-3.0));
+    vec.push_back(sli::exp(gsli_double(1000.0)));
+    vec.push_back(-sli::exp(gsli_double(1000.0)));
+    vec.push_back(sli::exp(gsli_double(-1000.0)));
+    vec.push_back(gsli_double(0.0));
+    vec.push_back(gsli_double::make_infinity(false));
+    vec.push_back(gsli_double::make_nan());
+
+    profile::data_histogram h   = profile::histogram(vec.data(), vec.size());
+
+    if (h.m_count != vec.size())
+        failed          = true;
+    if (h.get_fptype(fptype::level_0) != 2 || h.get_fptype(fptype::level_k) != 3)
+        failed          = true;
+    if (h.get_fptype(fptype::zero) != 1 || h.get_fptype(fptype::inf) != 1 
+            || h.get_fptype(fptype::nan) != 1)
+    {
+        failed          = true;
+    };
+    if (h.get_level(0) != 2 || h.get_level(1) != 2 || h.get_level(-1) != 1)
+        failed          = true;
+    if (h.m_exp_0[h.max_exp_0] != 1 || h.m_exp_0[h.max_exp_0 + 1] != 1)
+        failed          = true;
+
+    std::cout << h;
+
+    // operation profiles recorded in two threads
+    size_t n            = size_t(n_sample);
+
+    std::vector<gsli_double> vec_x(n), vec_y(n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        vec_x[i]        = rand_gsli(false, true, 4);
+        vec_y[i]        = rand_gsli(false, true, 4);
+    };
+
+    profile::reset_op_profile();
+
+    auto sample         = [&vec_x, &vec_y, n]()
+    {
+        profile::sample_op(counter_op::plus, vec_x.data(), vec_y.data(), n, 2);
+        profile::sample_op(counter_op::exp, vec_x.data(), nullptr, n);
+    };
+
+    std::thread th(sample);
+    sample();
+    th.join();
 
-        case 8:     return -std::numeric_limits<double>::infinity();
-        case 9:     return std::numeric_limits<double>::infinity();
-        case 10:    return std::numeric_limits<double>::quiet_NaN();
+    profile::op_profile p   = profile::get_op_profile();
 
-        case 11:    return config_type::max_index_0;
-        case 12:    return -config_type::max_index_0;
-        case 13:    return config_type::min_index_0;
-        case 14:    return -config_type::min_index_0;
+    uint64_t count_plus[3][3]   = {};
+    uint64_t count_exp[3]       = {};
 
-        case 15:    return config_type::max_index_1;
-        case 16:    return -config_type::max_index_1;
-        case 17:    return config_type::min_index_1;
-        case 18:    return -config_type::min_index_1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        int c1          = int(profile::classify(vec_x[i]));
+        int c2          = int(profile::classify(vec_y[i]));
 
-        default:
-            return 0.0;
-    }
-};
+        if (i % 2 == 0)
+            count_plus[c1][c2]  += 2;
 
-double test_gsli::rand_num(int min_pow, int max_pow)
-{
-    const int num_pow    = max_pow - min_pow + 1;
+        count_exp[c1]   += 2;
+    };
 
-    // rand power
-    unsigned ir     = genrand_int32();
-    int pow         = min_pow + (ir % num_pow);
+    for (int i = 0; i < 3; ++i)
+    {
+        operand_class c1    = operand_class(i);
 
-    // number from [0.5, 1];
-    double sig      = ::abs(genrand_real1() - 0.5) + 0.5;
+        if (p.get_count(counter_op::exp, c1, operand_class::none) != count_exp[i])
+            failed      = true;
 
-    double sign     = 1.0;
-    if (genrand_real1() < 0.5)
-        sign        = -1.0;
+        for (int j = 0; j < 3; ++j)
+        {
+            operand_class c2    = operand_class(j);
 
-    double val      = sign * std::ldexp(sig, pow);
-    return val;
-};
+            if (p.get_count(counter_op::plus, c1, c2) != count_plus[i][j])
+                failed  = true;
+        };
+    };
 
-int test_gsli::rand_int(int min, int max)
-{
-    const int num_val   = max - min + 1;
+    std::cout << p;
 
-    // rand power
-    unsigned ir     = genrand_int32();
-    int val         = min + (ir % num_val);
+    profile::reset_op_profile();
 
-    if (genrand_real1() < 0.5)
-        val         = -val;
+    if (profile::get_op_profile().get_count(counter_op::exp, operand_class::level_0,
+                                            operand_class::none) != 0)
+    {
+        failed          = true;
+    };
 
-    return val;
+    if (failed == true)
+        std::cout << "FAILED" << "\n";
+    else
+        std::cout << "OK" << "\n";
 };
 
-bool test_gsli::equal_nan(const gsli_double& x1, const gsli_double& x2)
+int test_gsli::replay_trace(const std::vector<trace_record>& trace, int n_rep)
 {
-    if (x1 == x2)
-        return true;
+    static const int n_op   = int(trace_op::count);
 
-    if (is_nan(x1) == true && is_nan(x2) == true)
-        return true;
+    // check results
+    int n_failed        = 0;
 
-    return false;
-}
+    for (const trace_record& rec : trace)
+    {
+        if (replay(rec) != rec.m_result)
+            ++n_failed;
+    };
 
-double test_gsli::calc_prec(double exact, double calc, double prec)
-{
-    if (std::isfinite(exact) == true && std::isfinite(calc) == true)
+    // group records by operation and measure latency
+    std::vector<trace_record> groups[n_op];
+
+    for (const trace_record& rec : trace)
+        groups[int(rec.m_op)].push_back(rec);
+
+    std::cout << std::left << std::setw(10) << "op" << std::right 
+              << std::setw(12) << "count" << std::setw(12) << "ns/op" << "\n";
+
+    for (int i = 0; i < n_op; ++i)
     {
-        if (exact - calc == 0.0)
-            return 0.0;
+        const std::vector<trace_record>& group  = groups[i];
 
-        //|exact - calc| <= eps(exact) + prec
-        return std::abs((exact - calc))/(eps(exact) + prec);
-    }
+        if (group.empty() == true)
+            continue;
 
-    if (exact == calc)
-        return 0.0;
+        uint64_t sum    = 0;
 
-    bool nan1   = is_nan(exact);
-    bool nan2   = is_nan(calc);
-    if (nan1 == true && nan2 == true)
-        return 0.0;
+        tic();
 
-    return 1.0e100;
-};
+        for (int j = 0; j < n_rep; ++j)
+        {
+            for (const trace_record& rec : group)
+                sum     += replay(rec);
+        };
 
-double test_gsli::calc_prec(const gsli_double& res1, const gsli_double& res2)
-{
-    if (is_finite(res1) == true && is_finite(res2) == true)
-    {
-        if (res1 - res2 == 0.0)
-            return 0.0;
+        double t        = toc();
+        double ns_op    = 1.0e9 * t / (double(n_rep) * double(group.size()));
 
-        return float_distance(res1, res2);
-    }
+        std::cout << std::left << std::setw(10) << trace_op_name(trace_op(i)) 
+                  << std::right << std::setw(12) << group.size() 
+                  << std::setw(12) << std::fixed << std::setprecision(2) << ns_op
+                  << (sum == 0 ? " " : "") << "\n";
 
-    if (res1 == res2)
-        return 0.0;
+        std::cout.unsetf(std::ios_base::fixed);
+        std::cout << std::setprecision(6);
+    };
 
-    bool nan1   = is_nan(res1);
-    bool nan2   = is_nan(res2);
-    if (nan1 == true && nan2 == true)
-        return 0.0;
+    std::cout << "mismatched results: " << n_failed << "\n";
 
-    return 1.0e100;
+    return n_failed;
 };
 
-void test_gsli::rand_binary(double& res1, double& res2)
+int test_gsli::replay_trace_file(const std::string& file_name, int n_rep)
 {
-    res1    = rand_num(false, true);
-    res2    = rand_num(false, true);
-};
+    std::ifstream is(file_name, std::ios_base::binary);
+    std::vector<trace_record> trace;
 
-void test_gsli::rand_mult(gsli_double& v1, gsli_double& v2, int max_lev)
-{
-    v1      = rand_gsli(false, true, max_lev);
-    v2      = rand_gsli(false, true, max_lev);
-}
+    if (!is || read_trace(is, trace) == false)
+    {
+        std::cout << "unable to read trace " << file_name << "\n";
+        return 1;
+    };
 
-void test_gsli::rand_plus(gsli_double& v1, gsli_double& v2, int max_lev)
-{
-    v1      = rand_gsli(false, true, max_lev);
-    v2      = rand_gsli(false, true, max_lev);
-}
+    std::cout << "replaying " << trace.size() << " records from " << file_name << "\n";
 
-gsli_double test_gsli::rand_gsli(bool with_denorm, bool with_special, int max_lev)
-{
-    using config_type   = gsli_double::config_type;
+    return replay_trace(trace, n_rep) == 0 ? 0 : 1;
+};
 
-    const int num_lev   = max_lev + 1;
+void test_gsli::test_trace(int n_sample)
+{
+    std::cout << "\n" << "testing trace; enabled: " << trace_enabled() << "\n";
 
-    // rand power
-    unsigned ir     = genrand_int32();
-    int lev         = 0 + (ir % num_lev);
+    bool failed         = false;
 
-    if (lev == 0)
-    {
-        double prob_spec= 0.02;
+    size_t n            = size_t(n_sample);
 
-        if (genrand_real1() < prob_spec)
-        {
-            int num_cases   = 6;
-            unsigned r      = genrand_int32();
-            int ver         = 0 + (r % num_cases);
+    std::vector<gsli_double> vec_x(n), vec_y(n);
+    std::vector<double> vec_d(n);
 
-            double eps      = config_type::eps;
-            double ind;
+    for (size_t i = 0; i < n; ++i)
+    {
+        vec_x[i]        = rand_gsli(false, true, 4);
+        vec_y[i]        = rand_gsli(false, true, 4);
+        vec_d[i]        = rand_num(false, true);
+    };
 
-            switch(ver)
-            {
-                case 0:     ind = config_type::min_index_0; break;
-                case 1:     ind = config_type::max_index_0; break;
-                case 2:     ind = config_type::min_index_0*(1+eps); break;
-                case 3:     ind = config_type::max_index_0*(1-eps); break;
-                case 4:     ind = config_type::min_index_0*(1+2*eps); break;
-                case 5:     ind = config_type::max_index_0*(1-2*eps); break;
-                default:    ind = config_type::max_index_0; break;
-            }
+    using details::trace_bits;
 
-            return ind;
-        };
+    // records built by hand
+    std::vector<trace_record> trace;
 
-        return rand_num(with_denorm, with_special);
-    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        const gsli_double& x    = vec_x[i];
+        const gsli_double& y    = vec_y[i];
+        double d                = vec_d[i];
+        long k                  = long(i % 7) - 3;
+
+        trace_record rec;
+
+        rec.m_arg_1     = trace_bits(x);
+        rec.m_arg_2     = trace_bits(y);
+        rec.m_args      = trace_args::gsli_gsli;
+
+        rec.m_op        = trace_op::plus;
+        rec.m_result    = trace_bits(gsli_double(x + y));
+        trace.push_back(rec);
+
+        rec.m_op        = trace_op::div;
+        rec.m_result    = trace_bits(gsli_double(x / y));
+        trace.push_back(rec);
+
+        rec.m_op        = trace_op::cmp_leq;
+        rec.m_result    = trace_bits(bool(x <= y));
+        trace.push_back(rec);
+
+        rec.m_arg_2     = trace_bits(d);
+        rec.m_args      = trace_args::gsli_real;
+        rec.m_op        = trace_op::mult;
+        rec.m_result    = trace_bits(gsli_double(x * d));
+        trace.push_back(rec);
+
+        rec.m_arg_1     = trace_bits(d);
+        rec.m_arg_2     = trace_bits(x);
+        rec.m_args      = trace_args::real_gsli;
+        rec.m_op        = trace_op::pow_abs;
+        rec.m_result    = trace_bits(pow_abs(d, x));
+        trace.push_back(rec);
+
+        rec.m_arg_1     = trace_bits(x);
+        rec.m_arg_2     = trace_bits(k);
+        rec.m_args      = trace_args::gsli_long;
+        rec.m_op        = trace_op::pow_int;
+        rec.m_result    = trace_bits(pow_int(x, k));
+        trace.push_back(rec);
+
+        rec.m_arg_2     = 0;
+        rec.m_args      = trace_args::unary;
+        rec.m_op        = trace_op::exp;
+        rec.m_result    = trace_bits(exp(x));
+        trace.push_back(rec);
+    };
 
-    double ind;
-    double prob_spec= 0.02;
+    for (const trace_record& rec : trace)
+    {
+        if (replay(rec) != rec.m_result)
+            failed      = true;
+    };
 
-    if (genrand_real1() < prob_spec)
+    // write and read
     {
-        int num_cases   = 6;
-        unsigned r  = genrand_int32();
-        int ver     = 0 + (r % num_cases);
+        std::stringstream ss;
+        write_trace(ss, trace);
 
-        double eps  = config_type::eps;
+        std::vector<trace_record> trace_2;
 
-        switch(ver)
+        if (read_trace(ss, trace_2) == false || trace_2.size() != trace.size())
         {
-            case 0:     ind = config_type::min_index_1r; break;
-            case 1:     ind = config_type::max_index_1; break;
-            case 2:     ind = config_type::min_index_1r*(1+eps); break;
-            case 3:     ind = config_type::max_index_1*(1-eps); break;
-            case 4:     ind = config_type::min_index_1r*(1+2*eps); break;
-            case 5:     ind = config_type::max_index_1*(1-2*eps); break;
-            default:    ind = config_type::max_index_1; break;
+            failed      = true;
         }
-    }
-    else
-    {
-        int min_exp = config_type::min_index_exp_1;
-        int max_exp = config_type::max_index_exp_1;
-        ind         = rand_num(-min_exp, max_exp);
-        ind         = std::abs(ind);
-    };
+        else
+        {
+            for (size_t i = 0; i < trace.size(); ++i)
+            {
+                if (trace[i].m_arg_1 != trace_2[i].m_arg_1
+                        || trace[i].m_arg_2 != trace_2[i].m_arg_2
+                        || trace[i].m_result != trace_2[i].m_result
+                        || trace[i].m_op != trace_2[i].m_op
+                        || trace[i].m_args != trace_2[i].m_args)
+                {
+                    failed  = true;
+                };
+            };
+        };
 
-    bool sign_lev   = (genrand_real1() < 0.5);
-    bool sign_ind   = (genrand_real1() < 0.5);
+        std::stringstream bad("GSLIXXXX");
 
-    if (ind <= config_type::min_index_1)
-        ind     = config_type::min_index_1r;
+        if (read_trace(bad, trace_2) == true)
+            failed      = true;
 
-    return gsli_double(sign_lev ? -lev : lev, ind, sign_ind);
-};
+        // binary operation with unary operands and unary operation with
+        // binary operands are rejected
+        trace_record rec    = trace_record();
+        rec.m_op            = trace_op::plus;
+        rec.m_args          = trace_args::unary;
 
-void test_gsli::rand_unary(double& res1)
-{
-    res1    = rand_num(true, true);
-};
+        std::stringstream bad_args;
+        write_trace(bad_args, std::vector<trace_record>(1, rec));
 
-void test_gsli::rand_exp(double& res1)
-{
-    double prob_special = get_prob_special();
-    if (genrand_real1() < prob_special)
-    {
-        res1 = rand_special();
-        return;
-    };
+        if (read_trace(bad_args, trace_2) == true)
+            failed      = true;
 
-    int min_exp = -53;
-    int max_exp = 10;
-    res1 = rand_num(min_exp, max_exp);
-};
+        rec.m_op            = trace_op::exp;
+        rec.m_args          = trace_args::gsli_real;
 
-void test_gsli::rand_pow_real(double& res1, double& res2)
-{
-    double prob_special = get_prob_special();
+        std::stringstream bad_op;
+        write_trace(bad_op, std::vector<trace_record>(1, rec));
 
-    double m;
-    if (genrand_real1() < prob_special)
-        m       = rand_special();
-    else if (genrand_real1() < 1e-4)
-        m       = rand_num(false, true);
-    else
-        m       = rand_num(-10, 10);
+        if (read_trace(bad_op, trace_2) == true)
+            failed      = true;
+    };
 
-    res1        = rand_num(false, true);
-    res2        = res1 * m;
+    // recorded traces; ring buffer is smaller than number of slow path
+    // calls
+    if (trace_enabled() == true)
+    {
+        size_t capacity = n / 2;
+        size_t period   = 3;
 
-    if (genrand_real1() < 0.5)
-        std::swap(res1, res2);
-};
+        start_trace(capacity, period);
 
-void test_gsli::rand_pow_int(double& res1, int& res2)
-{
-    res1        = rand_num(false, true);
+        for (size_t i = 0; i < n; ++i)
+        {
+            gsli_double r   = vec_x[i] + vec_y[i];
+            r               = r - vec_d[i];
+            r               = r * vec_y[i];
+            r               = log_abs(r);
+            (void)r;
+        };
 
-    unsigned r  = genrand_int32();
-    int max_pow = 100;
-    res2        = r %(max_pow * 2 + 1);
-    res2        = res2 - max_pow;
-};
+        stop_trace();
 
-void test_gsli::rand_plus(double& res1, double& res2)
-{
-    double prob_special = get_prob_special();
+        std::vector<trace_record> rec_trace = get_trace();
 
-    double m;
-    if (genrand_real1() < prob_special)
-        m = rand_special();
-    else if (genrand_real1() < 1e-4)
-        m       = rand_num(false, true);
-    else
-        m       = rand_num(-52, 52);
+        if (trace_total() < capacity || rec_trace.size() != capacity)
+            failed      = true;
 
-    res1        = rand_num(false, true);
-    res2        = res1 * m;
+        for (const trace_record& rec : rec_trace)
+        {
+            if (replay(rec) != rec.m_result)
+                failed  = true;
+        };
 
-    if (genrand_real1() < 0.5)
-        std::swap(res1, res2);
+        std::cout << "recorded: " << trace_total() << ", stored: " 
+                  << rec_trace.size() << "\n";
+
+        if (replay_trace(rec_trace, 1) != 0)
+            failed      = true;
+    };
+
+    if (failed == true)
+        std::cout << "FAILED" << "\n";
+    else
+        std::cout << "OK" << "\n";
 };
 
 double test_gsli::get_prob_special()
@@ -1852,7 +4682,20 @@ void test_gsli::test()
     test_rep();
     test_nextafter(true);
     test_nextafter(false);
+    test_float_distance(n_rep_func / 10);
     test_io();
+    test_chars(n_rep_func / 10);
+    test_array_io(n_rep_func / 10);
+    test_codec(n_rep_func / 10);
+    test_mapped_vector(n_rep_func / 10);
+    test_vector(n_rep_func / 10);
+    test_ldexp(n_rep_func / 10);
+    test_math_kernels(n_rep_func);
+    test_batch(n_rep_func / 10);
+    test_counters();
+    test_flags();
+    test_profile(n_rep_func / 100);
+    test_trace(n_rep_func / 100);
 
     test_unary<func_abs>(n_rep_func);
     test_unary<func_inv>(n_rep_func);
@@ -1878,6 +4721,11 @@ void test_gsli::test()
     test_mult_lev(n_rep_func, 3);
     test_plus_lev(n_rep_func, 2);
     test_log_exp_lev(n_rep_func, 3);
+
+    test_interval_0(n_rep_func / 10);
+    test_interval_lev(n_rep_func / 10, 3);
+
+    test_prob(n_rep_func / 10, 3);
 };
 
 }};
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "gsli/gsli.h"
 
 #include <vector>
+#include <string>
 
 namespace sli { namespace testing
 {
@@ -31,6 +32,8 @@ struct test_gsli
 {
     private:
         using gsli_double   = sli::gsli_double;
+        using gsli_interval = sli::gsli_interval;
+        using gsli_prob     = sli::gsli_prob;
 
     public:
         void            test();
@@ -38,7 +41,27 @@ struct test_gsli
         void            test_rep();
         void            test_constants();
         void            test_nextafter(bool up);
+        void            test_float_distance(int n_sample);
         void            test_io();
+        void            test_chars(int n_sample);
+        void            test_array_io(int n_sample);
+        void            test_codec(int n_sample);
+        void            test_mapped_vector(int n_sample);
+        void            test_vector(int n_sample);
+        void            test_ldexp(int n_sample);
+        void            test_math_kernels(int n_sample);
+        void            test_batch(int n_sample);
+        void            test_counters();
+        void            test_flags();
+        void            test_profile(int n_sample);
+        void            test_trace(int n_sample);
+
+        // re-execute trace n_rep times, print latency of every operation and
+        // return number of records with different results
+        static int      replay_trace(const std::vector<trace_record>& trace, int n_rep);
+
+        // replay trace stored in a file; return 0 on success
+        static int      replay_trace_file(const std::string& file_name, int n_rep);
 
     private:
         bool            check_rep_level(int lev, double ind, bool sign_ind);
@@ -61,6 +84,9 @@ struct test_gsli
         void            test_mult_lev(int n_sample, int max_lev);
         void            test_plus_lev(int n_sample, int max_lev);
         void            test_log_exp_lev(int n_sample, int max_lev);
+        void            test_interval_0(int n_sample);
+        void            test_interval_lev(int n_sample, int max_lev);
+        void            test_prob(int n_sample, int max_lev);
         gsli_double     simple_mult(const gsli_double& v1, const gsli_double& v2);
         gsli_double     simple_plus(const gsli_double& v1, const gsli_double& v2);
 
@@ -80,9 +106,17 @@ struct test_gsli
         static void     rand_mult(gsli_double& v1, gsli_double& v2, int max_lev);
         static void     rand_plus(gsli_double& v1, gsli_double& v2, int max_lev);
         static gsli_double  rand_gsli(bool with_denorm, bool with_special, int max_lev);
+        static gsli_double  rand_vector_elem();
+        static gsli_interval rand_interval(int max_lev, gsli_double& point);
 
         static void     make_limit_numbers(std::vector<gsli_double>& limit_nubers);
         static bool     equal_nan(const gsli_double& x, const gsli_double& x2);
+
+        // return error of calc in ulp of exact value; exact must be finite
+        static double   ulp_error(double calc, long double exact);
+
+        // return error of calc in ulp of max(1, |exact|); exact must be finite
+        static double   abs_ulp_error(double calc, long double exact);
 };
 
 }};
\ No newline at end of file
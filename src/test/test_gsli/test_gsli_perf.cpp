@@ -18,8 +18,6 @@
 *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 */
 
-#pragma once
-
 #include "test_gsli_perf.h"
 #include "test_gsli.h"
 
@@ -30,6 +28,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 
 namespace sli { namespace testing
 {
@@ -157,7 +156,7 @@ void test_gsli_perf::test_cons_small(int max)
         sli x       = sli(val);
         double x_v  = x.get_value();
 
-        res         += ::abs(val - x_v);
+        res         += std::abs(val - x_v);
     };
 
     double t        = toc();
@@ -186,7 +185,7 @@ void test_gsli_perf::test_cons_large(int n_vec, int n_rep)
             sli x       = sli(val);
             double x_v  = x.get_value();
 
-            double err  = ::abs(val - x_v);;
+            double err  = std::abs(val - x_v);;
             if (val != 0.0)
                 err     = err / std::abs(val);
 
@@ -1281,6 +1280,623 @@ void test_gsli_perf::test_exp_large(int n_vec, int n_rep, int max_lev)
     std::cout << "res double: " << res_1[0] << "; res gsli: " << res_2[0] << "\n";
 };
 
+void test_gsli_perf::test_next_large(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<double>      res_1;
+    std::vector<gsli_double> res_2;
+
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+
+    {
+        std::vector<double> vec_1;
+        rand_double_all(vec_1, n_vec);
+
+        const double * ptr_1 = vec_1.data();
+        double* ptr_3        = res_1.data();
+        const double inf     = std::numeric_limits<double>::infinity();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = std::nextafter(ptr_1[j], inf);
+        };
+
+        t1          = toc();
+    };
+
+    {
+        std::vector<gsli_double> vec_1;
+        rand_gsli_all(vec_1, n_vec, max_lev);
+
+        const gsli_double * ptr_1 = vec_1.data();
+        gsli_double* ptr_3        = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            nextabove(ptr_1, ptr_3, n_vec);
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing nextabove large" << "\n";
+    std::cout << "time double: " << t1 << "; time gsli: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res double: " << res_1[0] << "; res gsli: " << res_2[0] << "\n";
+};
+
+void test_gsli_perf::test_distance_large(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<double>      res_1;
+    std::vector<double>      res_2;
+
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+
+    {
+        std::vector<double> vec_1, vec_2;
+        rand_double_all(vec_1, n_vec);
+        rand_double_all(vec_2, n_vec);
+
+        const double * ptr_1 = vec_1.data();
+        const double * ptr_2 = vec_2.data();
+        double* ptr_3        = res_1.data();
+
+        tic();
+
+        // double distance is measured as difference of bit patterns
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+            {
+                uint64_t b1, b2;
+                std::memcpy(&b1, ptr_1 + j, sizeof(b1));
+                std::memcpy(&b2, ptr_2 + j, sizeof(b2));
+                ptr_3[j]    = double(b1 > b2 ? b1 - b2 : b2 - b1);
+            };
+        };
+
+        t1          = toc();
+    };
+
+    {
+        std::vector<gsli_double> vec_1, vec_2;
+        rand_gsli_all(vec_1, n_vec, max_lev);
+        rand_gsli_all(vec_2, n_vec, max_lev);
+
+        const gsli_double * ptr_1 = vec_1.data();
+        const gsli_double * ptr_2 = vec_2.data();
+        double* ptr_3             = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            float_distance(ptr_1, ptr_2, ptr_3, n_vec);
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing float_distance large" << "\n";
+    std::cout << "time double: " << t1 << "; time gsli: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res double: " << res_1[0] << "; res gsli: " << res_2[0] << "\n";
+};
+
+void test_gsli_perf::rand_interval(std::vector<gsli_interval>& vec, int n_elem, int max_lev)
+{
+    for (int i = 0; i < n_elem; ++i)
+    {
+        gsli_double point;
+        gsli_interval val = test_gsli::rand_interval(max_lev, point);
+        vec.push_back(val);
+    };
+};
+
+void test_gsli_perf::test_interval_mult(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<gsli_double>    res_1;
+    std::vector<gsli_interval>  res_2;
+
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+
+    {
+        std::vector<gsli_double> vec_1, vec_2;
+        rand_gsli_all(vec_1, n_vec, max_lev);
+        rand_gsli_all(vec_2, n_vec, max_lev);
+
+        const gsli_double * ptr_1 = vec_1.data();
+        const gsli_double * ptr_2 = vec_2.data();
+        gsli_double* ptr_3        = res_1.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = ptr_1[j] * ptr_2[j];
+        };
+
+        t1          = toc();
+    };
+
+    {
+        std::vector<gsli_interval> vec_1, vec_2;
+        rand_interval(vec_1, n_vec, max_lev);
+        rand_interval(vec_2, n_vec, max_lev);
+
+        const gsli_interval * ptr_1 = vec_1.data();
+        const gsli_interval * ptr_2 = vec_2.data();
+        gsli_interval* ptr_3        = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            mult(ptr_1, ptr_2, ptr_3, n_vec);
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing interval mult" << "\n";
+    std::cout << "time gsli: " << t1 << "; time interval: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res gsli: " << res_1[0] << "; res interval: " << res_2[0] << "\n";
+};
+
+void test_gsli_perf::test_interval_exp(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<gsli_double>    res_1;
+    std::vector<gsli_interval>  res_2;
+
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+
+    {
+        std::vector<gsli_double> vec_1;
+        rand_gsli_all(vec_1, n_vec, max_lev);
+
+        const gsli_double * ptr_1 = vec_1.data();
+        gsli_double* ptr_3        = res_1.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = exp(ptr_1[j]);
+        };
+
+        t1          = toc();
+    };
+
+    {
+        std::vector<gsli_interval> vec_1;
+        rand_interval(vec_1, n_vec, max_lev);
+
+        const gsli_interval * ptr_1 = vec_1.data();
+        gsli_interval* ptr_3        = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            exp(ptr_1, ptr_3, n_vec);
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing interval exp" << "\n";
+    std::cout << "time gsli: " << t1 << "; time interval: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res gsli: " << res_1[0] << "; res interval: " << res_2[0] << "\n";
+};
+
+void test_gsli_perf::test_exp_kernel(int n_vec, int n_rep)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+    double t3               = 0.0;
+    double t4               = 0.0;
+    double min_normal       = std::numeric_limits<double>::min();
+
+    std::vector<double> vec, res_1, res_2, res_3, res_4;
+
+    vec.resize(n_vec);
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+    res_3.resize(n_vec);
+    res_4.resize(n_vec);
+
+    for (int i = 0; i < n_vec; ++i)
+        vec[i]      = -700.0 + 1400.0 * genrand_real1();
+
+    const double* ptr_1     = vec.data();
+
+    {
+        double* ptr_3       = res_1.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = std::exp(ptr_1[j]);
+        };
+
+        t1          = toc();
+    };
+
+    {
+        double* ptr_3       = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = details::exp_kernel(ptr_1[j]);
+        };
+
+        t2          = toc();
+    };
+
+    {
+        double* ptr_3       = res_3.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            details::exp_kernel(ptr_1, ptr_3, n_vec);
+
+        t3          = toc();
+    };
+
+    {
+        double* ptr_3       = res_4.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = details::exp_kernel_fast(ptr_1[j]);
+        };
+
+        t4          = toc();
+    };
+
+    // measured errors in ulp; reference values are computed in long double
+    double err_std          = 0.0;
+    double err_kernel       = 0.0;
+    double err_fast         = 0.0;
+
+    for (int i = 0; i < n_vec; ++i)
+    {
+        long double ex      = std::exp((long double)vec[i]);
+
+        if (std::isfinite((double)ex) == false || std::abs(ex) < min_normal)
+            continue;
+
+        err_std             = std::max(err_std, test_gsli::ulp_error(res_1[i], ex));
+        err_kernel          = std::max(err_kernel, test_gsli::ulp_error(res_2[i], ex));
+        err_fast            = std::max(err_fast, test_gsli::ulp_error(res_4[i], ex));
+    };
+
+    std::cout << "\n";
+    std::cout << "testing exp kernel" << "\n";
+    std::cout << "time std: " << t1 << "; time kernel: " << t2 << "; time batch: " << t3 
+              << "; time fast: " << t4 << "; ratio: " << t2 / t1 << "; ratio batch: " << t3 / t1 
+              << "; ratio fast: " << t4 / t1 << "\n";
+    std::cout << "error std: " << err_std << "; error kernel: " << err_kernel 
+              << "; error fast: " << err_fast << "\n";
+    std::cout << "res std: " << res_1[0] << "; res kernel: " << res_2[0] 
+              << "; res batch: " << res_3[0] << "; res fast: " << res_4[0] << "\n";
+};
+
+void test_gsli_perf::test_log_kernel(int n_vec, int n_rep)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+    double t3               = 0.0;
+    double t4               = 0.0;
+    double min_normal       = std::numeric_limits<double>::min();
+
+    std::vector<double> vec, res_1, res_2, res_3, res_4;
+
+    vec.resize(n_vec);
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+    res_3.resize(n_vec);
+    res_4.resize(n_vec);
+
+    for (int i = 0; i < n_vec; ++i)
+        vec[i]      = std::abs(test_gsli::rand_num(false, false));
+
+    const double* ptr_1     = vec.data();
+
+    {
+        double* ptr_3       = res_1.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = std::log(ptr_1[j]);
+        };
+
+        t1          = toc();
+    };
+
+    {
+        double* ptr_3       = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = details::log_kernel(ptr_1[j]);
+        };
+
+        t2          = toc();
+    };
+
+    {
+        double* ptr_3       = res_3.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            details::log_kernel(ptr_1, ptr_3, n_vec);
+
+        t3          = toc();
+    };
+
+    {
+        double* ptr_3       = res_4.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = details::log_kernel_fast(ptr_1[j]);
+        };
+
+        t4          = toc();
+    };
+
+    // measured errors in ulp; reference values are computed in long double
+    double err_std          = 0.0;
+    double err_kernel       = 0.0;
+    double err_fast         = 0.0;
+
+    for (int i = 0; i < n_vec; ++i)
+    {
+        long double ex      = std::log((long double)vec[i]);
+
+        if (std::isfinite((double)ex) == false || std::abs(ex) < min_normal)
+            continue;
+
+        err_std             = std::max(err_std, test_gsli::abs_ulp_error(res_1[i], ex));
+        err_kernel          = std::max(err_kernel, test_gsli::abs_ulp_error(res_2[i], ex));
+        err_fast            = std::max(err_fast, test_gsli::abs_ulp_error(res_4[i], ex));
+    };
+
+    std::cout << "\n";
+    std::cout << "testing log kernel" << "\n";
+    std::cout << "time std: " << t1 << "; time kernel: " << t2 << "; time batch: " << t3 
+              << "; time fast: " << t4 << "; ratio: " << t2 / t1 << "; ratio batch: " << t3 / t1 
+              << "; ratio fast: " << t4 / t1 << "\n";
+    std::cout << "error std: " << err_std << "; error kernel: " << err_kernel 
+              << "; error fast: " << err_fast << "\n";
+    std::cout << "res std: " << res_1[0] << "; res kernel: " << res_2[0] 
+              << "; res batch: " << res_3[0] << "; res fast: " << res_4[0] << "\n";
+};
+
+void test_gsli_perf::test_batch_isa(int n_vec, int n_rep, int max_lev)
+{
+    using details::batch_isa;
+    using details::batch_kernels;
+
+    std::vector<double> vec_d, vec_e, res_d;
+    std::vector<gsli_double> vec_1, vec_2, res_g;
+
+    rand_double_all(vec_d, n_vec);
+    rand_gsli_all(vec_1, n_vec, max_lev);
+    rand_gsli_all(vec_2, n_vec, max_lev);
+
+    vec_e.resize(n_vec);
+    res_d.resize(n_vec);
+    res_g.resize(n_vec);
+
+    for (int i = 0; i < n_vec; ++i)
+        vec_e[i]    = -700.0 + 1400.0 * genrand_real1();
+
+    std::cout << "\n";
+    std::cout << "testing batch kernels; selected: " 
+              << details::batch_isa_name(g_global_constants.m_batch_isa) << "\n";
+
+    for (int k = 0; k < details::batch_isa_count; ++k)
+    {
+        batch_isa isa   = batch_isa(k);
+        batch_kernels table;
+
+        if (details::init_batch_kernels(isa, table) == false)
+            continue;
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            table.convert(vec_d.data(), res_g.data(), n_vec);
+
+        double t1   = toc();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            table.get_value(vec_1.data(), res_d.data(), n_vec);
+
+        double t2   = toc();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            table.plus(vec_1.data(), vec_2.data(), res_g.data(), n_vec);
+
+        double t3   = toc();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            table.mult(vec_1.data(), vec_2.data(), res_g.data(), n_vec);
+
+        double t4   = toc();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+            table.exp_kernel(vec_e.data(), res_d.data(), n_vec);
+
+        double t5   = toc();
+
+        std::cout << details::batch_isa_name(isa) << ": time convert: " << t1 
+                  << "; time get_value: " << t2 << "; time plus: " << t3 
+                  << "; time mult: " << t4 << "; time exp: " << t5 << "\n";
+    };
+};
+
+void test_gsli_perf::rand_prob(std::vector<gsli_double>& vec_d, std::vector<gsli_prob>& vec_p,
+                               int n_elem, int max_lev)
+{
+    rand_gsli_all(vec_d, n_elem, max_lev);
+
+    vec_p.resize(n_elem);
+
+    for (int i = 0; i < n_elem; ++i)
+    {
+        vec_d[i]    = abs(vec_d[i]);
+        vec_p[i]    = gsli_prob(vec_d[i]);
+    };
+};
+
+void test_gsli_perf::test_prob_add(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<gsli_double>    vec_d1, vec_d2, res_1;
+    std::vector<gsli_prob>      vec_p1, vec_p2, res_2;
+
+    rand_prob(vec_d1, vec_p1, n_vec, max_lev);
+    rand_prob(vec_d2, vec_p2, n_vec, max_lev);
+
+    res_1.resize(n_vec);
+    res_2.resize(n_vec);
+
+    {
+        const gsli_double * ptr_1 = vec_d1.data();
+        const gsli_double * ptr_2 = vec_d2.data();
+        gsli_double* ptr_3        = res_1.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = ptr_1[j] + ptr_2[j];
+        };
+
+        t1          = toc();
+    };
+
+    {
+        const gsli_prob * ptr_1 = vec_p1.data();
+        const gsli_prob * ptr_2 = vec_p2.data();
+        gsli_prob* ptr_3        = res_2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                ptr_3[j]    = ptr_1[j] + ptr_2[j];
+        };
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing prob add" << "\n";
+    std::cout << "time gsli: " << t1 << "; time prob: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res gsli: " << res_1[0] << "; res prob: " << res_2[0] << "\n";
+};
+
+void test_gsli_perf::test_prob_cmp(int n_vec, int n_rep, int max_lev)
+{
+    double t1               = 0.0;
+    double t2               = 0.0;
+
+    std::vector<gsli_double>    vec_d1, vec_d2;
+    std::vector<gsli_prob>      vec_p1, vec_p2;
+
+    rand_prob(vec_d1, vec_p1, n_vec, max_lev);
+    rand_prob(vec_d2, vec_p2, n_vec, max_lev);
+
+    long res_1              = 0;
+    long res_2              = 0;
+
+    {
+        const gsli_double * ptr_1 = vec_d1.data();
+        const gsli_double * ptr_2 = vec_d2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                res_1       += (ptr_1[j] < ptr_2[j]);
+        };
+
+        t1          = toc();
+    };
+
+    {
+        const gsli_prob * ptr_1 = vec_p1.data();
+        const gsli_prob * ptr_2 = vec_p2.data();
+
+        tic();
+
+        for (int i = 0; i < n_rep; ++i)
+        {        
+            for (int j = 0; j < n_vec; ++j)
+                res_2       += (ptr_1[j] < ptr_2[j]);
+        };
+
+        t2          = toc();
+    };
+
+    std::cout << "\n";
+    std::cout << "testing prob cmp" << "\n";
+    std::cout << "time gsli: " << t1 << "; time prob: " << t2 << "; ratio: " << t2 / t1 << "\n";
+    std::cout << "res gsli: " << res_1 << "; res prob: " << res_2 << "\n";
+};
+
 void test_gsli_perf::test()
 {    
     {
@@ -1297,6 +1913,15 @@ void test_gsli_perf::test()
         test_exp_large(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
         test_log_large(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
         test_pow_large(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
+        test_next_large(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
+        test_distance_large(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
+        test_interval_mult(n_vec, n_rep, 3);
+        test_interval_exp(n_vec, n_rep, GSLI_MAX_LEVEL_DOUBLE);
+        test_prob_add(n_vec, n_rep, 2);
+        test_prob_cmp(n_vec, n_rep, 2);
+        test_exp_kernel(n_vec, n_rep);
+        test_log_kernel(n_vec, n_rep);
+        test_batch_isa(n_vec, n_rep, 2);
     };    
 
     {
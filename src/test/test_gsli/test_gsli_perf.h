@@ -31,6 +31,8 @@ struct test_gsli_perf
 {
     private:
         using gsli_double   = sli::gsli_double;
+        using gsli_interval = sli::gsli_interval;
+        using gsli_prob     = sli::gsli_prob;
 
     public:
         void            test();
@@ -56,6 +58,15 @@ struct test_gsli_perf
         void            test_log_large(int n_vec, int n_rep, int max_lev);
         void            test_exp_large(int n_vec, int n_rep, int max_lev);
         void            test_pow_large(int n_vec, int n_rep, int max_lev);
+        void            test_next_large(int n_vec, int n_rep, int max_lev);
+        void            test_distance_large(int n_vec, int n_rep, int max_lev);
+        void            test_interval_mult(int n_vec, int n_rep, int max_lev);
+        void            test_interval_exp(int n_vec, int n_rep, int max_lev);
+        void            test_prob_add(int n_vec, int n_rep, int max_lev);
+        void            test_prob_cmp(int n_vec, int n_rep, int max_lev);
+        void            test_exp_kernel(int n_vec, int n_rep);
+        void            test_log_kernel(int n_vec, int n_rep);
+        void            test_batch_isa(int n_vec, int n_rep, int max_lev);
 
     private:
         void            rand_double_add(std::vector<double>& vec, int n_elem);
@@ -73,6 +84,9 @@ struct test_gsli_perf
         void            rand_gsli_exp(std::vector<gsli_double>& vec, int n_elem);
         void            rand_gsli_pow1(std::vector<gsli_double>& vec, int n_elem);
         void            rand_gsli_pow2(std::vector<gsli_double>& vec, int n_elem);
+        void            rand_interval(std::vector<gsli_interval>& vec, int n_elem, int max_lev);
+        void            rand_prob(std::vector<gsli_double>& vec_d, std::vector<gsli_prob>& vec_p,
+                            int n_elem, int max_lev);
 };
 
 }};
\ No newline at end of file
@@ -20,21 +20,28 @@
 
 #include "timer.h"
 
-#include <windows.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <chrono>
+#endif
 
 namespace sli { namespace testing 
 {
 
 static bool tic_started = false;
+
+#ifdef _WIN32
+
 static __int64    tic_int64;
 
-void testing::tic(void)
+void tic(void)
 {
     tic_started = true;
     QueryPerformanceCounter((LARGE_INTEGER*) &tic_int64);
 }
 
-double testing::toc(void)
+double toc(void)
 {
     double t;
     __int64 toc_int64, fr_int64;
@@ -51,4 +58,28 @@ double testing::toc(void)
     return 0.;
 }
 
+#else
+
+static std::chrono::steady_clock::time_point tic_time;
+
+void tic(void)
+{
+    tic_started = true;
+    tic_time    = std::chrono::steady_clock::now();
+}
+
+double toc(void)
+{
+    if (tic_started)
+    {
+        tic_started = false;
+        std::chrono::duration<double> t = std::chrono::steady_clock::now() - tic_time;
+        return t.count();
+    }
+
+    return 0.;
+}
+
+#endif
+
 }};
\ No newline at end of file